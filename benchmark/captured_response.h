@@ -0,0 +1,30 @@
+#pragma once
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace abb ::rws ::benchmark
+{
+/**
+ * \brief Loads a captured RWS response from the benchmark data directory.
+ *
+ * \param name file name of the captured response, relative to the data directory.
+ *
+ * \return content of the captured response.
+ *
+ * \throw \a std::runtime_error if the file cannot be read.
+ */
+inline std::string loadCapturedResponse(std::string const& name)
+{
+  std::ifstream file{ std::string{ ABB_LIBRWS_BENCHMARK_DATA_DIR } + "/" + name };
+  if (!file)
+    throw std::runtime_error{ "Cannot open captured response " + name };
+
+  std::stringstream content;
+  content << file.rdbuf();
+
+  return content.str();
+}
+}  // namespace abb::rws::benchmark
@@ -0,0 +1,95 @@
+#include "captured_response.h"
+
+#include <abb_librws/mock/mock_controller.h>
+#include <abb_librws/parsing.h>
+#include <abb_librws/v1_0/rws_client.h>
+#include <abb_librws/v2_0/rws_client.h>
+
+#include <benchmark/benchmark.h>
+
+namespace abb ::rws ::benchmark
+{
+namespace
+{
+/**
+ * \brief Callback which only counts the events, so that the benchmarks measure the decoding.
+ */
+struct CountingCallback : SubscriptionCallback
+{
+  void processEvent(IOSignalStateEvent const& event) override
+  {
+    ::benchmark::DoNotOptimize(event);
+    ++count;
+  }
+
+  void processEvent(RAPIDExecutionStateEvent const& event) override
+  {
+    ::benchmark::DoNotOptimize(event);
+    ++count;
+  }
+
+  void processEvent(ControllerStateEvent const& event) override
+  {
+    ::benchmark::DoNotOptimize(event);
+    ++count;
+  }
+
+  void processEvent(OperationModeEvent const& event) override
+  {
+    ::benchmark::DoNotOptimize(event);
+    ++count;
+  }
+
+  std::size_t count = 0;
+};
+
+mock::MockControllerOptions mockOptions(mock::RWSVersion version)
+{
+  mock::MockControllerOptions options;
+  options.version = version;
+
+  if (version == mock::RWSVersion::V2_0)
+  {
+    options.certificate_file = ABB_LIBRWS_TEST_DATA_DIR "/mock_controller_cert.pem";
+    options.private_key_file = ABB_LIBRWS_TEST_DATA_DIR "/mock_controller_key.pem";
+  }
+
+  return options;
+}
+
+template <typename Client>
+void BM_processEvent(::benchmark::State& state, mock::RWSVersion version, std::string const& name)
+{
+  mock::MockController controller{ mockOptions(version) };
+  Client client{ controller.connectionOptions() };
+  auto const document = parseXml(loadCapturedResponse(name));
+  CountingCallback callback;
+
+  for (auto _ : state)
+    client.processEvent(document, callback);
+
+  state.SetItemsProcessed(static_cast<int64_t>(callback.count));
+}
+
+BENCHMARK_CAPTURE(BM_processEvent<v1_0::RWSClient>, v1_0_ios_signalstate, mock::RWSVersion::V1_0,
+                  "event_ios_signalstate.xml");
+BENCHMARK_CAPTURE(BM_processEvent<v1_0::RWSClient>, v1_0_ios_signalstate_batch, mock::RWSVersion::V1_0,
+                  "event_ios_signalstate_batch.xml");
+BENCHMARK_CAPTURE(BM_processEvent<v1_0::RWSClient>, v1_0_rap_ctrlexecstate, mock::RWSVersion::V1_0,
+                  "event_rap_ctrlexecstate.xml");
+BENCHMARK_CAPTURE(BM_processEvent<v1_0::RWSClient>, v1_0_pnl_ctrlstate, mock::RWSVersion::V1_0,
+                  "event_pnl_ctrlstate.xml");
+BENCHMARK_CAPTURE(BM_processEvent<v1_0::RWSClient>, v1_0_pnl_opmode, mock::RWSVersion::V1_0,
+                  "event_pnl_opmode.xml");
+BENCHMARK_CAPTURE(BM_processEvent<v2_0::RWSClient>, v2_0_ios_signalstate, mock::RWSVersion::V2_0,
+                  "event_ios_signalstate.xml");
+BENCHMARK_CAPTURE(BM_processEvent<v2_0::RWSClient>, v2_0_ios_signalstate_batch, mock::RWSVersion::V2_0,
+                  "event_ios_signalstate_batch.xml");
+BENCHMARK_CAPTURE(BM_processEvent<v2_0::RWSClient>, v2_0_rap_ctrlexecstate, mock::RWSVersion::V2_0,
+                  "event_rap_ctrlexecstate.xml");
+BENCHMARK_CAPTURE(BM_processEvent<v2_0::RWSClient>, v2_0_pnl_ctrlstate, mock::RWSVersion::V2_0,
+                  "event_pnl_ctrlstate.xml");
+BENCHMARK_CAPTURE(BM_processEvent<v2_0::RWSClient>, v2_0_pnl_opmode, mock::RWSVersion::V2_0,
+                  "event_pnl_opmode.xml");
+}  // namespace
+}  // namespace abb::rws::benchmark
@@ -0,0 +1,38 @@
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Runs the benchmarks and writes the results in JSON format.
+ *
+ * Unless \c --benchmark_out is given on the command line, the results are written to
+ * \c abb_librws_benchmarks.json in the working directory, so that they can be compared across releases.
+ */
+int main(int argc, char** argv)
+{
+  std::vector<char*> args{ argv, argv + argc };
+
+  bool has_out = false;
+  for (int i = 1; i < argc; ++i)
+    has_out = has_out || std::strncmp(argv[i], "--benchmark_out=", std::strlen("--benchmark_out=")) == 0;
+
+  std::string out = "--benchmark_out=abb_librws_benchmarks.json";
+  std::string out_format = "--benchmark_out_format=json";
+  if (!has_out)
+  {
+    args.push_back(out.data());
+    args.push_back(out_format.data());
+  }
+
+  int args_count = static_cast<int>(args.size());
+  ::benchmark::Initialize(&args_count, args.data());
+  if (::benchmark::ReportUnrecognizedArguments(args_count, args.data()))
+    return 1;
+
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+
+  return 0;
+}
@@ -0,0 +1,178 @@
+#include "captured_response.h"
+
+#include <abb_librws/parsing.h>
+#include <abb_librws/v2_0/rws.h>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+
+namespace abb ::rws ::benchmark
+{
+namespace
+{
+void BM_parseXml(::benchmark::State& state, std::string const& name)
+{
+  std::string const content = loadCapturedResponse(name);
+
+  for (auto _ : state)
+    ::benchmark::DoNotOptimize(parseXml(content));
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * content.size()));
+}
+
+BENCHMARK_CAPTURE(BM_parseXml, mechunit_robtarget, "mechunit_robtarget.xml");
+BENCHMARK_CAPTURE(BM_parseXml, mechunit_jointtarget, "mechunit_jointtarget.xml");
+BENCHMARK_CAPTURE(BM_parseXml, rapid_symbol_robtarget, "rapid_symbol_robtarget.xml");
+BENCHMARK_CAPTURE(BM_parseXml, cfg_moc_arm, "cfg_moc_arm.xml");
+BENCHMARK_CAPTURE(BM_parseXml, iosystem_signals, "iosystem_signals.xml");
+BENCHMARK_CAPTURE(BM_parseXml, event_ios_signalstate, "event_ios_signalstate.xml");
+
+void BM_xmlFindNodes(::benchmark::State& state, std::string const& name, XMLAttribute const& attribute)
+{
+  auto const document = parseXml(loadCapturedResponse(name));
+
+  for (auto _ : state)
+    ::benchmark::DoNotOptimize(xmlFindNodes(document, attribute));
+}
+
+BENCHMARK_CAPTURE(BM_xmlFindNodes, iosystem_signals, "iosystem_signals.xml", v2_0::XMLAttributes::CLASS_IOS_SIGNAL);
+BENCHMARK_CAPTURE(BM_xmlFindNodes, cfg_moc_arm, "cfg_moc_arm.xml", v2_0::XMLAttributes::CLASS_CFG_DT_INSTANCE_LI);
+
+/**
+ * \brief Looks up every component of a robtarget, the way \a RWSInterface::getMechanicalUnitRobTarget does.
+ */
+void BM_xmlFindTextContent_robtarget(::benchmark::State& state)
+{
+  auto const document = parseXml(loadCapturedResponse("mechunit_robtarget.xml"));
+  std::array<XMLAttribute, 17> const attributes{
+    XMLAttribute{ "class", "x" },     XMLAttribute{ "class", "y" },     XMLAttribute{ "class", "z" },
+    XMLAttribute{ "class", "q1" },    XMLAttribute{ "class", "q2" },    XMLAttribute{ "class", "q3" },
+    XMLAttribute{ "class", "q4" },    XMLAttribute{ "class", "cf1" },   XMLAttribute{ "class", "cf4" },
+    XMLAttribute{ "class", "cf6" },   XMLAttribute{ "class", "cfx" },   XMLAttribute{ "class", "eax_a" },
+    XMLAttribute{ "class", "eax_b" }, XMLAttribute{ "class", "eax_c" }, XMLAttribute{ "class", "eax_d" },
+    XMLAttribute{ "class", "eax_e" }, XMLAttribute{ "class", "eax_f" }
+  };
+
+  for (auto _ : state)
+  {
+    for (auto const& attribute : attributes)
+      ::benchmark::DoNotOptimize(xmlFindTextContent(document, attribute));
+  }
+}
+
+BENCHMARK(BM_xmlFindTextContent_robtarget);
+
+/**
+ * \brief Looks up every component of a robtarget in a single traversal.
+ */
+void BM_XMLTextContentQuery_robtarget(::benchmark::State& state)
+{
+  auto const document = parseXml(loadCapturedResponse("mechunit_robtarget.xml"));
+  XMLTextContentQuery const query{
+    XMLAttribute{ "class", "x" },     XMLAttribute{ "class", "y" },     XMLAttribute{ "class", "z" },
+    XMLAttribute{ "class", "q1" },    XMLAttribute{ "class", "q2" },    XMLAttribute{ "class", "q3" },
+    XMLAttribute{ "class", "q4" },    XMLAttribute{ "class", "cf1" },   XMLAttribute{ "class", "cf4" },
+    XMLAttribute{ "class", "cf6" },   XMLAttribute{ "class", "cfx" },   XMLAttribute{ "class", "eax_a" },
+    XMLAttribute{ "class", "eax_b" }, XMLAttribute{ "class", "eax_c" }, XMLAttribute{ "class", "eax_d" },
+    XMLAttribute{ "class", "eax_e" }, XMLAttribute{ "class", "eax_f" }
+  };
+
+  for (auto _ : state)
+    ::benchmark::DoNotOptimize(query.find(document));
+}
+
+BENCHMARK(BM_XMLTextContentQuery_robtarget);
+
+/**
+ * \brief Looks up a class missing from a large signal list, which requires a walk over the whole document.
+ */
+void BM_xmlFindTextContent_iosystem_signals(::benchmark::State& state)
+{
+  auto const document = parseXml(loadCapturedResponse("iosystem_signals.xml"));
+  XMLAttribute const attribute{ "class", "quality" };
+
+  for (auto _ : state)
+    ::benchmark::DoNotOptimize(xmlFindTextContent(document, attribute));
+}
+
+BENCHMARK(BM_xmlFindTextContent_iosystem_signals);
+
+/**
+ * \brief Extracts the IO signal list the way \a RWSInterface::getIOSignals did before streaming extraction.
+ */
+void BM_getIOSignals_dom(::benchmark::State& state)
+{
+  std::string const content = loadCapturedResponse("iosystem_signals.xml");
+
+  for (auto _ : state)
+  {
+    auto const document = parseXml(content);
+    for (auto&& node : xmlFindNodes(document, { "class", "ios-signal-li" }))
+    {
+      ::benchmark::DoNotOptimize(xmlFindTextContent(node, { "class", "name" }));
+      ::benchmark::DoNotOptimize(xmlFindTextContent(node, { "class", "lvalue" }));
+      ::benchmark::DoNotOptimize(xmlFindTextContent(node, { "class", "type" }));
+    }
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * content.size()));
+}
+
+BENCHMARK(BM_getIOSignals_dom);
+
+void BM_getIOSignals_stream(::benchmark::State& state)
+{
+  std::string const content = loadCapturedResponse("iosystem_signals.xml");
+  XMLExtractQuery const query{ { "class", "ios-signal-li" }, "class", { "name", "lvalue", "type" } };
+
+  for (auto _ : state)
+    xmlExtract(content, query, [](std::string const& key, std::string const& text) {
+      ::benchmark::DoNotOptimize(key);
+      ::benchmark::DoNotOptimize(text);
+    });
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * content.size()));
+}
+
+BENCHMARK(BM_getIOSignals_stream);
+
+void BM_getConfigurationInstances_stream(::benchmark::State& state)
+{
+  std::string const content = loadCapturedResponse("cfg_moc_arm.xml");
+  XMLExtractQuery const query{ v2_0::XMLAttributes::CLASS_CFG_DT_INSTANCE_LI, "title", {}, { "class", "cfg-ia-t-li" } };
+
+  for (auto _ : state)
+    xmlExtract(content, query, [](std::string const& key, std::string const& text) {
+      ::benchmark::DoNotOptimize(key);
+      ::benchmark::DoNotOptimize(text);
+    });
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * content.size()));
+}
+
+BENCHMARK(BM_getConfigurationInstances_stream);
+
+void BM_extractDelimitedSubstrings(::benchmark::State& state)
+{
+  std::string const value = "[[364.352,-12.904,594.001],[0.5000054,-1.2E-06,0.8660223,3.1E-06],[0,0,0,0],"
+                            "[9E+09,9E+09,9E+09,9E+09,9E+09,9E+09]]";
+
+  for (auto _ : state)
+    ::benchmark::DoNotOptimize(extractDelimitedSubstrings(value, '[', ']', ','));
+}
+
+BENCHMARK(BM_extractDelimitedSubstrings);
+
+void BM_splitDelimitedSubstrings(::benchmark::State& state)
+{
+  std::string const value = "[[364.352,-12.904,594.001],[0.5000054,-1.2E-06,0.8660223,3.1E-06],[0,0,0,0],"
+                            "[9E+09,9E+09,9E+09,9E+09,9E+09,9E+09]]";
+
+  for (auto _ : state)
+    ::benchmark::DoNotOptimize(splitDelimitedSubstrings(value, '[', ']', ','));
+}
+
+BENCHMARK(BM_splitDelimitedSubstrings);
+}  // namespace
+}  // namespace abb::rws::benchmark
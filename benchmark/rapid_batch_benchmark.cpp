@@ -0,0 +1,109 @@
+#include <abb_librws/mock/mock_controller.h>
+#include <abb_librws/v2_0/rws_client.h>
+#include <abb_librws/v2_0/rws_interface.h>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace abb ::rws ::benchmark
+{
+namespace
+{
+/**
+ * \brief Number of pooled HTTP sessions used by the batch reads.
+ */
+std::size_t const SESSION_POOL_SIZE = 4;
+
+/**
+ * \brief Simulated controller latency per request.
+ */
+std::chrono::microseconds const LATENCY{ 500 };
+
+mock::MockControllerOptions mockOptions()
+{
+  mock::MockControllerOptions options;
+  options.version = mock::RWSVersion::V2_0;
+  options.certificate_file = ABB_LIBRWS_TEST_DATA_DIR "/mock_controller_cert.pem";
+  options.private_key_file = ABB_LIBRWS_TEST_DATA_DIR "/mock_controller_key.pem";
+
+  return options;
+}
+
+/**
+ * \brief Fixture polling a number of RAPID num symbols, spread over two tasks, from a mock controller.
+ */
+struct RAPIDPollCycle
+{
+  explicit RAPIDPollCycle(std::size_t symbol_count) : controller{ mockOptions() }, values(symbol_count)
+  {
+    for (std::size_t i = 0; i < symbol_count; ++i)
+    {
+      RAPIDResource const resource{ i % 2 ? "T_ROB2" : "T_ROB1", "user", "value" + std::to_string(i) };
+      controller.setRAPIDSymbol(resource, RAPIDNum{ static_cast<float>(i) });
+      symbols.emplace_back(resource, &values[i]);
+    }
+
+    options = controller.connectionOptions();
+    options.session_pool_size = SESSION_POOL_SIZE;
+  }
+
+  mock::MockController controller;
+  ConnectionOptions options;
+  std::vector<RAPIDNum> values;
+  std::vector<std::pair<RAPIDResource, RAPIDSymbolDataAbstract*>> symbols;
+};
+
+void BM_readRAPIDSymbolsSequential(::benchmark::State& state)
+{
+  RAPIDPollCycle cycle{ static_cast<std::size_t>(state.range(0)) };
+  v2_0::RWSClient client{ cycle.options };
+  v2_0::RWSInterface interface{ client };
+
+  // Warm up the sessions and the symbol cache outside of the measurement.
+  for (auto const& [resource, data] : cycle.symbols)
+    interface.getRAPIDSymbolData(resource, *data);
+
+  cycle.controller.setLatency(LATENCY);
+
+  for (auto _ : state)
+  {
+    for (auto const& [resource, data] : cycle.symbols)
+      interface.getRAPIDSymbolData(resource, *data);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_readRAPIDSymbolsBatch(::benchmark::State& state)
+{
+  RAPIDPollCycle cycle{ static_cast<std::size_t>(state.range(0)) };
+  v2_0::RWSClient client{ cycle.options };
+  v2_0::RWSInterface interface{ client };
+
+  // Warm up the sessions and the symbol cache outside of the measurement.
+  for (auto const& error : interface.getRAPIDSymbolData(cycle.symbols))
+  {
+    if (error)
+    {
+      state.SkipWithError("batch read failed");
+      break;
+    }
+  }
+
+  cycle.controller.setLatency(LATENCY);
+
+  for (auto _ : state)
+    ::benchmark::DoNotOptimize(interface.getRAPIDSymbolData(cycle.symbols));
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_readRAPIDSymbolsSequential)->Arg(30)->Arg(60)->Unit(::benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_readRAPIDSymbolsBatch)->Arg(30)->Arg(60)->Unit(::benchmark::kMillisecond)->UseRealTime();
+}  // namespace
+}  // namespace abb::rws::benchmark
@@ -0,0 +1,108 @@
+#include <abb_librws/rws_rapid.h>
+#include <abb_librws/v2_0/rws_state_machine_interface.h>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+namespace abb ::rws ::benchmark
+{
+namespace
+{
+using EGMSettings = v2_0::RWSStateMachineInterface::EGMSettings;
+
+std::string const ROBTARGET = "[[364.352,-12.904,594.001],[0.5000054,-1.2E-06,0.8660223,3.1E-06],[0,0,0,0],"
+                              "[9E+09,9E+09,9E+09,9E+09,9E+09,9E+09]]";
+
+std::string const JOINTTARGET = "[[0.0012,-14.5731,22.801,0.0003,81.772,-0.0009],"
+                                "[9E+09,9E+09,9E+09,9E+09,9E+09,9E+09]]";
+
+std::string const TOOLDATA = "[TRUE,[[0,0,220.5],[1,0,0,0]],[1.5,[0,0,60],[1,0,0,0],0,0,0]]";
+
+/**
+ * \brief Returns a serialized \a EGMSettings record with the default values.
+ */
+std::string egmSettings()
+{
+  return EGMSettings{}.constructString();
+}
+
+template <typename T>
+void BM_parseString(::benchmark::State& state, std::string const& value)
+{
+  T data;
+
+  for (auto _ : state)
+  {
+    data.parseString(value);
+    ::benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK_CAPTURE(BM_parseString<RobTarget>, robtarget, ROBTARGET);
+BENCHMARK_CAPTURE(BM_parseString<JointTarget>, jointtarget, JOINTTARGET);
+BENCHMARK_CAPTURE(BM_parseString<ToolData>, tooldata, TOOLDATA);
+BENCHMARK_CAPTURE(BM_parseString<EGMSettings>, egm_settings, egmSettings());
+
+template <typename T>
+void BM_constructString(::benchmark::State& state, std::string const& value)
+{
+  T data;
+  data.parseString(value);
+
+  for (auto _ : state)
+    ::benchmark::DoNotOptimize(data.constructString());
+}
+
+BENCHMARK_CAPTURE(BM_constructString<RobTarget>, robtarget, ROBTARGET);
+BENCHMARK_CAPTURE(BM_constructString<JointTarget>, jointtarget, JOINTTARGET);
+BENCHMARK_CAPTURE(BM_constructString<ToolData>, tooldata, TOOLDATA);
+BENCHMARK_CAPTURE(BM_constructString<EGMSettings>, egm_settings, egmSettings());
+
+template <typename T>
+void BM_parseAtomic(::benchmark::State& state, std::string const& value)
+{
+  T data;
+
+  for (auto _ : state)
+  {
+    data.parseString(value);
+    ::benchmark::DoNotOptimize(data.value);
+  }
+}
+
+BENCHMARK_CAPTURE(BM_parseAtomic<RAPIDNum>, num_fixed, "364.352");
+BENCHMARK_CAPTURE(BM_parseAtomic<RAPIDNum>, num_exponent, "-1.2E-06");
+BENCHMARK_CAPTURE(BM_parseAtomic<RAPIDDnum>, dnum_fixed, "594.000999999999976");
+
+template <typename T>
+void BM_constructAtomic(::benchmark::State& state, typename T::value_type value)
+{
+  T const data{ value };
+
+  for (auto _ : state)
+    ::benchmark::DoNotOptimize(data.constructString());
+}
+
+BENCHMARK_CAPTURE(BM_constructAtomic<RAPIDNum>, num_fixed, 364.352f);
+BENCHMARK_CAPTURE(BM_constructAtomic<RAPIDNum>, num_general, 0.5000054f);
+BENCHMARK_CAPTURE(BM_constructAtomic<RAPIDDnum>, dnum_fixed, 594.001);
+
+template <typename T>
+void BM_constructAtomicIntoBuffer(::benchmark::State& state, typename T::value_type value)
+{
+  T const data{ value };
+  char buffer[T::MAX_STRING_SIZE];
+
+  for (auto _ : state)
+  {
+    ::benchmark::DoNotOptimize(data.constructString(buffer, buffer + T::MAX_STRING_SIZE));
+    ::benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK_CAPTURE(BM_constructAtomicIntoBuffer<RAPIDNum>, num_fixed, 364.352f);
+BENCHMARK_CAPTURE(BM_constructAtomicIntoBuffer<RAPIDNum>, num_general, 0.5000054f);
+BENCHMARK_CAPTURE(BM_constructAtomicIntoBuffer<RAPIDDnum>, dnum_fixed, 594.001);
+}  // namespace
+}  // namespace abb::rws::benchmark
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "system_constants.h"
+#include "http_log_mode.h"
 
 #include <string>
+#include <cstddef>
 #include <chrono>
 
 namespace abb ::rws
@@ -37,5 +39,23 @@ namespace abb ::rws
 
         /// \brief HTTP receive timeout
         std::chrono::microseconds receive_timeout;
+
+        /// \brief Maximum number of concurrent HTTP sessions to the RWS server
+        std::size_t session_pool_size = 1;
+
+        /// \brief Collect per-session usage statistics
+        bool session_metrics = false;
+
+        /// \brief HTTP communication logging mode
+        HTTPLogMode log_mode = HTTPLogMode::OFF;
+
+        /// \brief Maximum number of response content bytes logged per request in HTTPLogMode::FULL
+        std::size_t log_content_limit = 4096;
+
+        /// \brief Record per-request latency metrics
+        bool request_metrics = false;
+
+        /// \brief OpenSSL cipher list for HTTPS connections (RWS 2.0). AEAD suites are preferred by default.
+        std::string cipher_list = "ECDHE+AESGCM:ECDHE+CHACHA20:DHE+AESGCM:DHE+CHACHA20:ALL:!ADH:!LOW:!EXP:!MD5";
     };
 }
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace abb ::rws
+{
+/**
+ * \brief Interface of an executor running tasks asynchronously, e.g. on a thread pool.
+ *
+ * Implement this interface to run the asynchronous RWS requests on an executor provided by the application.
+ */
+class Executor
+{
+public:
+  virtual ~Executor() = default;
+
+  /**
+   * \brief Schedules a task for execution.
+   *
+   * \param task the task to execute. Must not throw.
+   */
+  virtual void execute(std::function<void()> task) = 0;
+};
+
+/**
+ * \brief An executor running tasks on a fixed number of worker threads.
+ *
+ * Tasks are executed in the order they were submitted. On destruction, the tasks that were already submitted are
+ * completed before the worker threads are joined.
+ */
+class ThreadPoolExecutor : public Executor
+{
+public:
+  /**
+   * \brief A constructor.
+   *
+   * \param thread_count number of worker threads (values less than 1 are treated as 1).
+   */
+  explicit ThreadPoolExecutor(std::size_t thread_count = 1);
+
+  /**
+   * \brief Completes the submitted tasks and joins the worker threads.
+   */
+  ~ThreadPoolExecutor();
+
+  ThreadPoolExecutor(ThreadPoolExecutor const&) = delete;
+  ThreadPoolExecutor& operator=(ThreadPoolExecutor const&) = delete;
+
+  void execute(std::function<void()> task) override;
+
+private:
+  void run();
+
+  std::mutex mutex_;
+  std::condition_variable task_available_;
+  std::deque<std::function<void()>> tasks_;
+  bool stopping_ = false;
+  std::vector<std::thread> threads_;
+};
+
+/**
+ * \brief An executor forwarding tasks to another executor, while keeping track of the tasks that have not finished.
+ *
+ * Lets an object whose tasks refer to it wait for them before it is destroyed, also when the other executor is shared
+ * with other objects.
+ */
+class TrackingExecutor : public Executor
+{
+public:
+  /**
+   * \brief A constructor.
+   *
+   * \param executor the executor running the tasks.
+   */
+  explicit TrackingExecutor(std::shared_ptr<Executor> executor);
+
+  TrackingExecutor(TrackingExecutor const&) = delete;
+  TrackingExecutor& operator=(TrackingExecutor const&) = delete;
+
+  void execute(std::function<void()> task) override;
+
+  /**
+   * \brief Waits until all submitted tasks have finished, including the tasks submitted by them while waiting.
+   *
+   * Must not be called from one of the tasks, which would wait for itself.
+   */
+  void wait();
+
+private:
+  /**
+   * \brief Called when a task has finished.
+   */
+  void finish();
+
+  std::shared_ptr<Executor> executor_;
+  std::mutex mutex_;
+  std::condition_variable finished_;
+  std::size_t pending_ = 0;
+};
+
+/**
+ * \brief Completion handler receiving the (ready) future of an asynchronous operation.
+ *
+ * Calling \a std::future::get() on the future returns the result, or rethrows the error, of the operation. The handler
+ * runs on the executor, so it must not block on other operations submitted to the same executor.
+ */
+template <typename T>
+using Completion = std::function<void(std::future<T>)>;
+
+/**
+ * \brief Runs a function on an executor.
+ *
+ * \param executor the executor.
+ * \param function the function to run.
+ *
+ * \return future of the function's result. Exceptions thrown by the function are stored in the future.
+ */
+template <typename F>
+std::future<std::invoke_result_t<std::decay_t<F>>> submit(Executor& executor, F&& function)
+{
+  using Result = std::invoke_result_t<std::decay_t<F>>;
+
+  auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(function));
+  auto future = task->get_future();
+  executor.execute([task] { (*task)(); });
+
+  return future;
+}
+
+/**
+ * \brief Runs a function on an executor and passes its result to a completion handler.
+ *
+ * \param executor the executor.
+ * \param function the function to run.
+ * \param completion the completion handler, called on the executor with the ready future of the function's result.
+ */
+template <typename F>
+void submit(Executor& executor, F&& function, Completion<std::invoke_result_t<std::decay_t<F>>> completion)
+{
+  using Result = std::invoke_result_t<std::decay_t<F>>;
+
+  executor.execute([function = std::forward<F>(function), completion = std::move(completion)]() mutable {
+    std::packaged_task<Result()> task{ std::move(function) };
+    auto future = task.get_future();
+    task();
+    completion(std::move(future));
+  });
+}
+}  // namespace abb::rws
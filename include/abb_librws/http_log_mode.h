@@ -0,0 +1,15 @@
+#pragma once
+
+
+namespace abb :: rws
+{
+  /**
+   * \brief An enumeration of HTTP communication logging modes.
+   */
+  enum class HTTPLogMode
+  {
+    OFF,      ///< \brief Nothing is logged.
+    METADATA, ///< \brief Request method and URI, response status and content sizes are logged.
+    FULL      ///< \brief As \a METADATA, plus the response content (up to a configurable size).
+  };
+}
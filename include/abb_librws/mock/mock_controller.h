@@ -0,0 +1,550 @@
+#pragma once
+
+#include <abb_librws/connection_options.h>
+#include <abb_librws/rws_rapid.h>
+#include <abb_librws/rws_resource.h>
+#include <abb_librws/common/rw/panel.h>
+#include <abb_librws/common/rw/rapid.h>
+
+#include <Poco/Net/HTTPServer.h>
+#include <Poco/Net/HTTPServerRequest.h>
+#include <Poco/Net/HTTPServerResponse.h>
+#include <Poco/ThreadPool.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace abb ::rws ::mock
+{
+/**
+ * \brief RWS protocol version served by a \a MockController.
+ */
+enum class RWSVersion
+{
+  V1_0,  ///< RWS 1.0 (IRC5, RobotWare 6).
+  V2_0   ///< RWS 2.0 (OmniCore, RobotWare 7).
+};
+
+/**
+ * \brief Options of a \a MockController.
+ */
+struct MockControllerOptions
+{
+  /**
+   * \brief Served RWS version. It selects the resource paths and XHTML class names of the responses.
+   */
+  RWSVersion version = RWSVersion::V2_0;
+
+  /**
+   * \brief Port to listen on (loopback interface only). 0 selects a free port.
+   */
+  Poco::UInt16 port = 0;
+
+  /**
+   * \brief Credentials accepted by the authentication.
+   */
+  std::string username = "Default User";
+  std::string password = "robotics";
+
+  /**
+   * \brief Whether the server asks for digest authentication (as RobotWare 6 does) instead of basic authentication.
+   */
+  bool digest_authentication = false;
+
+  /**
+   * \brief PEM certificate and private key files. If both are given, the server accepts HTTPS connections only.
+   */
+  std::string certificate_file;
+  std::string private_key_file;
+
+  /**
+   * \brief Delay added to every HTTP response.
+   */
+  std::chrono::microseconds latency{ 0 };
+
+  /**
+   * \brief Maximum random delay added on top of \a latency (uniformly distributed).
+   */
+  std::chrono::microseconds jitter{ 0 };
+
+  /**
+   * \brief Probability (0 to 1) that an HTTP request is answered by "503 Service Unavailable".
+   */
+  double service_unavailable_probability = 0.0;
+
+  /**
+   * \brief Number of events per second generated for each subscribed resource, reporting its current state.
+   *
+   * Events caused by state changes are sent regardless of this rate. 0 disables the generated events.
+   */
+  double event_rate = 0.0;
+
+  /**
+   * \brief Maximum number of pending events sent together in one WebSocket message.
+   */
+  std::size_t max_events_per_frame = 1;
+
+  /**
+   * \brief Maximum payload size of a WebSocket frame. Larger event messages are fragmented into continuation frames,
+   * with a ping interleaved after the first fragment. 0 disables the fragmentation.
+   */
+  std::size_t max_frame_size = 0;
+
+  /**
+   * \brief Maximum number of concurrent connections (each subscription WebSocket occupies one).
+   */
+  int max_connections = 16;
+
+  /**
+   * \brief Seed of the random generator used for the jitter and the error injection.
+   */
+  std::uint32_t seed = 0;
+};
+
+/**
+ * \brief A local stand-in for the RWS server of a robot controller.
+ *
+ * The mock serves the XHTML documents of the rapid, iosystem, panel, motionsystem, cfg, fileservice and
+ * subscription resources used by the library, over HTTP or HTTPS on the loopback interface, and pushes subscription
+ * events over WebSockets. Its state (IO signals, RAPID symbols and execution, panel, mechanical units, configuration
+ * and files) is kept in memory and can be inspected and changed through the methods below; changes made by either
+ * side produce subscription events.
+ *
+ * Response latency, jitter, "503 Service Unavailable" injection and event rates are configurable, so that the
+ * client can be exercised and measured reproducibly without a controller.
+ *
+ * All methods are thread-safe. The server is started by the constructor and stopped by the destructor.
+ */
+class MockController
+{
+public:
+  /**
+   * \brief A configuration instance, i.e. a name and a list of attribute (name, value) pairs.
+   */
+  struct CFGInstance
+  {
+    std::string name;
+    std::vector<std::pair<std::string, std::string>> attributes;
+  };
+
+  /**
+   * \brief Server counters.
+   */
+  struct Statistics
+  {
+    /**
+     * \brief Number of received HTTP requests (including WebSocket upgrades).
+     */
+    std::size_t requests = 0;
+
+    /**
+     * \brief Number of requests answered by an injected "503 Service Unavailable".
+     */
+    std::size_t service_unavailable = 0;
+
+    /**
+     * \brief Number of events sent to subscribers.
+     */
+    std::size_t events = 0;
+
+    /**
+     * \brief Number of WebSocket messages carrying events.
+     */
+    std::size_t frames = 0;
+
+    /**
+     * \brief Number of events dropped because a subscriber did not keep up.
+     */
+    std::size_t dropped_events = 0;
+
+    /**
+     * \brief Number of requests answered by "401 Unauthorized", i.e. by an authentication challenge.
+     */
+    std::size_t unauthorized = 0;
+  };
+
+  /**
+   * \brief A constructor. Starts the server.
+   *
+   * \param options the mock's options.
+   *
+   * \throw \a Poco::Exception if the server cannot be started.
+   */
+  explicit MockController(MockControllerOptions const& options = MockControllerOptions{});
+
+  /**
+   * \brief A destructor. Stops the server and closes all connections.
+   */
+  ~MockController();
+
+  MockController(MockController const&) = delete;
+  MockController& operator=(MockController const&) = delete;
+
+  /**
+   * \brief The port the server listens on.
+   */
+  Poco::UInt16 port() const;
+
+  /**
+   * \brief Connection options for a client of the mock.
+   */
+  ConnectionOptions connectionOptions() const;
+
+  /**
+   * \brief Changes the response delay.
+   *
+   * \param latency delay added to every HTTP response.
+   * \param jitter maximum random delay added on top of the latency.
+   */
+  void setLatency(std::chrono::microseconds latency, std::chrono::microseconds jitter = std::chrono::microseconds{ 0 });
+
+  /**
+   * \brief Changes the probability that an HTTP request is answered by "503 Service Unavailable".
+   */
+  void setServiceUnavailableProbability(double probability);
+
+  /**
+   * \brief Changes the number of events per second generated for each subscribed resource.
+   */
+  void setEventRate(double rate);
+
+  /**
+   * \brief Makes the digest authentication nonces issued so far stale, as a controller does after a while.
+   *
+   * Existing sessions stay valid. Credentials using an old nonce are answered by a new challenge marked as stale.
+   */
+  void expireNonces();
+
+  /**
+   * \brief Sends an event item to all subscribers, between two events of each of their subscribed resources.
+   *
+   * Simulates an event the clients cannot decode, e.g. of a resource type they do not support. The items are queued
+   * together, so they are sent in one message if \a MockControllerOptions::max_events_per_frame allows.
+   *
+   * \param item the XHTML list item, e.g. "<li class=\"unknown-ev\"><a href=\"/rw/unknown\"/></li>".
+   */
+  void injectEventItem(std::string const& item);
+
+  /**
+   * \brief Creates or changes an IO signal.
+   *
+   * \param name the signal name (as used in the resource URI).
+   * \param value the signal's logical value.
+   * \param type the signal type ("DI", "DO", "AI", "AO", "GI" or "GO").
+   */
+  void setIOSignal(std::string const& name, std::string const& value, std::string const& type = "DO");
+
+  /**
+   * \brief Retrieves the logical value of an IO signal, if it exists.
+   */
+  std::optional<std::string> getIOSignal(std::string const& name) const;
+
+  /**
+   * \brief Creates or changes a RAPID symbol. The task and module are created if needed.
+   *
+   * \param resource the symbol's task, module and name.
+   * \param value the symbol's value in RAPID text format.
+   * \param data_type the symbol's RAPID data type.
+   */
+  void setRAPIDSymbol(RAPIDResource const& resource, std::string const& value, std::string const& data_type);
+
+  /**
+   * \brief Changes the value of a RAPID symbol, or creates it with the type of \a value.
+   */
+  void setRAPIDSymbol(RAPIDResource const& resource, RAPIDSymbolDataAbstract const& value);
+
+  /**
+   * \brief Creates or changes a one-dimensional RAPID array symbol, sized by the number of elements in \a value.
+   *
+   * The symbol's elements can then also be addressed individually, as e.g. "reg{3}".
+   */
+  void setRAPIDArraySymbol(RAPIDResource const& resource, RAPIDSymbolDataAbstract const& value);
+
+  /**
+   * \brief Declares a user-defined RAPID record type, whose layout can then be discovered by the clients.
+   *
+   * Symbols of the type are created with setRAPIDSymbol(), using the type's name as data type.
+   *
+   * \param type the type's task, module and name.
+   * \param components the names and data types of the record components, in declaration order.
+   */
+  void setRAPIDRecordType(RAPIDResource const& type,
+                          std::vector<std::pair<std::string, std::string>> const& components);
+
+  /**
+   * \brief Retrieves the value of a RAPID symbol in RAPID text format, if it exists.
+   */
+  std::optional<std::string> getRAPIDSymbol(RAPIDResource const& resource) const;
+
+  void setRAPIDExecutionState(rw::RAPIDExecutionState state);
+  rw::RAPIDExecutionState getRAPIDExecutionState() const;
+
+  void setControllerState(rw::ControllerState state);
+  rw::ControllerState getControllerState() const;
+
+  void setOperationMode(rw::OperationMode mode);
+  rw::OperationMode getOperationMode() const;
+
+  /**
+   * \brief Changes the joint target reported for a mechanical unit. The unit is created if needed.
+   */
+  void setJointTarget(std::string const& mechunit, JointTarget const& value);
+
+  /**
+   * \brief Changes the robot target reported for a mechanical unit (in any coordinate system).
+   */
+  void setRobTarget(std::string const& mechunit, RobTarget const& value);
+
+  /**
+   * \brief Replaces the instances of a configuration type.
+   *
+   * \param topic the configuration topic, e.g. "MOC".
+   * \param type the configuration type, e.g. "ARM".
+   * \param instances the new instances.
+   */
+  void setCFGInstances(std::string const& topic, std::string const& type, std::vector<CFGInstance> instances);
+
+  /**
+   * \brief Creates or replaces a file of the file service.
+   *
+   * \param path the file path below "/fileservice/", e.g. "$home/module.mod".
+   * \param content the file content.
+   */
+  void setFile(std::string const& path, std::string const& content);
+
+  /**
+   * \brief Retrieves the content of a file of the file service, if it exists.
+   */
+  std::optional<std::string> getFile(std::string const& path) const;
+
+  /**
+   * \brief Retrieves the server counters.
+   */
+  Statistics getStatistics() const noexcept;
+
+  /**
+   * \brief Number of open subscription groups.
+   */
+  std::size_t subscriptionCount() const;
+
+private:
+  class RequestHandler;
+  class RequestHandlerFactory;
+
+  /**
+   * \brief Kinds of subscribable resources.
+   */
+  enum class ResourceKind
+  {
+    IO_SIGNAL,
+    RAPID_SYMBOL,
+    RAPID_EXECUTION,
+    CONTROLLER_STATE,
+    OPERATION_MODE
+  };
+
+  /**
+   * \brief A subscribed resource.
+   */
+  struct Subscription
+  {
+    /**
+     * \brief Resource URI, as given by the subscriber.
+     */
+    std::string uri;
+
+    ResourceKind kind;
+
+    /**
+     * \brief Signal name or "task/module/symbol" path; empty for the other resources.
+     */
+    std::string key;
+  };
+
+  /**
+   * \brief A subscription group and its pending events.
+   */
+  struct SubscriptionGroup
+  {
+    std::vector<Subscription> resources;
+    std::deque<std::string> pending_events;
+    std::condition_variable event_available;
+    bool closed = false;
+  };
+
+  struct IOSignal
+  {
+    std::string type;
+    std::string value;
+  };
+
+  struct RAPIDSymbol
+  {
+    std::string data_type;
+    std::string value;
+
+    /**
+     * \brief Size of each dimension, if the symbol is an array.
+     */
+    std::vector<std::size_t> dimensions;
+  };
+
+  struct MechanicalUnit
+  {
+    std::vector<std::pair<std::string, std::string>> jointtarget;
+    std::vector<std::pair<std::string, std::string>> robtarget;
+  };
+
+  /**
+   * \brief Maximum number of pending events per subscription group. Older events are dropped.
+   */
+  static constexpr std::size_t MAX_PENDING_EVENTS = 4096;
+
+  /**
+   * \brief Handles one HTTP request.
+   */
+  void handleRequest(Poco::Net::HTTPServerRequest& request, Poco::Net::HTTPServerResponse& response);
+
+  /**
+   * \brief Checks the session cookie or the credentials of a request, and starts a session if needed.
+   *
+   * \return true if the request is authorized; otherwise a "401 Unauthorized" response has been sent.
+   */
+  bool authorize(Poco::Net::HTTPServerRequest& request, Poco::Net::HTTPServerResponse& response);
+
+  void handleSystem(std::string const& method, std::string const& path, Poco::Net::HTTPServerResponse& response);
+  void handleIOSystem(std::string const& method, std::string const& path, std::string const& action,
+                      std::string const& body, Poco::Net::HTTPServerResponse& response);
+  void handleRAPID(std::string const& method, std::string const& path, std::string const& action,
+                   std::map<std::string, std::string> const& query, std::string const& body,
+                   Poco::Net::HTTPServerResponse& response);
+  void handlePanel(std::string const& method, std::string const& path, std::string const& body,
+                   Poco::Net::HTTPServerResponse& response);
+  void handleMotionSystem(std::string const& method, std::string const& path,
+                          std::map<std::string, std::string> const& query, Poco::Net::HTTPServerResponse& response);
+  void handleCFG(std::string const& method, std::string const& path, Poco::Net::HTTPServerResponse& response);
+  void handleFileService(std::string const& method, std::string const& path, std::string const& body,
+                         Poco::Net::HTTPServerResponse& response);
+  void handleSubscription(std::string const& method, std::string const& path, std::string const& body,
+                          Poco::Net::HTTPServerResponse& response);
+
+  /**
+   * \brief Serves the WebSocket of a subscription group until it is closed.
+   */
+  void handlePoll(std::string const& group_id, Poco::Net::HTTPServerRequest& request,
+                  Poco::Net::HTTPServerResponse& response);
+
+  /**
+   * \brief Queues events for all subscriptions of a resource. The caller must hold \a mutex_.
+   */
+  void notify(ResourceKind kind, std::string const& key);
+
+  /**
+   * \brief Renders the event item of a subscribed resource from the current state. The caller must hold \a mutex_.
+   */
+  std::string eventItem(Subscription const& subscription) const;
+
+  /**
+   * \brief Retrieves the URL of a RAPID data type, as seen from a task: the URL of a record type declared in the task,
+   * or else the URL of a built-in type. The caller must hold \a mutex_.
+   */
+  std::string rapidTypeURL(std::string const& task, std::string const& data_type) const;
+
+  /**
+   * \brief Queues an event item for a subscription group. The caller must hold \a mutex_.
+   */
+  void queueEvent(SubscriptionGroup& group, std::string item);
+
+  /**
+   * \brief Body of the thread generating events at the configured rate.
+   */
+  void generateEvents();
+
+  /**
+   * \brief Waits for the configured latency and jitter.
+   */
+  void delay();
+
+  /**
+   * \brief Decides if a request is answered by an injected "503 Service Unavailable".
+   */
+  bool injectServiceUnavailable();
+
+  /**
+   * \brief Base URI of the server, e.g. "http://127.0.0.1:8080/".
+   */
+  std::string baseURI() const;
+
+  /**
+   * \brief Content type of the XHTML responses.
+   */
+  std::string xhtmlContentType() const;
+
+  /**
+   * \brief Wraps list items into an RWS XHTML document.
+   */
+  std::string document(std::string const& title, std::string const& items) const;
+
+  bool isVersion1() const noexcept
+  {
+    return options_.version == RWSVersion::V1_0;
+  }
+
+  MockControllerOptions const options_;
+
+  std::atomic<std::chrono::microseconds::rep> latency_;
+  std::atomic<std::chrono::microseconds::rep> jitter_;
+  std::atomic<double> service_unavailable_probability_;
+  std::atomic<double> event_rate_;
+
+  std::mutex random_mutex_;
+  std::mt19937 random_;
+
+  mutable std::mutex mutex_;
+  std::set<std::string> sessions_;
+  std::size_t next_session_id_ = 1;
+  std::set<std::string> nonces_;
+  std::size_t next_nonce_ = 1;
+  std::map<std::string, IOSignal> io_signals_;
+  std::map<std::string, RAPIDSymbol> rapid_symbols_;
+  std::map<std::string, std::vector<std::pair<std::string, std::string>>> rapid_record_types_;
+  std::map<std::string, std::set<std::string>> rapid_modules_;
+  rw::RAPIDExecutionState rapid_execution_state_ = rw::RAPIDExecutionState::stopped;
+  rw::ControllerState controller_state_ = rw::ControllerState::motorOff;
+  rw::OperationMode operation_mode_ = rw::OperationMode::automatic;
+  unsigned speed_ratio_ = 100;
+  std::map<std::string, MechanicalUnit> mechanical_units_;
+  std::map<std::string, std::vector<CFGInstance>> cfg_instances_;
+  std::map<std::string, std::string> files_;
+  std::map<std::string, std::shared_ptr<SubscriptionGroup>> subscription_groups_;
+  std::size_t next_subscription_group_id_ = 1;
+  bool stopping_ = false;
+  std::condition_variable generator_wakeup_;
+
+  std::atomic<std::size_t> requests_{ 0 };
+  std::atomic<std::size_t> service_unavailable_{ 0 };
+  std::atomic<std::size_t> events_{ 0 };
+  std::atomic<std::size_t> frames_{ 0 };
+  std::atomic<std::size_t> dropped_events_{ 0 };
+  std::atomic<std::size_t> unauthorized_{ 0 };
+
+  Poco::ThreadPool thread_pool_;
+  Poco::UInt16 port_ = 0;
+  std::unique_ptr<Poco::Net::HTTPServer> server_;
+  std::thread generator_;
+};
+}  // namespace abb::rws::mock
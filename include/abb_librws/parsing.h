@@ -5,7 +5,13 @@
 #include <Poco/DOM/Document.h>
 #include <Poco/DOM/AutoPtr.h>
 
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 
@@ -63,6 +69,55 @@ namespace abb :: rws
    */
   std::string xmlFindTextContent(const Poco::XML::Node* p_node, const XMLAttribute& attribute);
 
+  /**
+   * \brief A query for the text content of several XML nodes, which are all found in a single traversal.
+   *
+   * It replaces repeated \a xmlFindTextContent calls on the same document, each of which restarts from the root.
+   * A query does not change once constructed, so it can be built once and shared between threads.
+   */
+  class XMLTextContentQuery
+  {
+  public:
+    /**
+     * \brief A constructor.
+     *
+     * \param attributes specifying the XML attributes (name and value) that the XML text nodes' parents should have.
+     */
+    XMLTextContentQuery(std::initializer_list<XMLAttribute> attributes);
+
+    /**
+     * \brief Finds the text content for all of the query's attributes, in a single traversal that stops as soon as
+     * all of them have been found.
+     *
+     * \param p_root for the root node to search (including the root itself).
+     *
+     * \return std::vector<std::string> with the text content for each attribute, in the order the attributes were
+     * given to the constructor. Empty for attributes that were not found.
+     */
+    std::vector<std::string> find(const Poco::XML::Node* p_root) const;
+
+    /**
+     * \brief Finds the text content for all of the query's attributes in an XML document.
+     *
+     * \param p_xml_document for the XML document to search.
+     *
+     * \return std::vector<std::string> with the text content for each attribute, in the order the attributes were
+     * given to the constructor. Empty for attributes that were not found.
+     */
+    std::vector<std::string> find(Poco::AutoPtr<Poco::XML::Document> p_xml_document) const;
+
+  private:
+    /**
+     * \brief Number of attributes in the query.
+     */
+    std::size_t size_;
+
+    /**
+     * \brief Indices of the query's attributes, by attribute name and then by attribute value.
+     */
+    std::vector<std::pair<std::string, std::unordered_multimap<std::string, std::size_t>>> index_;
+  };
+
   /**
    * \brief A function for getting an XML node's attribute value.
    *
@@ -94,6 +149,62 @@ namespace abb :: rws
    */
   bool xmlNodeHasAttribute(const Poco::XML::Node* p_node, const std::string& name, const std::string& value);
 
+  /**
+   * \brief Specification of the records and fields that are extracted by \a xmlExtract.
+   */
+  struct XMLExtractQuery
+  {
+    /**
+     * \brief Attribute (name and value) of the elements that delimit a record, e.g. class="ios-signal-li".
+     */
+    XMLAttribute record;
+
+    /**
+     * \brief Name of the attribute that holds the key of a field inside a record, e.g. "class" or "title".
+     */
+    std::string key_attribute;
+
+    /**
+     * \brief Keys of the fields to extract. All fields of a record are extracted if empty.
+     */
+    std::vector<std::string> keys;
+
+    /**
+     * \brief Attribute (name and value) that field elements must also have, e.g. class="cfg-ia-t-li". Any element
+     * with a key attribute is a field if empty.
+     */
+    XMLAttribute field;
+  };
+
+  /**
+   * \brief Callback for an extracted field, receiving the field's key and text content.
+   */
+  using XMLFieldCallback = std::function<void(std::string const& key, std::string const& text)>;
+
+  /**
+   * \brief Callback for the end of a record, receiving the value of the record element's key attribute.
+   */
+  using XMLRecordCallback = std::function<void(std::string const& key)>;
+
+  /**
+   * \brief A function for extracting fields from an XML document in a single streaming (SAX) pass.
+   *
+   * No DOM is built, so only the requested text is kept in memory. Every element that has the query's record
+   * attribute starts a record. Inside a record, an element whose key attribute holds one of the requested keys (and
+   * that has the query's field attribute, if given) is a field. Its text content, including the text of its
+   * descendants and with surrounding whitespace removed, is passed to \a on_field when the element ends. Fields are
+   * reported in document order.
+   *
+   * \param xml_string XML document as a string.
+   * \param query specifying the records and fields to extract.
+   * \param on_field called for each extracted field.
+   * \param on_record called at the end of each record (optional).
+   *
+   * \throw \a Poco::XML::SAXParseException if the document is not well-formed.
+   */
+  void xmlExtract(std::string const& xml_string, XMLExtractQuery const& query, XMLFieldCallback const& on_field,
+                  XMLRecordCallback const& on_record = {});
+
 
   /**
    * \brief A function for retrieving a substring in a string.
@@ -116,7 +227,7 @@ namespace abb :: rws
    *
    * \return unsigned int containing the number of times the character occurs.
    */
-  unsigned int countCharInString(std::string input, const char character);
+  unsigned int countCharInString(const std::string& input, const char character);
 
   /**
    * \brief A method to extract delimited substrings in a string.
@@ -132,4 +243,23 @@ namespace abb :: rws
                                                      const char start_delimiter,
                                                      const char end_delimiter,
                                                      const char separator);
+
+  /**
+   * \brief A method to split a delimited string into its top-level substrings, in a single pass.
+   *
+   * The outermost delimiters are removed and the remaining string is split at every separator which is neither
+   * nested inside delimiters nor inside a double-quoted string. Whitespace around the substrings is removed and
+   * empty substrings are skipped. E.g. "[[1,2],\"a,b\",3]" is split into "[1,2]", "\"a,b\"" and "3".
+   *
+   * \param input containing the string with delimited substrings.
+   * \param start_delimiter delimiter of the start of the string from which to extract the substrings
+   * \param end_delimiter delimiter of the end of the string from which to extract the substrings
+   * \param separator seperator that is found between 2 substrings that should be extracted
+   *
+   * \return std::vector<std::string_view> with views into \a input (no characters are copied).
+   */
+  std::vector<std::string_view> splitDelimitedSubstrings(std::string_view input,
+                                                         const char start_delimiter,
+                                                         const char end_delimiter,
+                                                         const char separator);
 }
\ No newline at end of file
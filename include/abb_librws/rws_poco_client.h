@@ -37,15 +37,18 @@
 #ifndef RWS_POCO_CLIENT_H
 #define RWS_POCO_CLIENT_H
 
+#include <abb_librws/rws_poco_log.h>
 #include <abb_librws/rws_poco_result.h>
+#include <abb_librws/rws_poco_session_pool.h>
+#include <abb_librws/rws_request_metrics.h>
 
 #include <Poco/Net/HTTPClientSession.h>
 #include <Poco/Net/HTTPCredentials.h>
 #include <Poco/Net/HTTPResponse.h>
 #include <Poco/Net/WebSocket.h>
 
-#include <deque>
-#include <optional>
+#include <memory>
+#include <mutex>
 
 namespace abb
 {
@@ -53,6 +56,9 @@ namespace rws
 {
 /**
  * \brief A class for a simple client based on POCO.
+ *
+ * The client is thread-safe. Requests are sent over a pool of keep-alive sessions, so that up to the pool size
+ * requests can be in flight concurrently. Cookies and credentials are shared by all sessions.
  */
 class POCOClient
 {
@@ -61,12 +67,25 @@ public:
    * \brief A constructor.
    *
    * \param session HTTP session. This can be either an HTTPClientSession or an HTTPSClientSession,
-   *  depending on which protocol should be used.
+   *  depending on which protocol should be used. Requests are serialized over this single session.
    * \param username for the username to the remote server's authentication process.
    * \param password for the password to the remote server's authentication process.
    */
   POCOClient(Poco::Net::HTTPClientSession& session, const std::string& username, const std::string& password);
 
+  /**
+   * \brief A constructor.
+   *
+   * \param session_factory function creating new HTTP sessions. The sessions can be either HTTPClientSession or
+   *  HTTPSClientSession objects, depending on which protocol should be used.
+   * \param username for the username to the remote server's authentication process.
+   * \param password for the password to the remote server's authentication process.
+   * \param session_pool_size maximum number of concurrently open sessions.
+   * \param session_metrics indicating if per-session statistics should be collected.
+   */
+  POCOClient(POCOSessionPool::SessionFactory session_factory, const std::string& username,
+             const std::string& password, std::size_t session_pool_size = 1, bool session_metrics = false);
+
   /**
    * \brief A destructor.
    */
@@ -112,10 +131,26 @@ public:
    */
   POCOResult httpDelete(const std::string& uri);
 
+  /**
+   * \brief A method for setting the HTTP communication timeout of all pooled sessions.
+   *
+   * \note This method resets the pooled sessions.
+   *
+   * \param timeout for the HTTP communication timeout [microseconds].
+   */
   void setTimeout(const Poco::Int64 timeout)
   {
-    http_client_session_.setTimeout(Poco::Timespan(timeout));
-    http_client_session_.reset();
+    session_pool_.setTimeout(Poco::Timespan(timeout));
+  }
+
+  /**
+   * \brief Retrieves usage statistics of the pooled sessions.
+   *
+   * \return statistics for each created session. Empty if session metrics are disabled.
+   */
+  std::vector<POCOSessionPool::SessionStatistics> getSessionStatistics() const
+  {
+    return session_pool_.getStatistics();
   }
 
   /**
@@ -149,91 +184,34 @@ public:
    */
   std::string getLogTextLatestEvent(bool verbose = false) const;
 
-private:
   /**
-   * \brief A struct for containing HTTP info.
+   * \brief Method for changing the logging mode of the internal log.
+   *
+   * \param mode logging mode. Logging is disabled by default.
+   * \param content_limit maximum number of response content bytes logged per request in \a HTTPLogMode::FULL.
+   */
+  void setLogMode(HTTPLogMode mode, std::size_t content_limit = 4096)
+  {
+    log_.setMode(mode, content_limit);
+  }
+
+  /**
+   * \brief Per-request latency metrics and error counters. Disabled by default.
    */
-  struct HTTPInfo
+  RequestMetrics& metrics() noexcept
   {
-    /**
-     * \brief A struct for containing HTTP request info.
-     */
-    struct RequestInfo
-    {
-      /**
-       * \brief Method used for the request.
-       */
-      std::string method;
-
-      /**
-       * \brief URI used for the request.
-       */
-      std::string uri;
-
-      /**
-       * \brief Content used for the request.
-       */
-      std::string content;
-    };
-
-    /**
-     * \brief A struct for containing HTTP response info.
-     */
-    struct ResponseInfo
-    {
-      /**
-       * \brief Response status.
-       */
-      Poco::Net::HTTPResponse::HTTPStatus status;
-
-      /**
-       * \brief Response header info.
-       */
-      std::string header_info;
-
-      /**
-       * \brief Response content.
-       */
-      std::string content;
-    };
-
-    /**
-     * \brief Info about a HTTP request.
-     */
-    std::optional<RequestInfo> request;
-
-    /**
-     * \brief Info about a HTTP response.
-     */
-    std::optional<ResponseInfo> response;
-
-    /**
-     * \brief A method for adding info from a HTTP request.
-     *
-     * \param request for the HTTP request.
-     * \param request_content for the HTTP request's content.
-     */
-    void addHTTPRequestInfo(const Poco::Net::HTTPRequest& request, const std::string& request_content = "");
-
-    /**
-     * \brief A method for adding info from a HTTP response.
-     *
-     * \param response for the HTTP response.
-     * \param response_content for the HTTP response's content.
-     */
-    void addHTTPResponseInfo(const Poco::Net::HTTPResponse& response, const std::string& response_content = "");
-
-    /**
-     * \brief A method to construct a text representation of the result.
-     *
-     * \param verbose indicating if the log text should be verbose or not.
-     * \param indent for indentation.
-     *
-     * \return std::string containing the text representation.
-     */
-    std::string toString(bool verbose = false, size_t indent = 0) const;
-  };
+    return request_metrics_;
+  }
+
+  /**
+   * \brief Per-request latency metrics and error counters. Disabled by default.
+   */
+  RequestMetrics const& metrics() const noexcept
+  {
+    return request_metrics_;
+  }
 
+private:
   /**
    * \brief A method for making a HTTP request.
    *
@@ -249,56 +227,113 @@ private:
   /**
    * \brief A method for sending and receiving HTTP messages.
    *
+   * \param session for the HTTP session to use.
    * \param request for the HTTP request.
    * \param response for the HTTP response.
    * \param request_content for the request's content.
-   * \param response_content for the response content.
+   * \param response_content for storing the response content, which is read once and not copied afterwards.
    */
-  void sendAndReceive(Poco::Net::HTTPRequest& request, Poco::Net::HTTPResponse& response,
-                      const std::string& request_content, std::string& response_content);
+  void sendAndReceive(Poco::Net::HTTPClientSession& session, Poco::Net::HTTPRequest& request,
+                      Poco::Net::HTTPResponse& response, const std::string& request_content,
+                      std::shared_ptr<std::string const>& response_content);
 
   /**
    * \brief A method for performing authentication.
    *
+   * \param session for the HTTP session to use.
    * \param request for the HTTP request.
    * \param response for the HTTP response.
    * \param request_content for the request's content.
    * \param response_content for the response content.
    */
-  void authenticate(Poco::Net::HTTPRequest& request, Poco::Net::HTTPResponse& response,
-                    const std::string& request_content, std::string& response_content);
+  void authenticate(Poco::Net::HTTPClientSession& session, Poco::Net::HTTPRequest& request,
+                    Poco::Net::HTTPResponse& response, const std::string& request_content,
+                    std::shared_ptr<std::string const>& response_content);
+
+  /**
+   * \brief A method for adding credentials to a request without waiting for the server's challenge.
+   *
+   * Credentials are only added if there is no session cookie to authenticate the request, and if a previous
+   * authentication has succeeded. The authentication scheme (and digest nonce) of that authentication is reused.
+   *
+   * \param request for the HTTP request.
+   *
+   * \return true if credentials were added.
+   */
+  bool addPreemptiveCredentials(Poco::Net::HTTPRequest& request);
+
+  /**
+   * \brief A method for storing the cookies received in a response.
+   *
+   * \param response for the HTTP response.
+   */
+  void storeCookies(const Poco::Net::HTTPResponse& response);
+
+  /**
+   * \brief A method for retrieving a copy of the stored cookies.
+   *
+   * \return the stored cookies.
+   */
+  Poco::Net::NameValueCollection getCookies() const;
+
+  /**
+   * \brief A method for clearing the stored cookies.
+   */
+  void clearCookies();
 
   /**
    * \brief A method for extracting and storing information from a cookie string.
    *
+   * \note The caller must hold \a cookies_mutex_.
+   *
    * \param cookie_string for the cookie string.
    */
   void extractAndStoreCookie(const std::string& cookie_string);
 
   /**
-   * \brief A HTTP client session.
+   * \brief Pool of HTTP client sessions.
    */
-  Poco::Net::HTTPClientSession& http_client_session_;
+  POCOSessionPool session_pool_;
 
   /**
    * \brief HTTP credentials for the remote server's access authentication process.
    */
   Poco::Net::HTTPCredentials http_credentials_;
 
+  /**
+   * \brief Authorization header value of the last successful authentication. Empty if not authenticated.
+   */
+  std::string authorization_;
+
+  /**
+   * \brief Mutex protecting the credentials and the authorization.
+   */
+  std::mutex credentials_mutex_;
+
   /**
    * \brief A container for cookies received from a server.
    */
   Poco::Net::NameValueCollection cookies_;
 
   /**
-   * \brief Static constant for the log's size.
+   * \brief Mutex protecting the cookies.
+   */
+  mutable std::mutex cookies_mutex_;
+
+  /**
+   * \brief Upper limit for preallocating response content from the Content-Length header [bytes].
+   */
+  static constexpr Poco::Int64 MAX_CONTENT_RESERVE = 16 * 1024 * 1024;
+
+  /**
+   * \brief Log of the communication.
    */
-  static const size_t LOG_SIZE = 20;
+  POCOLog log_;
 
   /**
-   * \brief Container for logging communication results.
+   * \brief Latency metrics of the communication.
    */
-  std::deque<HTTPInfo> log_;
+  RequestMetrics request_metrics_;
 };
 }  // end namespace rws
 }  // end namespace abb
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <abb_librws/http_log_mode.h>
+
+#include <Poco/Net/HTTPRequest.h>
+#include <Poco/Net/HTTPResponse.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace abb ::rws
+{
+/**
+ * \brief A bounded log of HTTP communication.
+ *
+ * The log is a preallocated ring buffer holding the most recent \a CAPACITY exchanges. Entries are overwritten in
+ * place, reusing their string buffers, and nothing is formatted until the log text is requested. When the mode is
+ * \a HTTPLogMode::OFF, adding an entry costs a single atomic load.
+ */
+class POCOLog
+{
+public:
+  /**
+   * \brief Maximum number of logged exchanges.
+   */
+  static constexpr std::size_t CAPACITY = 20;
+
+  /**
+   * \brief A constructor.
+   *
+   * \param mode logging mode.
+   * \param content_limit maximum number of response content bytes logged per exchange in \a HTTPLogMode::FULL.
+   */
+  explicit POCOLog(HTTPLogMode mode = HTTPLogMode::OFF, std::size_t content_limit = 4096);
+
+  /**
+   * \brief Changes the logging mode. Already logged exchanges are kept.
+   *
+   * \param mode logging mode.
+   * \param content_limit maximum number of response content bytes logged per exchange in \a HTTPLogMode::FULL.
+   */
+  void setMode(HTTPLogMode mode, std::size_t content_limit);
+
+  /**
+   * \brief Current logging mode.
+   */
+  HTTPLogMode mode() const noexcept
+  {
+    return mode_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Logs an HTTP exchange.
+   *
+   * \param request the HTTP request.
+   * \param request_content the request's content.
+   * \param response the HTTP response.
+   * \param response_content the response's content. Shared (not copied) if it fits within the content limit.
+   */
+  void add(Poco::Net::HTTPRequest const& request, std::string const& request_content,
+           Poco::Net::HTTPResponse const& response, std::shared_ptr<std::string const> const& response_content);
+
+  /**
+   * \brief Removes all logged exchanges.
+   */
+  void clear();
+
+  /**
+   * \brief Method for retrieving the log as a text string, most recent exchange first.
+   *
+   * \param verbose indicating if the log text should be verbose or not.
+   *
+   * \return std::string containing the log text. An empty text string is returned if the log is empty.
+   */
+  std::string getText(bool verbose = false) const;
+
+  /**
+   * \brief Method for retrieving only the most recently logged exchange as a text string.
+   *
+   * \param verbose indicating if the log text should be verbose or not.
+   *
+   * \return std::string containing the log text. An empty text string is returned if the log is empty.
+   */
+  std::string getTextLatestEvent(bool verbose = false) const;
+
+private:
+  /**
+   * \brief A logged HTTP exchange.
+   */
+  struct Entry
+  {
+    std::string method;
+    std::string uri;
+    std::size_t request_content_size = 0;
+    Poco::Net::HTTPResponse::HTTPStatus status = Poco::Net::HTTPResponse::HTTP_OK;
+    std::size_t response_content_size = 0;
+
+    /**
+     * \brief Response content, if it fits within the content limit.
+     */
+    std::shared_ptr<std::string const> response_content;
+
+    /**
+     * \brief Beginning of the response content, if it exceeds the content limit.
+     */
+    std::string response_content_prefix;
+
+    /**
+     * \brief Indicates if the response content has been logged.
+     */
+    bool has_content = false;
+
+    /**
+     * \brief A method to construct a text representation of the entry.
+     *
+     * \param verbose indicating if the log text should be verbose or not.
+     * \param indent for indentation.
+     *
+     * \return std::string containing the text representation.
+     */
+    std::string toString(bool verbose, std::size_t indent) const;
+  };
+
+  /**
+   * \brief The i-th most recent entry. The caller must hold \a mutex_.
+   */
+  Entry const& recent(std::size_t i) const noexcept
+  {
+    return entries_[(next_ + CAPACITY - 1 - i) % CAPACITY];
+  }
+
+  std::atomic<HTTPLogMode> mode_;
+  std::size_t content_limit_;
+
+  mutable std::mutex mutex_;
+  std::array<Entry, CAPACITY> entries_;
+
+  /**
+   * \brief Index of the entry to overwrite next.
+   */
+  std::size_t next_ = 0;
+
+  /**
+   * \brief Number of valid entries.
+   */
+  std::size_t size_ = 0;
+};
+}  // namespace abb::rws
@@ -2,18 +2,33 @@
 
 #include <Poco/Net/HTTPResponse.h>
 
+#include <memory>
 #include <string>
 
 namespace abb ::rws
 {
 /**
  * \brief A struct for containing the result of a communication.
+ *
+ * The result shares the received response and its content with the client's log and other copies of the result,
+ * so copying a result does not copy the response body or headers.
  */
 struct POCOResult
 {
   /**
    * \brief A constructor.
    *
+   * \param response the received HTTP response (status, reason and header info).
+   * \param content HTTP response content.
+   * \param method method of the HTTP request.
+   * \param uri URI of the HTTP request.
+   */
+  POCOResult(std::shared_ptr<Poco::Net::HTTPResponse const> response, std::shared_ptr<std::string const> content,
+             std::string method = "", std::string uri = "");
+
+  /**
+   * \brief A constructor copying the response data.
+   *
    * \param http_status HTTP response status
    * \param reason HTTP reason phrase
    * \param header_info HTTP response header info
@@ -27,7 +42,7 @@ struct POCOResult
    */
   Poco::Net::HTTPResponse::HTTPStatus httpStatus() const noexcept
   {
-    return httpStatus_;
+    return response_->getStatus();
   }
 
   /**
@@ -35,29 +50,55 @@ struct POCOResult
    */
   std::string const& reason() const noexcept
   {
-    return reason_;
+    return response_->getReason();
   }
 
   /**
    * \brief HTTP response header info.
+   *
+   * The headers are not copied; the returned collection refers to the received response.
    */
-  auto const& headerInfo() const noexcept
+  Poco::Net::NameValueCollection const& headerInfo() const noexcept
   {
-    return headerInfo_;
+    return *response_;
   }
 
   /**
    * \brief Content of the HTTP response.
    */
   std::string const& content() const noexcept
+  {
+    return *content_;
+  }
+
+  /**
+   * \brief Shared content of the HTTP response, for keeping the content alive without copying it.
+   */
+  std::shared_ptr<std::string const> const& sharedContent() const noexcept
   {
     return content_;
   }
 
+  /**
+   * \brief Method of the HTTP request.
+   */
+  std::string const& method() const noexcept
+  {
+    return method_;
+  }
+
+  /**
+   * \brief URI of the HTTP request.
+   */
+  std::string const& uri() const noexcept
+  {
+    return uri_;
+  }
+
 private:
-  Poco::Net::HTTPResponse::HTTPStatus httpStatus_;
-  std::string reason_;
-  std::vector<std::pair<std::string, std::string>> headerInfo_;
-  std::string content_;
+  std::shared_ptr<Poco::Net::HTTPResponse const> response_;
+  std::shared_ptr<std::string const> content_;
+  std::string method_;
+  std::string uri_;
 };
-}  // namespace abb::rws
\ No newline at end of file
+}  // namespace abb::rws
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <Poco/Net/HTTPClientSession.h>
+#include <Poco/Timespan.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace abb ::rws
+{
+/**
+ * \brief A thread-safe pool of keep-alive HTTP client sessions.
+ *
+ * Sessions are created lazily by a user-supplied factory, up to the configured pool size. A thread that needs to
+ * communicate with the server acquires a \a Lease, which grants exclusive use of one session until the lease is
+ * destroyed. If all sessions are in use, \a acquire() blocks until one is returned to the pool.
+ */
+class POCOSessionPool
+{
+public:
+  /**
+   * \brief Function creating a new (not yet connected) HTTP session.
+   */
+  using SessionFactory = std::function<std::unique_ptr<Poco::Net::HTTPClientSession>()>;
+
+  /**
+   * \brief Usage statistics of a single pooled session.
+   */
+  struct SessionStatistics
+  {
+    /**
+     * \brief Number of times the session has been leased.
+     */
+    std::size_t requests = 0;
+
+    /**
+     * \brief Number of times the session has been reset (i.e. the connection was dropped).
+     */
+    std::size_t resets = 0;
+
+    /**
+     * \brief Accumulated time spent by callers waiting for the session to become available.
+     */
+    std::chrono::nanoseconds wait_time{ 0 };
+
+    /**
+     * \brief Accumulated time the session has been leased.
+     */
+    std::chrono::nanoseconds busy_time{ 0 };
+  };
+
+private:
+  struct Slot
+  {
+    std::shared_ptr<Poco::Net::HTTPClientSession> session;
+    std::size_t settings_generation = 0;
+    SessionStatistics statistics;
+  };
+
+public:
+  /**
+   * \brief Grants exclusive use of one pooled session. The session is returned to the pool on destruction.
+   */
+  class Lease
+  {
+  public:
+    Lease(Lease&& other) noexcept;
+    Lease(Lease const&) = delete;
+    Lease& operator=(Lease const&) = delete;
+    Lease& operator=(Lease&&) = delete;
+
+    /**
+     * \brief Returns the session to the pool.
+     */
+    ~Lease();
+
+    /**
+     * \brief The leased session.
+     */
+    Poco::Net::HTTPClientSession& session() const noexcept
+    {
+      return *slot_->session;
+    }
+
+    /**
+     * \brief Resets the leased session, i.e. closes its connection, and counts the reset in the statistics.
+     */
+    void reset();
+
+  private:
+    friend class POCOSessionPool;
+
+    Lease(POCOSessionPool& pool, Slot& slot, std::chrono::steady_clock::time_point acquired);
+
+    POCOSessionPool* pool_;
+    Slot* slot_;
+    std::chrono::steady_clock::time_point acquired_;
+  };
+
+  /**
+   * \brief A constructor.
+   *
+   * \param session_factory function used to create new sessions.
+   * \param size maximum number of sessions in the pool (values less than 1 are treated as 1).
+   * \param collect_statistics indicating if per-session statistics should be collected.
+   */
+  POCOSessionPool(SessionFactory session_factory, std::size_t size, bool collect_statistics = false);
+
+  /**
+   * \brief A constructor for a pool consisting of a single, externally owned session.
+   *
+   * \param session the session. It must outlive the pool.
+   * \param collect_statistics indicating if per-session statistics should be collected.
+   */
+  explicit POCOSessionPool(Poco::Net::HTTPClientSession& session, bool collect_statistics = false);
+
+  POCOSessionPool(POCOSessionPool const&) = delete;
+  POCOSessionPool& operator=(POCOSessionPool const&) = delete;
+
+  /**
+   * \brief Acquires a session, blocking until one is available.
+   *
+   * \return lease of the acquired session.
+   */
+  Lease acquire();
+
+  /**
+   * \brief Sets the connection, send and receive timeouts of all sessions.
+   *
+   * Sessions which are currently leased are updated (and reset) the next time they are acquired.
+   *
+   * \param timeout the new timeout.
+   */
+  void setTimeout(Poco::Timespan const& timeout);
+
+  /**
+   * \brief Resets all sessions. Sessions which are currently leased are reset the next time they are acquired.
+   */
+  void resetAll();
+
+  /**
+   * \brief Maximum number of sessions in the pool.
+   */
+  std::size_t size() const noexcept
+  {
+    return size_;
+  }
+
+  /**
+   * \brief Retrieves the per-session statistics.
+   *
+   * \return statistics for each session created so far (empty if statistics collection is disabled).
+   */
+  std::vector<SessionStatistics> getStatistics() const;
+
+private:
+  void release(Slot& slot, std::chrono::steady_clock::time_point acquired);
+  void applySettings(Slot& slot);
+
+  SessionFactory session_factory_;
+  std::size_t const size_;
+  bool const collect_statistics_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable available_;
+
+  /**
+   * \brief All sessions created so far. Slots are never removed, so references to them stay valid.
+   */
+  std::vector<std::unique_ptr<Slot>> slots_;
+
+  /**
+   * \brief Sessions that are not leased. Used as a stack, so that the most recently used connection is reused first.
+   */
+  std::vector<Slot*> idle_;
+
+  /**
+   * \brief Incremented whenever the session settings change, to update leased sessions when they are acquired again.
+   */
+  std::size_t settings_generation_ = 0;
+
+  /**
+   * \brief Timeout to apply to the sessions (if any has been set).
+   */
+  std::optional<Poco::Timespan> timeout_;
+};
+}  // namespace abb::rws
@@ -38,10 +38,13 @@
 #define RWS_RAPID_H
 
 #include <string>
+#include <string_view>
 #include <array>
 #include <vector>
 #include <sstream>
 #include <stdexcept>
+#include <tuple>
+#include <utility>
 
 #include <boost/exception/diagnostic_information.hpp>
 
@@ -96,6 +99,20 @@ public:
    */
   virtual void parseString(const std::string&  value_string) = 0;
 
+  /**
+   * \brief Virtual method for parsing a RAPID symbol data value string, without requiring a std::string.
+   *
+   * Used by records and arrays to parse their components directly from the tokenized value string. The default
+   * implementation copies the view and forwards it to parseString, so derived types only overriding parseString
+   * keep working; built-in types override it to avoid the copy.
+   *
+   * \param value_string containing the string to parse.
+   */
+  virtual void parseStringView(std::string_view value_string)
+  {
+    parseString(std::string(value_string));
+  }
+
   /**
    * \brief Pure virtual method for constructing a RAPID symbol data value string.
    *
@@ -184,6 +201,13 @@ struct RAPIDAtomic<RAPID_BOOL> : public RAPIDAtomicTemplate<bool>
    */
   void parseString(const std::string& value_string) override;
 
+  /**
+   * \brief A method for parsing a RAPID symbol data value string, without copying it.
+   *
+   * \param value_string containing the string to parse.
+   */
+  void parseStringView(std::string_view value_string) override;
+
   /**
    * \brief A method for constructing a RAPID symbol data value string.
    *
@@ -205,6 +229,11 @@ struct RAPIDAtomic<RAPID_NUM> : public RAPIDAtomicTemplate<float>
    */
   RAPIDAtomic(const float value = (float) 0.0) : RAPIDAtomicTemplate(value) {}
 
+  /**
+   * \brief Maximum number of characters written by constructString(char*, char*).
+   */
+  static std::size_t constexpr MAX_STRING_SIZE = 48;
+
   /**
    * \brief A method for retrieving the name of the symbol's data type.
    *
@@ -212,12 +241,41 @@ struct RAPIDAtomic<RAPID_NUM> : public RAPIDAtomicTemplate<float>
    */
   std::string getType() const override;
 
+  /**
+   * \brief A method for parsing a RAPID symbol data value string.
+   *
+   * \param value_string containing the string to parse.
+   */
+  void parseString(const std::string& value_string) override;
+
+  /**
+   * \brief A method for parsing a RAPID symbol data value string, without copying it.
+   *
+   * Parsing is locale-independent. Leading whitespace and a leading '+' are accepted, and an invalid string
+   * results in the value 0 (as with stream extraction).
+   *
+   * \param value_string containing the string to parse.
+   */
+  void parseStringView(std::string_view value_string) override;
+
   /**
    * \brief A method for constructing a RAPID symbol data value string.
    *
    * \return std::string containing the constructed string.
    */
   std::string constructString() const override;
+
+  /**
+   * \brief A method for constructing a RAPID symbol data value string into a caller-supplied buffer.
+   *
+   * \param first beginning of the buffer.
+   * \param last end of the buffer. A buffer of MAX_STRING_SIZE characters is always large enough.
+   *
+   * \return char* one past the last written character.
+   *
+   * \throws std::length_error if the buffer is too small.
+   */
+  char* constructString(char* first, char* last) const;
 };
 
 /**
@@ -233,6 +291,11 @@ struct RAPIDAtomic<RAPID_DNUM> : public RAPIDAtomicTemplate<double>
    */
   RAPIDAtomic(const double value = (double) 0.0) : RAPIDAtomicTemplate(value) {}
 
+  /**
+   * \brief Maximum number of characters written by constructString(char*, char*).
+   */
+  static std::size_t constexpr MAX_STRING_SIZE = 328;
+
   /**
    * \brief A method for retrieving the name of the symbol's data type.
    *
@@ -240,12 +303,41 @@ struct RAPIDAtomic<RAPID_DNUM> : public RAPIDAtomicTemplate<double>
    */
   std::string getType() const override;
 
+  /**
+   * \brief A method for parsing a RAPID symbol data value string.
+   *
+   * \param value_string containing the string to parse.
+   */
+  void parseString(const std::string& value_string) override;
+
+  /**
+   * \brief A method for parsing a RAPID symbol data value string, without copying it.
+   *
+   * Parsing is locale-independent. Leading whitespace and a leading '+' are accepted, and an invalid string
+   * results in the value 0 (as with stream extraction).
+   *
+   * \param value_string containing the string to parse.
+   */
+  void parseStringView(std::string_view value_string) override;
+
   /**
    * \brief A method for constructing a RAPID symbol data value string.
    *
    * \return std::string containing the constructed string.
    */
   std::string constructString() const override;
+
+  /**
+   * \brief A method for constructing a RAPID symbol data value string into a caller-supplied buffer.
+   *
+   * \param first beginning of the buffer.
+   * \param last end of the buffer. A buffer of MAX_STRING_SIZE characters is always large enough.
+   *
+   * \return char* one past the last written character.
+   *
+   * \throws std::length_error if the buffer is too small.
+   */
+  char* constructString(char* first, char* last) const;
 };
 
 /**
@@ -275,6 +367,13 @@ struct RAPIDAtomic<RAPID_STRING> : public RAPIDAtomicTemplate<std::string>
    */
   void parseString(const std::string& value_string) override;
 
+  /**
+   * \brief A method for parsing a RAPID symbol data value string, without copying it.
+   *
+   * \param value_string containing the string to parse.
+   */
+  void parseStringView(std::string_view value_string) override;
+
   /**
    * \brief A method for constructing a RAPID symbol data value string.
    *
@@ -305,6 +404,9 @@ typedef RAPIDAtomic<RAPID_STRING> RAPIDString;
 
 /**
  * \brief A struct, for representing the data of a RAPID record symbol.
+ *
+ * The components are registered at runtime, by each instance. Records with a layout known at compile time should
+ * derive from RAPIDRecordTemplate instead.
  */
 struct RAPIDRecord : public RAPIDSymbolDataAbstract
 {
@@ -330,6 +432,13 @@ public:
    */
   void parseString(const std::string& value_string) override;
 
+  /**
+   * \brief A method for parsing a RAPID symbol data value string, without copying the component substrings.
+   *
+   * \param value_string containing the string to parse.
+   */
+  void parseStringView(std::string_view value_string) override;
+
   /**
    * \brief A method for getting the type of the RAPID record.
    *
@@ -396,23 +505,21 @@ public:
    */
   std::string constructString() const override
   {
-    std::stringstream ss;
-
-    ss << "[";
+    std::string result = "[";
 
     for (size_t i = 0; i < container_.size(); ++i)
     {
-      ss << container_.at(i).constructString();
+      result += container_.at(i).constructString();
 
       if (i != container_.size() - 1)
       {
-        ss << ",";
+        result += ',';
       }
     }
 
-    ss << "]";
+    result += ']';
 
-    return ss.str();
+    return result;
   }
 
   /**
@@ -424,7 +531,19 @@ public:
    */
   void parseString(const std::string& value_string) override
   {
-    std::vector<std::string> substrings = extractDelimitedSubstrings(value_string, '[', ']', ',');
+    parseStringView(value_string);
+  }
+
+  /**
+   * \brief A method for parsing a RAPID symbol data value string, without copying the item substrings.
+   *
+   * \param value_string containing the string to parse.
+   *
+   * \throws invalid_argument when value_string represent an array of a different size
+   */
+  void parseStringView(std::string_view value_string) override
+  {
+    std::vector<std::string_view> const substrings = splitDelimitedSubstrings(value_string, '[', ']', ',');
 
     if(array_size != substrings.size())
     {
@@ -443,7 +562,7 @@ public:
 
     for (size_t i = 0; i < substrings.size(); ++i)
     {
-      container_.at(i).parseString(substrings.at(i));
+      container_.at(i).parseStringView(substrings.at(i));
     }
   }
 
@@ -489,25 +608,354 @@ private:
   std::array<value_type, array_size> container_;
 };
 
+/**
+ * \brief A range of elements in a RAPID array, e.g. for reading or writing only a part of the array.
+ */
+struct RAPIDArrayRange
+{
+  /**
+   * \brief Zero-based index of the first element (i.e. the element RAPID refers to as {first + 1}).
+   */
+  std::size_t first = 0;
+
+  /**
+   * \brief Number of elements.
+   */
+  std::size_t count = 0;
+};
+
+/**
+ * \brief An abstract struct, for structs representing the data of RAPID arrays with a size known only at runtime.
+ */
+struct RAPIDDynamicArrayAbstract : public RAPIDSymbolDataAbstract
+{
+public:
+  /**
+   * \brief Pure virtual method for retrieving the number of elements.
+   *
+   * \return std::size_t containing the number of elements.
+   */
+  virtual std::size_t size() const = 0;
+
+  /**
+   * \brief Pure virtual method for changing the number of elements.
+   *
+   * \param size specifying the new number of elements.
+   */
+  virtual void resize(std::size_t size) = 0;
+
+  /**
+   * \brief Pure virtual method for mutably accessing an element.
+   *
+   * \param index of the element.
+   *
+   * \return RAPIDSymbolDataAbstract& referring to the element.
+   *
+   * \throws out_of_range when the index is larger or equal than the array size
+   */
+  virtual RAPIDSymbolDataAbstract& element(std::size_t index) = 0;
+
+  /**
+   * \brief Pure virtual method for immutably accessing an element.
+   *
+   * \param index of the element.
+   *
+   * \return RAPIDSymbolDataAbstract const& referring to the element.
+   *
+   * \throws out_of_range when the index is larger or equal than the array size
+   */
+  virtual RAPIDSymbolDataAbstract const& element(std::size_t index) const = 0;
+};
+
+/**
+ * \brief A struct, for representing the data of a RAPID array with a size known only at runtime.
+ *
+ * Parsing a value string resizes the array to the number of elements in the string.
+ */
+template <typename T>
+struct RAPIDDynamicArray : public RAPIDDynamicArrayAbstract
+{
+public:
+  /**
+   * \brief Type of the items in the array.
+   */
+  using value_type = T;
+
+  /**
+   * \brief A constructor.
+   *
+   * \param size specifying the initial number of (default constructed) elements.
+   */
+  explicit RAPIDDynamicArray(std::size_t size = 0) : container_(size)
+  {
+  }
+
+  /**
+   * \brief A method for constructing a RAPID symbol data value string.
+   *
+   * \return std::string containing the constructed string.
+   */
+  std::string constructString() const override
+  {
+    std::string result = "[";
+
+    for (size_t i = 0; i < container_.size(); ++i)
+    {
+      result += container_[i].constructString();
+
+      if (i != container_.size() - 1)
+      {
+        result += ',';
+      }
+    }
+
+    result += ']';
+
+    return result;
+  }
+
+  /**
+   * \brief A method for parsing a RAPID symbol data value string.
+   *
+   * \param value_string containing the string to parse.
+   */
+  void parseString(const std::string& value_string) override
+  {
+    parseStringView(value_string);
+  }
+
+  /**
+   * \brief A method for parsing a RAPID symbol data value string, without copying the item substrings.
+   *
+   * \param value_string containing the string to parse.
+   */
+  void parseStringView(std::string_view value_string) override
+  {
+    std::vector<std::string_view> const substrings = splitDelimitedSubstrings(value_string, '[', ']', ',');
+
+    container_.resize(substrings.size());
+
+    for (size_t i = 0; i < substrings.size(); ++i)
+    {
+      container_[i].parseStringView(substrings[i]);
+    }
+  }
+
+  /**
+   * \brief A method for getting the type of item stored in the RAPID array.
+   *
+   * \return std::string containing the type.
+   */
+  std::string getType() const override
+  {
+    static std::string const type_string = value_type().getType();
+    return type_string;
+  }
+
+  /**
+   * \brief A method for retrieving the number of elements.
+   *
+   * \return std::size_t containing the number of elements.
+   */
+  std::size_t size() const override
+  {
+    return container_.size();
+  }
+
+  /**
+   * \brief A method for changing the number of elements.
+   *
+   * \param size specifying the new number of elements.
+   */
+  void resize(std::size_t size) override
+  {
+    container_.resize(size);
+  }
+
+  /**
+   * \brief A method for mutably accessing an element.
+   *
+   * \param index of the element.
+   *
+   * \return RAPIDSymbolDataAbstract& referring to the element.
+   */
+  RAPIDSymbolDataAbstract& element(std::size_t index) override
+  {
+    return container_.at(index);
+  }
+
+  /**
+   * \brief A method for immutably accessing an element.
+   *
+   * \param index of the element.
+   *
+   * \return RAPIDSymbolDataAbstract const& referring to the element.
+   */
+  RAPIDSymbolDataAbstract const& element(std::size_t index) const override
+  {
+    return container_.at(index);
+  }
+
+  /**
+   * \brief Immutably access an element of the underlying using its index
+   *
+   * \param index The index of the item to access in the underlying container
+   * \return value_type const& The value at the given index
+   *
+   * \throws out_of_range when the index is larger or equal than the array size
+   */
+  value_type const& at(const size_t index) const
+  {
+    return container_.at(index);
+  }
+
+  /**
+   * \brief Mutably access an element of the underlying using its index
+   *
+   * \param index The index of the item to access in the underlying container
+   * \return value_type& The value at the given index
+   *
+   * \throws out_of_range when the index is larger or equal than the array size
+   */
+  value_type& at(const size_t index)
+  {
+    return container_.at(index);
+  }
+
+private:
+  std::vector<value_type> container_;
+};
+
+/**
+ * \brief A template struct, for structs representing the data of RAPID records with a compile-time layout.
+ *
+ * The derived struct describes its layout with two static members:
+ * - RECORD_TYPE_NAME: the name of the RAPID record type (i.e. its name in the RAPID code).
+ * - fields(): a constexpr function returning a std::tuple of pointers to the component members, in the order of the
+ *   RAPID record declaration.
+ *
+ * The components are parsed and constructed through the member pointers, with statically dispatched calls. So the
+ * records need no per-instance bookkeeping, and the implicitly generated copy operations are correct.
+ */
+template <typename Derived>
+struct RAPIDRecordTemplate : public RAPIDSymbolDataAbstract
+{
+public:
+  /**
+   * \brief A method for getting the type of the RAPID record.
+   *
+   * \return std::string containing the type.
+   */
+  std::string getType() const override
+  {
+    return Derived::RECORD_TYPE_NAME;
+  }
+
+  /**
+   * \brief A method for parsing a RAPID symbol data value string.
+   *
+   * \param value_string containing the string to parse.
+   */
+  void parseString(const std::string& value_string) override
+  {
+    parseStringView(value_string);
+  }
+
+  /**
+   * \brief A method for parsing a RAPID symbol data value string, without copying the component substrings.
+   *
+   * Note: As for RAPIDRecord, the record is left unchanged if the number of components does not match.
+   *
+   * \param value_string containing the string to parse.
+   */
+  void parseStringView(std::string_view value_string) override
+  {
+    std::vector<std::string_view> const substrings = splitDelimitedSubstrings(value_string, '[', ']', ',');
+
+    if (substrings.size() == fieldCount())
+    {
+      parseFields(substrings, std::make_index_sequence<fieldCount()>{});
+    }
+  }
+
+  /**
+   * \brief A method for constructing a RAPID symbol data value string.
+   *
+   * \return std::string containing the constructed string.
+   */
+  std::string constructString() const override
+  {
+    std::string result = "[";
+    constructFields(result, std::make_index_sequence<fieldCount()>{});
+    result += ']';
+
+    return result;
+  }
+
+private:
+  /**
+   * \brief Number of components in the record.
+   */
+  static constexpr std::size_t fieldCount()
+  {
+    return std::tuple_size_v<decltype(Derived::fields())>;
+  }
+
+  template <std::size_t... I>
+  void parseFields(std::vector<std::string_view> const& substrings, std::index_sequence<I...>)
+  {
+    constexpr auto fields = Derived::fields();
+    Derived& self = static_cast<Derived&>(*this);
+
+    (parseField(self.*std::get<I>(fields), substrings[I]), ...);
+  }
+
+  template <std::size_t... I>
+  void constructFields(std::string& result, std::index_sequence<I...>) const
+  {
+    constexpr auto fields = Derived::fields();
+    Derived const& self = static_cast<Derived const&>(*this);
+
+    ((result += (I == 0 ? "" : ","), result += constructField(self.*std::get<I>(fields))), ...);
+  }
+
+  /**
+   * \brief Parse a component, without virtual dispatch (the component's type is known exactly).
+   */
+  template <typename T>
+  static void parseField(T& field, std::string_view value_string)
+  {
+    field.T::parseStringView(value_string);
+  }
+
+  /**
+   * \brief Construct a component string, without virtual dispatch (the component's type is known exactly).
+   */
+  template <typename T>
+  static std::string constructField(T const& field)
+  {
+    return field.T::constructString();
+  }
+};
+
 /**
  * \brief A struct, for representing a RAPID robjoint record.
  */
-struct RobJoint : public RAPIDRecord
+struct RobJoint : public RAPIDRecordTemplate<RobJoint>
 {
 public:
   /**
-   * \brief A default constructor.
+   * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
    */
-  RobJoint()
-  :
-  RAPIDRecord("robjoint")
+  static constexpr char const* RECORD_TYPE_NAME = "robjoint";
+
+  /**
+   * \brief The record's components, in the order of the RAPID record declaration.
+   */
+  static constexpr auto fields()
   {
-    components_.push_back(&rax_1);
-    components_.push_back(&rax_2);
-    components_.push_back(&rax_3);
-    components_.push_back(&rax_4);
-    components_.push_back(&rax_5);
-    components_.push_back(&rax_6);
+    return std::make_tuple(&RobJoint::rax_1, &RobJoint::rax_2, &RobJoint::rax_3, &RobJoint::rax_4, &RobJoint::rax_5,
+                           &RobJoint::rax_6);
   }
 
   /**
@@ -544,22 +992,21 @@ public:
 /**
  * \brief A struct, for representing a RAPID extjoint record.
  */
-struct ExtJoint : public RAPIDRecord
+struct ExtJoint : public RAPIDRecordTemplate<ExtJoint>
 {
 public:
   /**
-   * \brief A default constructor.
+   * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
+   */
+  static constexpr char const* RECORD_TYPE_NAME = "extjoint";
+
+  /**
+   * \brief The record's components, in the order of the RAPID record declaration.
    */
-  ExtJoint()
-  :
-  RAPIDRecord("extjoint")
+  static constexpr auto fields()
   {
-    components_.push_back(&eax_a);
-    components_.push_back(&eax_b);
-    components_.push_back(&eax_c);
-    components_.push_back(&eax_d);
-    components_.push_back(&eax_e);
-    components_.push_back(&eax_f);
+    return std::make_tuple(&ExtJoint::eax_a, &ExtJoint::eax_b, &ExtJoint::eax_c, &ExtJoint::eax_d, &ExtJoint::eax_e,
+                           &ExtJoint::eax_f);
   }
 
   /**
@@ -596,37 +1043,20 @@ public:
 /**
  * \brief A struct, for representing a RAPID jointtarget record.
  */
-struct JointTarget : public RAPIDRecord
+struct JointTarget : public RAPIDRecordTemplate<JointTarget>
 {
 public:
   /**
-   * \brief A default constructor.
+   * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
    */
-  JointTarget()
-  :
-  RAPIDRecord("jointtarget")
-  {
-    components_.push_back(&robax);
-    components_.push_back(&extax);
-  }
+  static constexpr char const* RECORD_TYPE_NAME = "jointtarget";
 
   /**
-   * \brief Copy constructor.
-   *
-   * \param other containing the values to copy.
+   * \brief The record's components, in the order of the RAPID record declaration.
    */
-  JointTarget(const JointTarget& other)
-  :
-  RAPIDRecord(other.record_type_name_)
+  static constexpr auto fields()
   {
-    if (this != &other)
-    {
-      robax = other.robax;
-      extax = other.extax;
-      components_.clear();
-      components_.push_back(&robax);
-      components_.push_back(&extax);
-    }
+    return std::make_tuple(&JointTarget::robax, &JointTarget::extax);
   }
 
   /**
@@ -643,19 +1073,20 @@ public:
 /**
  * \brief A struct, for representing a RAPID pos record.
  */
-struct Pos : public RAPIDRecord
+struct Pos : public RAPIDRecordTemplate<Pos>
 {
 public:
   /**
-   * \brief A default constructor.
+   * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
+   */
+  static constexpr char const* RECORD_TYPE_NAME = "pos";
+
+  /**
+   * \brief The record's components, in the order of the RAPID record declaration.
    */
-  Pos()
-  :
-  RAPIDRecord("pos")
+  static constexpr auto fields()
   {
-    components_.push_back(&x);
-    components_.push_back(&y);
-    components_.push_back(&z);
+    return std::make_tuple(&Pos::x, &Pos::y, &Pos::z);
   }
 
   /**
@@ -677,20 +1108,20 @@ public:
 /**
  * \brief A struct, for representing a RAPID orient record.
  */
-struct Orient : public RAPIDRecord
+struct Orient : public RAPIDRecordTemplate<Orient>
 {
 public:
   /**
-   * \brief A default constructor.
+   * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
+   */
+  static constexpr char const* RECORD_TYPE_NAME = "orient";
+
+  /**
+   * \brief The record's components, in the order of the RAPID record declaration.
    */
-  Orient()
-  :
-  RAPIDRecord("orient")
+  static constexpr auto fields()
   {
-    components_.push_back(&q1);
-    components_.push_back(&q2);
-    components_.push_back(&q3);
-    components_.push_back(&q4);
+    return std::make_tuple(&Orient::q1, &Orient::q2, &Orient::q3, &Orient::q4);
   }
 
   /**
@@ -717,37 +1148,20 @@ public:
 /**
  * \brief A struct, for representing a RAPID pose record.
  */
-struct Pose : public RAPIDRecord
+struct Pose : public RAPIDRecordTemplate<Pose>
 {
 public:
   /**
-   * \brief A default constructor.
+   * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
    */
-  Pose()
-  :
-  RAPIDRecord("pose")
-  {
-    components_.push_back(&pos);
-    components_.push_back(&rot);
-  }
+  static constexpr char const* RECORD_TYPE_NAME = "pose";
 
   /**
-   * \brief Copy constructor.
-   *
-   * \param other containing the values to copy.
+   * \brief The record's components, in the order of the RAPID record declaration.
    */
-  Pose(const Pose& other)
-  :
-  RAPIDRecord(other.record_type_name_)
+  static constexpr auto fields()
   {
-    if (this != &other)
-    {
-      pos = other.pos;
-      rot = other.rot;
-      components_.clear();
-      components_.push_back(&pos);
-      components_.push_back(&rot);
-    }
+    return std::make_tuple(&Pose::pos, &Pose::rot);
   }
 
   /**
@@ -764,20 +1178,20 @@ public:
 /**
  * \brief A struct, for representing a RAPID confdata record.
  */
-struct ConfData : public RAPIDRecord
+struct ConfData : public RAPIDRecordTemplate<ConfData>
 {
 public:
   /**
-   * \brief A default constructor.
+   * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
    */
-  ConfData()
-  :
-  RAPIDRecord("confdata")
+  static constexpr char const* RECORD_TYPE_NAME = "confdata";
+
+  /**
+   * \brief The record's components, in the order of the RAPID record declaration.
+   */
+  static constexpr auto fields()
   {
-    components_.push_back(&cf1);
-    components_.push_back(&cf4);
-    components_.push_back(&cf6);
-    components_.push_back(&cfx);
+    return std::make_tuple(&ConfData::cf1, &ConfData::cf4, &ConfData::cf6, &ConfData::cfx);
   }
 
   /**
@@ -804,43 +1218,20 @@ public:
 /**
  * \brief A struct, for representing a RAPID robtarget record.
  */
-struct RobTarget : public RAPIDRecord
+struct RobTarget : public RAPIDRecordTemplate<RobTarget>
 {
 public:
   /**
-   * \brief A default constructor.
+   * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
    */
-  RobTarget()
-  :
-  RAPIDRecord("robtarget")
-  {
-    components_.push_back(&pos);
-    components_.push_back(&orient);
-    components_.push_back(&robconf);
-    components_.push_back(&extax);
-  }
+  static constexpr char const* RECORD_TYPE_NAME = "robtarget";
 
   /**
-   * \brief Copy constructor.
-   *
-   * \param other containing the values to copy.
+   * \brief The record's components, in the order of the RAPID record declaration.
    */
-  RobTarget(const RobTarget& other)
-  :
-  RAPIDRecord(other.record_type_name_)
+  static constexpr auto fields()
   {
-    if (this != &other)
-    {
-      pos = other.pos;
-      orient = other.orient;
-      robconf = other.robconf;
-      extax = other.extax;
-      components_.clear();
-      components_.push_back(&pos);
-      components_.push_back(&orient);
-      components_.push_back(&robconf);
-      components_.push_back(&extax);
-    }
+    return std::make_tuple(&RobTarget::pos, &RobTarget::orient, &RobTarget::robconf, &RobTarget::extax);
   }
 
   /**
@@ -867,49 +1258,21 @@ public:
 /**
  * \brief A struct, for representing a RAPID loaddata record.
  */
-struct LoadData : public RAPIDRecord
+struct LoadData : public RAPIDRecordTemplate<LoadData>
 {
 public:
   /**
-   * \brief A default constructor.
+   * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
    */
-  LoadData()
-  :
-  RAPIDRecord("loaddata")
-  {
-    components_.push_back(&mass);
-    components_.push_back(&cog);
-    components_.push_back(&aom);
-    components_.push_back(&ix);
-    components_.push_back(&iy);
-    components_.push_back(&iz);
-  }
+  static constexpr char const* RECORD_TYPE_NAME = "loaddata";
 
   /**
-   * \brief Copy constructor.
-   *
-   * \param other containing the values to copy.
+   * \brief The record's components, in the order of the RAPID record declaration.
    */
-  LoadData(const LoadData& other)
-  :
-  RAPIDRecord(other.record_type_name_)
+  static constexpr auto fields()
   {
-    if (this != &other)
-    {
-      mass = other.mass;
-      cog = other.cog;
-      aom = other.aom;
-      ix = other.ix;
-      iy = other.iy;
-      iz = other.iz;
-      components_.clear();
-      components_.push_back(&mass);
-      components_.push_back(&cog);
-      components_.push_back(&aom);
-      components_.push_back(&ix);
-      components_.push_back(&iy);
-      components_.push_back(&iz);
-    }
+    return std::make_tuple(&LoadData::mass, &LoadData::cog, &LoadData::aom, &LoadData::ix, &LoadData::iy,
+                           &LoadData::iz);
   }
 
   /**
@@ -946,40 +1309,20 @@ public:
 /**
  * \brief A struct, for representing a RAPID tooldata record.
  */
-struct ToolData : public RAPIDRecord
+struct ToolData : public RAPIDRecordTemplate<ToolData>
 {
 public:
   /**
-   * \brief A default constructor.
+   * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
    */
-  ToolData()
-  :
-  RAPIDRecord("tooldata")
-  {
-    components_.push_back(&robhold);
-    components_.push_back(&tframe);
-    components_.push_back(&tload);
-  }
+  static constexpr char const* RECORD_TYPE_NAME = "tooldata";
 
   /**
-   * \brief Copy constructor.
-   *
-   * \param other containing the values to copy.
+   * \brief The record's components, in the order of the RAPID record declaration.
    */
-  ToolData(const ToolData& other)
-  :
-  RAPIDRecord(other.record_type_name_)
+  static constexpr auto fields()
   {
-    if (this != &other)
-    {
-      robhold = other.robhold;
-      tframe = other.tframe;
-      tload = other.tload;
-      components_.clear();
-      components_.push_back(&robhold);
-      components_.push_back(&tframe);
-      components_.push_back(&tload);
-    }
+    return std::make_tuple(&ToolData::robhold, &ToolData::tframe, &ToolData::tload);
   }
 
   /**
@@ -1001,46 +1344,21 @@ public:
 /**
  * \brief A struct, for representing a RAPID wobjdata record.
  */
-struct WObjData : public RAPIDRecord
+struct WObjData : public RAPIDRecordTemplate<WObjData>
 {
 public:
   /**
-   * \brief A default constructor.
+   * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
    */
-  WObjData()
-  :
-  RAPIDRecord("wobjdata")
-  {
-    components_.push_back(&robhold);
-    components_.push_back(&ufprog);
-    components_.push_back(&ufmec);
-    components_.push_back(&uframe);
-    components_.push_back(&oframe);
-  }
+  static constexpr char const* RECORD_TYPE_NAME = "wobjdata";
 
   /**
-   * \brief Copy constructor.
-   *
-   * \param other containing the values to copy.
+   * \brief The record's components, in the order of the RAPID record declaration.
    */
-  WObjData(const WObjData& other)
-  :
-  RAPIDRecord(other.record_type_name_)
+  static constexpr auto fields()
   {
-    if (this != &other)
-    {
-      robhold = other.robhold;
-      ufprog = other.ufprog;
-      ufmec = other.ufmec;
-      uframe = other.uframe;
-      oframe = other.oframe;
-      components_.clear();
-      components_.push_back(&robhold);
-      components_.push_back(&ufprog);
-      components_.push_back(&ufmec);
-      components_.push_back(&uframe);
-      components_.push_back(&oframe);
-    }
+    return std::make_tuple(&WObjData::robhold, &WObjData::ufprog, &WObjData::ufmec, &WObjData::uframe,
+                           &WObjData::oframe);
   }
 
   /**
@@ -1072,20 +1390,20 @@ public:
 /**
  * \brief A struct, for representing a RAPID speeddata record.
  */
-struct SpeedData : public RAPIDRecord
+struct SpeedData : public RAPIDRecordTemplate<SpeedData>
 {
 public:
   /**
-   * \brief A default constructor.
+   * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
    */
-  SpeedData()
-  :
-  RAPIDRecord("speeddata")
+  static constexpr char const* RECORD_TYPE_NAME = "speeddata";
+
+  /**
+   * \brief The record's components, in the order of the RAPID record declaration.
+   */
+  static constexpr auto fields()
   {
-    components_.push_back(&v_tcp);
-    components_.push_back(&v_ori);
-    components_.push_back(&v_leax);
-    components_.push_back(&v_reax);
+    return std::make_tuple(&SpeedData::v_tcp, &SpeedData::v_ori, &SpeedData::v_leax, &SpeedData::v_reax);
   }
 
   /**
@@ -1113,48 +1431,21 @@ public:
 /**
  * \brief A struct, for representing a RAPID zonedata record.
  */
-struct ZoneData : public RAPIDRecord
+struct ZoneData : public RAPIDRecordTemplate<ZoneData>
 {
 public:
   /**
-   * \brief A default constructor.
+   * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
    */
-  ZoneData()
-  :
-  RAPIDRecord("zonedata")
-  {
-    components_.push_back(&finep);
-    components_.push_back(&pzone_tcp);
-    components_.push_back(&pzone_ori);
-    components_.push_back(&pzone_eax);
-    components_.push_back(&zone_ori);
-    components_.push_back(&zone_leax);
-    components_.push_back(&zone_reax);
-  }
+  static constexpr char const* RECORD_TYPE_NAME = "zonedata";
 
   /**
-   * \brief Copy constructor.
-   *
-   * \param other containing the values to copy.
+   * \brief The record's components, in the order of the RAPID record declaration.
    */
-  ZoneData(const ZoneData& other)
-  : RAPIDRecord(other.record_type_name_)
-  , finep {other.finep}
-  , pzone_tcp {other.pzone_tcp}
-  , pzone_ori {other.pzone_ori}
-  , pzone_eax {other.pzone_eax}
-  , zone_ori {other.zone_ori}
-  , zone_leax {other.zone_leax}
-  , zone_reax {other.zone_reax}
+  static constexpr auto fields()
   {
-    components_.clear();
-    components_.push_back(&finep);
-    components_.push_back(&pzone_tcp);
-    components_.push_back(&pzone_ori);
-    components_.push_back(&pzone_eax);
-    components_.push_back(&zone_ori);
-    components_.push_back(&zone_leax);
-    components_.push_back(&zone_reax);
+    return std::make_tuple(&ZoneData::finep, &ZoneData::pzone_tcp, &ZoneData::pzone_ori, &ZoneData::pzone_eax,
+                           &ZoneData::zone_ori, &ZoneData::zone_leax, &ZoneData::zone_reax);
   }
 
   /**
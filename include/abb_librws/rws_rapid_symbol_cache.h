@@ -0,0 +1,148 @@
+#pragma once
+
+#include <abb_librws/rws_rapid_value.h>
+#include <abb_librws/rws_resource.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace abb ::rws
+{
+/**
+ * \brief Validated information about a RAPID symbol, as cached by \a RAPIDSymbolCache.
+ */
+struct RAPIDSymbolInfo
+{
+  /**
+   * \brief The symbol's RAPID data type (e.g. "num" or "robtarget").
+   */
+  std::string data_type;
+
+  /**
+   * \brief Size of each dimension, if the symbol is an array.
+   */
+  std::vector<std::size_t> dimensions;
+
+  /**
+   * \brief URI path of the symbol's data resource.
+   */
+  std::string data_path;
+
+  /**
+   * \brief URL of the symbol's data type (e.g. "RAPID/num" or "RAPID/T_ROB1/user/mytype"), if reported.
+   */
+  std::string type_url;
+};
+
+/**
+ * \brief Counters of RAPID symbol cache lookups.
+ */
+struct RAPIDSymbolCacheStatistics
+{
+  /**
+   * \brief Number of lookups answered from the cache.
+   */
+  std::size_t hits = 0;
+
+  /**
+   * \brief Number of lookups that required retrieving the symbol or type properties.
+   */
+  std::size_t misses = 0;
+
+  /**
+   * \brief Number of times the whole cache was cleared.
+   */
+  std::size_t invalidations = 0;
+};
+
+/**
+ * \brief Thread-safe cache of RAPID symbol information and of RAPID type layouts, so that typed reads need not
+ * retrieve the symbol or type properties every time.
+ *
+ * The information stays valid as long as the RAPID program is unchanged. The RAPID functions clear the cache when
+ * they change the program (module load/unload, program pointer reset). Applications that detect other program
+ * changes (e.g. made from the FlexPendant) should call clear().
+ */
+class RAPIDSymbolCache
+{
+public:
+  RAPIDSymbolCache() = default;
+  RAPIDSymbolCache(RAPIDSymbolCache const&) = delete;
+  RAPIDSymbolCache& operator=(RAPIDSymbolCache const&) = delete;
+
+  /**
+   * \brief Looks up a RAPID symbol.
+   *
+   * \param resource specifying the RAPID task, module and symbol names.
+   *
+   * \return the cached information, if any.
+   */
+  std::optional<RAPIDSymbolInfo> find(RAPIDResource const& resource) const;
+
+  /**
+   * \brief Adds or replaces the information of a RAPID symbol.
+   *
+   * \param resource specifying the RAPID task, module and symbol names.
+   * \param info the symbol's validated information.
+   */
+  void insert(RAPIDResource const& resource, RAPIDSymbolInfo info);
+
+  /**
+   * \brief Removes the information of a RAPID symbol (e.g. after a failed read).
+   *
+   * \param resource specifying the RAPID task, module and symbol names.
+   */
+  void erase(RAPIDResource const& resource);
+
+  /**
+   * \brief Looks up the layout of a RAPID data type.
+   *
+   * \param type_url the URL of the data type.
+   *
+   * \return the cached layout, or null.
+   */
+  std::shared_ptr<RAPIDSchema const> findSchema(std::string const& type_url) const;
+
+  /**
+   * \brief Adds or replaces the layout of a RAPID data type.
+   *
+   * \param type_url the URL of the data type.
+   * \param schema the layout.
+   */
+  void insertSchema(std::string type_url, std::shared_ptr<RAPIDSchema const> schema);
+
+  /**
+   * \brief Removes all information, e.g. after the RAPID program has changed.
+   */
+  void clear();
+
+  /**
+   * \brief Retrieves the lookup counters.
+   */
+  RAPIDSymbolCacheStatistics getStatistics() const noexcept
+  {
+    return { hits_.load(std::memory_order_relaxed), misses_.load(std::memory_order_relaxed),
+             invalidations_.load(std::memory_order_relaxed) };
+  }
+
+private:
+  /**
+   * \brief Key of a RAPID symbol: "task/module/name".
+   */
+  static std::string makeKey(RAPIDResource const& resource);
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, RAPIDSymbolInfo> symbols_;
+  std::unordered_map<std::string, std::shared_ptr<RAPIDSchema const>> schemas_;
+
+  mutable std::atomic<std::size_t> hits_{ 0 };
+  mutable std::atomic<std::size_t> misses_{ 0 };
+  std::atomic<std::size_t> invalidations_{ 0 };
+};
+}  // namespace abb::rws
@@ -0,0 +1,350 @@
+#pragma once
+
+#include <abb_librws/rws_rapid.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace abb ::rws
+{
+/**
+ * \brief Kinds of nodes in a \a RAPIDSchema.
+ */
+enum class RAPIDNodeKind
+{
+  ATOMIC,
+  RECORD,
+  ARRAY
+};
+
+/**
+ * \brief Storage kinds of atomic values in a \a RAPIDValue.
+ */
+enum class RAPIDAtomicKind
+{
+  BOOL,
+  NUM,
+  DNUM,
+  STRING,
+
+  /**
+   * \brief Any other atomic type (e.g. an alias type), kept in RAPID text format.
+   */
+  TEXT
+};
+
+/**
+ * \brief A node of a \a RAPIDSchema.
+ */
+struct RAPIDSchemaNode
+{
+  /**
+   * \brief Kind of the node.
+   */
+  RAPIDNodeKind kind = RAPIDNodeKind::ATOMIC;
+
+  /**
+   * \brief Storage kind, if the node is atomic.
+   */
+  RAPIDAtomicKind atomic = RAPIDAtomicKind::TEXT;
+
+  /**
+   * \brief Name of the record component (empty for the root and for array elements).
+   */
+  std::string name;
+
+  /**
+   * \brief RAPID data type of the node (for arrays, the type of the elements).
+   */
+  std::string data_type;
+
+  /**
+   * \brief Number of record components or array elements.
+   */
+  std::size_t size = 0;
+
+  /**
+   * \brief Number of nodes in the subtree rooted at this node, including the node itself.
+   */
+  std::size_t extent = 1;
+
+  /**
+   * \brief Index of the subtree's first atomic value in the value arena.
+   */
+  std::size_t slot = 0;
+
+  /**
+   * \brief Number of atomic values in the subtree.
+   */
+  std::size_t slot_count = 1;
+};
+
+/**
+ * \brief Layout of a RAPID value (atomic, record or array, nested arbitrarily), discovered at runtime.
+ *
+ * The nodes are stored in pre-order, so that the subtree of a node occupies the following \a RAPIDSchemaNode::extent
+ * nodes, and the atomic values of a subtree occupy consecutive slots in the value arena. Node 0 is the root.
+ *
+ * Node indices can be resolved once, with component(), element() or find(), and then be used to access any number of
+ * values with the same schema.
+ */
+class RAPIDSchema
+{
+public:
+  /**
+   * \brief Creates the schema of an atomic type.
+   *
+   * \param data_type the RAPID data type (e.g. "num").
+   * \param kind the storage kind.
+   *
+   * \return RAPIDSchema containing the schema.
+   */
+  static RAPIDSchema atomic(std::string data_type, RAPIDAtomicKind kind);
+
+  /**
+   * \brief Creates the schema of an atomic type, deducing the storage kind from the type name.
+   *
+   * \param data_type the RAPID data type. Types other than bool, num, dnum and string are kept as text.
+   *
+   * \return RAPIDSchema containing the schema.
+   */
+  static RAPIDSchema atomic(std::string const& data_type);
+
+  /**
+   * \brief Creates the schema of a record type.
+   *
+   * \param data_type the RAPID data type (e.g. "pos").
+   * \param components the names and schemas of the record components, in declaration order.
+   *
+   * \return RAPIDSchema containing the schema.
+   */
+  static RAPIDSchema record(std::string data_type, std::vector<std::pair<std::string, RAPIDSchema>> const& components);
+
+  /**
+   * \brief Creates the schema of a (possibly multi-dimensional) array.
+   *
+   * \param element the schema of the elements.
+   * \param dimensions the size of each dimension, outermost first.
+   *
+   * \return RAPIDSchema containing the schema. Equal to \a element if \a dimensions is empty.
+   */
+  static RAPIDSchema array(RAPIDSchema const& element, std::vector<std::size_t> const& dimensions);
+
+  /**
+   * \brief Retrieves the RAPID data type of the root node (for arrays, the type of the elements).
+   */
+  std::string const& getType() const noexcept
+  {
+    return nodes_.front().data_type;
+  }
+
+  /**
+   * \brief Retrieves the nodes, in pre-order.
+   */
+  std::vector<RAPIDSchemaNode> const& nodes() const noexcept
+  {
+    return nodes_;
+  }
+
+  /**
+   * \brief Retrieves a node.
+   *
+   * \param node index of the node.
+   *
+   * \throws out_of_range when the index is larger or equal than the number of nodes.
+   */
+  RAPIDSchemaNode const& node(std::size_t node) const
+  {
+    return nodes_.at(node);
+  }
+
+  /**
+   * \brief Retrieves the number of atomic values, i.e. the size of the value arena.
+   */
+  std::size_t slotCount() const noexcept
+  {
+    return nodes_.front().slot_count;
+  }
+
+  /**
+   * \brief Finds a record component.
+   *
+   * \param node index of the record node.
+   * \param name name of the component.
+   *
+   * \return std::size_t containing the index of the component's node.
+   *
+   * \throws invalid_argument when the node is not a record or has no such component.
+   */
+  std::size_t component(std::size_t node, std::string_view name) const;
+
+  /**
+   * \brief Finds an array element.
+   *
+   * \param node index of the array node.
+   * \param index zero-based index of the element.
+   *
+   * \return std::size_t containing the index of the element's node.
+   *
+   * \throws invalid_argument when the node is not an array, or out_of_range when the index exceeds its size.
+   */
+  std::size_t element(std::size_t node, std::size_t index) const;
+
+  /**
+   * \brief Finds a node by its path from the root, e.g. "trans.x" or "points{2}.trans" (array indices are one-based,
+   * as in RAPID).
+   *
+   * \param path the path. Empty for the root.
+   *
+   * \return std::size_t containing the index of the node.
+   *
+   * \throws invalid_argument or out_of_range when the path does not match the schema.
+   */
+  std::size_t find(std::string_view path) const;
+
+private:
+  RAPIDSchema() = default;
+
+  /**
+   * \brief Appends the nodes of a subtree, offsetting its slots.
+   */
+  void append(RAPIDSchema const& subtree, std::string name);
+
+  std::vector<RAPIDSchemaNode> nodes_;
+};
+
+/**
+ * \brief An atomic value stored in a \a RAPIDValue.
+ *
+ * Values of the kinds \a RAPIDAtomicKind::STRING and \a RAPIDAtomicKind::TEXT are stored as strings (without the
+ * quotes of RAPID strings).
+ */
+using RAPIDAtomicValue = std::variant<bool, float, double, std::string>;
+
+/**
+ * \brief A RAPID value of any type (e.g. a user-defined record), laid out by a \a RAPIDSchema.
+ *
+ * The atomic values are stored in one contiguous arena, indexed by the schema's slots, so that parsing and
+ * constructing value strings updates the values in place, without reshaping the strings or looking up the schema.
+ */
+class RAPIDValue : public RAPIDSymbolDataAbstract
+{
+public:
+  /**
+   * \brief A constructor.
+   *
+   * \param schema the layout of the value (not null). All atomic values are default initialized.
+   */
+  explicit RAPIDValue(std::shared_ptr<RAPIDSchema const> schema);
+
+  /**
+   * \brief Retrieves the layout of the value.
+   */
+  RAPIDSchema const& schema() const noexcept
+  {
+    return *schema_;
+  }
+
+  /**
+   * \brief Accesses the value of an atomic node.
+   *
+   * \param node index of the atomic node in the schema.
+   *
+   * \return RAPIDAtomicValue& referring to the value.
+   *
+   * \throws invalid_argument when the node is not atomic.
+   */
+  RAPIDAtomicValue& at(std::size_t node);
+
+  /**
+   * \brief Accesses the value of an atomic node.
+   *
+   * \param node index of the atomic node in the schema.
+   *
+   * \return RAPIDAtomicValue const& referring to the value.
+   *
+   * \throws invalid_argument when the node is not atomic.
+   */
+  RAPIDAtomicValue const& at(std::size_t node) const;
+
+  /**
+   * \brief Accesses the value of an atomic node by its path, see \a RAPIDSchema::find().
+   */
+  RAPIDAtomicValue& at(std::string_view path)
+  {
+    return at(schema_->find(path));
+  }
+
+  /**
+   * \brief Accesses the value of an atomic node by its path, see \a RAPIDSchema::find().
+   */
+  RAPIDAtomicValue const& at(std::string_view path) const
+  {
+    return at(schema_->find(path));
+  }
+
+  /**
+   * \brief A method for constructing a RAPID symbol data value string.
+   *
+   * \return std::string containing the constructed string.
+   */
+  std::string constructString() const override;
+
+  /**
+   * \brief A method for constructing the value string of a subtree.
+   *
+   * \param node index of the subtree's root node.
+   *
+   * \return std::string containing the constructed string.
+   */
+  std::string constructString(std::size_t node) const;
+
+  /**
+   * \brief A method for parsing a RAPID symbol data value string.
+   *
+   * \param value_string containing the string to parse.
+   *
+   * \throws invalid_argument when the string does not match the schema.
+   */
+  void parseString(const std::string& value_string) override;
+
+  /**
+   * \brief A method for parsing a RAPID symbol data value string, without copying the item substrings.
+   *
+   * \param value_string containing the string to parse.
+   *
+   * \throws invalid_argument when the string does not match the schema.
+   */
+  void parseStringView(std::string_view value_string) override;
+
+  /**
+   * \brief A method for getting the type of the RAPID value (for arrays, the type of the elements).
+   *
+   * \return std::string containing the type.
+   */
+  std::string getType() const override;
+
+private:
+  /**
+   * \brief Parses the value string of a subtree.
+   *
+   * \return std::size_t containing the index of the node following the subtree.
+   */
+  std::size_t parseNode(std::size_t node, std::string_view value_string);
+
+  /**
+   * \brief Appends the value string of a subtree.
+   *
+   * \return std::size_t containing the index of the node following the subtree.
+   */
+  std::size_t constructNode(std::size_t node, std::string& result) const;
+
+  std::shared_ptr<RAPIDSchema const> schema_;
+  std::vector<RAPIDAtomicValue> values_;
+};
+}  // namespace abb::rws
@@ -0,0 +1,267 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace abb ::rws
+{
+/**
+ * \brief Phases of an HTTP request, as measured by \a RequestMetrics.
+ */
+enum class RequestPhase
+{
+  SEND_HEADER,   ///< Sending the request header. Includes connecting and the TLS handshake, if the session had to
+                 ///< (re)connect, since the HTTP session connects when it sends the header.
+  SEND_CONTENT,  ///< Sending the request content.
+  WAIT,          ///< Waiting for and receiving the response headers, i.e. controller processing and network round-trip.
+  RECEIVE,       ///< Receiving the response content.
+  PARSE,         ///< Parsing the response content into an XML document.
+  TOTAL          ///< Whole exchange, from sending the request until the response content has been received.
+};
+
+/**
+ * \brief Number of \a RequestPhase values.
+ */
+constexpr std::size_t REQUEST_PHASE_COUNT = 6;
+
+/**
+ * \brief Name of a request phase, as used in the Prometheus export.
+ */
+char const* requestPhaseName(RequestPhase phase) noexcept;
+
+/**
+ * \brief A latency histogram with fixed buckets.
+ */
+struct LatencyHistogram
+{
+  /**
+   * \brief Upper bounds of the buckets. Latencies above the last bound fall into an overflow bucket.
+   */
+  static constexpr std::array<std::chrono::microseconds::rep, 16> BUCKET_BOUNDS{
+    50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000, 2500000, 5000000
+  };
+
+  /**
+   * \brief Records a latency.
+   *
+   * \param latency the latency.
+   */
+  void record(std::chrono::nanoseconds latency) noexcept;
+
+  /**
+   * \brief Number of recorded latencies per bucket (not cumulative). The last element is the overflow bucket.
+   */
+  std::array<std::uint64_t, BUCKET_BOUNDS.size() + 1> bucket_counts{};
+
+  /**
+   * \brief Number of recorded latencies.
+   */
+  std::uint64_t count = 0;
+
+  /**
+   * \brief Sum of the recorded latencies.
+   */
+  std::chrono::nanoseconds sum{ 0 };
+};
+
+/**
+ * \brief Per-request latency breakdown and error counters of an HTTP client.
+ *
+ * Latencies are aggregated per endpoint, i.e. per HTTP method and URI template. The template is the request path
+ * without query and matrix parameters, in which the parameters of the known RWS resources (signal names, RAPID symbol
+ * paths, mechanical units, file paths, ...) are replaced by "{}" according to their position, e.g.
+ * "/rw/rapid/symbol/RAPID/T_ROB1/user/reg1/data" becomes "/rw/rapid/symbol/RAPID/{}/{}/{}/data".
+ *
+ * All methods are thread-safe. Recording is a no-op when the metrics are disabled.
+ */
+class RequestMetrics
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * \brief Timestamps of one HTTP exchange.
+   */
+  struct Timestamps
+  {
+    /**
+     * \brief Before sending the request.
+     */
+    Clock::time_point start;
+
+    /**
+     * \brief After the request header has been sent, including connecting if the session had to (re)connect.
+     */
+    Clock::time_point header_sent;
+
+    /**
+     * \brief After the request content has been sent.
+     */
+    Clock::time_point sent;
+
+    /**
+     * \brief After the response status line and headers have been received.
+     */
+    Clock::time_point headers_received;
+
+    /**
+     * \brief After the response content has been received.
+     */
+    Clock::time_point received;
+
+    /**
+     * \brief Indicates that the session had to (re)connect before sending the request header.
+     */
+    bool reconnected = false;
+  };
+
+  /**
+   * \brief Latency histograms of one endpoint, indexed by \a RequestPhase.
+   */
+  using EndpointStatistics = std::array<LatencyHistogram, REQUEST_PHASE_COUNT>;
+
+  /**
+   * \brief Identifies an endpoint.
+   */
+  struct Endpoint
+  {
+    std::string method;
+    std::string uri_template;
+
+    bool operator<(Endpoint const& other) const
+    {
+      return method < other.method || (method == other.method && uri_template < other.uri_template);
+    }
+  };
+
+  /**
+   * \brief Request counters.
+   */
+  struct Counters
+  {
+    /**
+     * \brief Number of requests that were sent again, after a server error or an authentication challenge.
+     */
+    std::uint64_t retries = 0;
+
+    /**
+     * \brief Number of 401 responses answered by re-authenticating.
+     */
+    std::uint64_t reauthentications = 0;
+
+    /**
+     * \brief Number of 5xx responses that caused a session reset.
+     */
+    std::uint64_t server_error_resets = 0;
+
+    /**
+     * \brief Number of requests failed due to communication errors.
+     */
+    std::uint64_t communication_errors = 0;
+
+    /**
+     * \brief Number of exchanges for which the session had to (re)connect.
+     */
+    std::uint64_t reconnects = 0;
+  };
+
+  /**
+   * \brief A constructor.
+   *
+   * \param enabled indicating if metrics are recorded.
+   */
+  explicit RequestMetrics(bool enabled = false);
+
+  /**
+   * \brief Enables or disables the recording.
+   */
+  void setEnabled(bool enabled) noexcept
+  {
+    enabled_.store(enabled, std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Indicates if metrics are recorded.
+   */
+  bool enabled() const noexcept
+  {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Records the phases of one HTTP exchange.
+   *
+   * \param method the request method.
+   * \param uri the request URI.
+   * \param timestamps the timestamps of the exchange.
+   */
+  void recordExchange(std::string const& method, std::string const& uri, Timestamps const& timestamps);
+
+  /**
+   * \brief Records the parse phase of a response.
+   *
+   * \param method the request method.
+   * \param uri the request URI.
+   * \param duration time spent parsing the response content.
+   */
+  void recordParse(std::string const& method, std::string const& uri, std::chrono::nanoseconds duration);
+
+  void countRetry() noexcept;
+  void countReauthentication() noexcept;
+  void countServerErrorReset() noexcept;
+  void countCommunicationError() noexcept;
+
+  /**
+   * \brief Retrieves the latency histograms of all endpoints.
+   */
+  std::map<Endpoint, EndpointStatistics> getEndpointStatistics() const;
+
+  /**
+   * \brief Retrieves the request counters.
+   */
+  Counters getCounters() const noexcept;
+
+  /**
+   * \brief Clears all histograms and counters.
+   */
+  void reset();
+
+  /**
+   * \brief Exports the metrics in the Prometheus text exposition format.
+   *
+   * \param prefix prefix of the metric names.
+   *
+   * \return the metrics as text.
+   */
+  std::string toPrometheusText(std::string const& prefix = "rws") const;
+
+  /**
+   * \brief Computes the URI template of a request URI.
+   *
+   * Paths that do not belong to a parameterized RWS resource are used verbatim.
+   *
+   * \param uri the request URI.
+   *
+   * \return the URI template.
+   */
+  static std::string uriTemplate(std::string const& uri);
+
+private:
+  std::atomic<bool> enabled_;
+
+  mutable std::mutex mutex_;
+  std::map<Endpoint, EndpointStatistics> endpoints_;
+
+  std::atomic<std::uint64_t> retries_{ 0 };
+  std::atomic<std::uint64_t> reauthentications_{ 0 };
+  std::atomic<std::uint64_t> server_error_resets_{ 0 };
+  std::atomic<std::uint64_t> communication_errors_{ 0 };
+  std::atomic<std::uint64_t> reconnects_{ 0 };
+};
+}  // namespace abb::rws
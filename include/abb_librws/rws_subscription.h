@@ -1,19 +1,27 @@
 #pragma once
 
 #include "rws_resource.h"
+#include "rws_rapid.h"
 #include "rws_websocket.h"
 #include "rws_error.h"
 
 #include <abb_librws/common/rw/rapid.h>
 #include <abb_librws/common/rw/panel.h>
 
+#include <Poco/Buffer.h>
 #include <Poco/DOM/DOMParser.h>
+#include <Poco/DOM/Document.h>
+#include <Poco/DOM/Node.h>
 #include <Poco/Net/WebSocket.h>
 
+#include <cstddef>
+#include <functional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 #include <utility>
+#include <variant>
 #include <future>
 #include <chrono>
 
@@ -110,7 +118,9 @@ public:
   /**
    * \brief Process subscription event.
    *
-   * Parses the event content \a content, determines event type, and calls the appropriate function in \a callback.
+   * Parses all event items in the content \a content, determines their types, and passes them in order to
+   * \a callback as one batch, see \a SubscriptionCallback::processEvents(). Items that cannot be decoded are skipped,
+   * and reported by a \a ProtocolError thrown after the batch has been passed, see processEventMessage().
    *
    * \param content XML content of the event
    * \param callback event callback
@@ -221,16 +231,156 @@ struct OperationModeEvent
   rw::OperationMode mode;
 };
 
+/**
+ * \brief Event received when the value of a RAPID symbol changes.
+ */
+struct RAPIDSymbolValueEvent
+{
+  /**
+   * \brief RAPID task name
+   */
+  std::string task;
+
+  /**
+   * \brief RAPID module name
+   */
+  std::string module;
+
+  /**
+   * \brief RAPID symbol name
+   */
+  std::string name;
+
+  /**
+   * \brief Raw value of the symbol in RAPID format, e.g. "[1,2,3]"
+   *
+   * Empty if the controller only reports that the value has changed; then read the value with
+   * getRAPIDSymbolData().
+   */
+  std::string value;
+};
+
+/**
+ * \brief Identifies the RAPID symbol of a value event by the event's resource URI.
+ *
+ * \param uri the resource URI, ".../RAPID/<task>/<module>/<name>[/data];value" (RWS 1.0 and 2.0).
+ *
+ * \return the event, with the task, module and name set and without value.
+ *
+ * \throw \a ProtocolError if the URI does not identify a RAPID symbol.
+ */
+RAPIDSymbolValueEvent parseRAPIDSymbolValueEventURI(std::string const& uri);
+
+/**
+ * \brief Any RWS subscription event.
+ */
+using SubscriptionEvent = std::variant<IOSignalStateEvent, RAPIDExecutionStateEvent, ControllerStateEvent,
+                                       OperationModeEvent, RAPIDSymbolValueEvent>;
+
 /**
  * \brief Defines callbacks for different types of RWS subscription events.
  */
 class SubscriptionCallback
 {
 public:
+  /**
+   * \brief Processes all events received in one WebSocket message, in the order in which the controller sent them.
+   *
+   * The controller coalesces events into one message when they occur faster than it sends them. The default
+   * implementation passes each event to the matching processEvent() overload. Override it to handle a batch as a
+   * whole, e.g. to take a lock or publish a snapshot once per message.
+   *
+   * \param events the decoded events.
+   */
+  virtual void processEvents(std::vector<SubscriptionEvent> const& events);
+
   virtual void processEvent(IOSignalStateEvent const& event);
   virtual void processEvent(RAPIDExecutionStateEvent const& event);
   virtual void processEvent(ControllerStateEvent const& event);
   virtual void processEvent(OperationModeEvent const& event);
+  virtual void processEvent(RAPIDSymbolValueEvent const& event);
+};
+
+/**
+ * \brief Decodes the items of a subscription event message and passes the decoded events to a callback as one batch.
+ *
+ * Each item is decoded on its own, so that an item that cannot be decoded (e.g. an event of a resource type that is
+ * not supported) does not discard the other events of the message.
+ *
+ * \param content XML content of the message.
+ * \param parse_event function decoding one "li" item. It throws if the item cannot be decoded.
+ * \param callback event callback.
+ *
+ * \throw \a ProtocolError if the message has no items, or, after the decoded events have been passed to \a callback,
+ * if some items could not be decoded.
+ */
+void processEventMessage(Poco::AutoPtr<Poco::XML::Document> const& content,
+                         std::function<SubscriptionEvent(Poco::XML::Node const*)> const& parse_event,
+                         SubscriptionCallback& callback);
+
+/**
+ * \brief Subscription callback that decodes the values of RAPID symbols into registered instances of
+ * \a RAPIDSymbolDataAbstract, so that subscribed symbols can be used like polled ones.
+ *
+ * The values are decoded on the thread delivering the events to the callback: the thread calling
+ * \a SubscriptionReceiver::waitForEvent(), a worker of the executor of a \a SubscriptionReactor, or the thread calling
+ * \a SubscriptionEventQueue::dispatch(). A reactor may run the callback on a different worker for each message, and
+ * concurrently if the callback is added for several subscriptions. The registered instances are written without
+ * locking, so synchronize any other access to them, and do not register or unregister symbols while events are
+ * being delivered.
+ */
+class RAPIDSymbolDecodingCallback : public SubscriptionCallback
+{
+public:
+  using SubscriptionCallback::processEvent;
+
+  /**
+   * \brief Registers an instance into which the values of a RAPID symbol are decoded.
+   *
+   * \param resource identifying the RAPID symbol.
+   * \param data the instance. It must outlive its registration.
+   */
+  void registerSymbol(RAPIDResource const& resource, RAPIDSymbolDataAbstract& data);
+
+  /**
+   * \brief Removes the registration of a RAPID symbol.
+   *
+   * \param resource identifying the RAPID symbol.
+   */
+  void unregisterSymbol(RAPIDResource const& resource);
+
+  /**
+   * \brief Decodes the value of a registered RAPID symbol and calls processDecodedEvent().
+   *
+   * Events of unregistered symbols and events without a value are ignored.
+   *
+   * \param event the RAPID symbol value event.
+   *
+   * The value is not validated against the registered instance's type. As with
+   * \a RAPIDSymbolDataAbstract::parseString(), a mismatching value is decoded leniently, e.g. a non-numeric value of a
+   * num as 0, and a record with a different number of components is left unchanged.
+   */
+  void processEvent(RAPIDSymbolValueEvent const& event) override;
+
+protected:
+  /**
+   * \brief Called after the value of a registered RAPID symbol has been decoded.
+   *
+   * \param event the RAPID symbol value event.
+   * \param data the registered instance, containing the decoded value.
+   */
+  virtual void processDecodedEvent(RAPIDSymbolValueEvent const& event, RAPIDSymbolDataAbstract& data);
+
+private:
+  /**
+   * \brief Key of a RAPID symbol: "task/module/name".
+   */
+  static std::string makeKey(std::string const& task, std::string const& module, std::string const& name);
+
+  /**
+   * \brief Registered instances, by symbol key.
+   */
+  std::unordered_map<std::string, RAPIDSymbolDataAbstract*> symbols_;
 };
 
 /**
@@ -291,14 +441,24 @@ private:
   static const std::chrono::microseconds DEFAULT_SUBSCRIPTION_TIMEOUT;
 
   /**
-   * \brief Static constant for the socket's buffer size.
+   * \brief Initial capacity of the message buffer.
    */
-  static const size_t BUFFER_SIZE = 1024;
+  static std::size_t constexpr INITIAL_BUFFER_SIZE = 1024;
 
   /**
-   * \brief A buffer for a Subscription.
+   * \brief Maximum size of a (reassembled) WebSocket message. Larger messages are discarded.
+   *
+   * With Poco 1.10 or later, it is also the WebSocket's maximum frame payload size, so that larger frames are rejected
+   * before they are allocated. With earlier versions, a single larger frame is allocated before being discarded.
+   */
+  static std::size_t constexpr MAX_MESSAGE_SIZE = 1024 * 1024;
+
+  /**
+   * \brief Buffer for reassembling the fragments of a WebSocket message.
+   *
+   * The buffer is reused for all messages, so that it only grows when a message is larger than all previous ones.
    */
-  char websocket_buffer_[BUFFER_SIZE];
+  Poco::Buffer<char> message_buffer_;
 
   SubscriptionManager& subscription_manager_;
 
@@ -312,7 +472,55 @@ private:
    */
   Poco::XML::DOMParser parser_;
 
-  bool webSocketReceiveFrame(WebSocketFrame& frame, std::chrono::microseconds timeout);
+  /**
+   * \brief Whether the fragments of a message are being received into \a message_buffer_.
+   */
+  bool in_message_ = false;
+
+  /**
+   * \brief Whether the message being received exceeds \a MAX_MESSAGE_SIZE, so that its fragments are discarded.
+   */
+  bool message_too_large_ = false;
+
+  /**
+   * \brief Result of receiving one WebSocket frame.
+   */
+  enum class FrameResult
+  {
+    PARTIAL,  ///< A control frame or a non-final fragment has been received.
+    MESSAGE,  ///< A message is complete in \a message_buffer_.
+    CLOSED    ///< The connection has been closed.
+  };
+
+  /**
+   * \brief Receives a complete WebSocket message into \a message_buffer_, reassembling fragmented messages and
+   * answering pings.
+   *
+   * \param timeout receive timeout
+   *
+   * \return true if a message has been received, false if the connection has been closed.
+   *
+   * \throw \a TimeoutError if waiting time exceeds \a timeout.
+   * \throw \a ProtocolError if the message is fragmented incorrectly or exceeds \a MAX_MESSAGE_SIZE.
+   */
+  bool webSocketReceiveMessage(std::chrono::microseconds timeout);
+
+  /**
+   * \brief Receives one WebSocket frame, within the receive timeout of the socket, appending its payload to the
+   * message being received.
+   *
+   * \return FrameResult telling whether a message is complete.
+   *
+   * \throw \a ProtocolError if the message is fragmented incorrectly or exceeds \a MAX_MESSAGE_SIZE.
+   */
+  FrameResult webSocketReceiveFrame();
+
+  /**
+   * \brief Decodes the message in \a message_buffer_ and passes its events to a callback.
+   */
+  void processMessage(SubscriptionCallback& callback);
+
+  friend class SubscriptionReactor;
 };
 
 /**
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <abb_librws/rws_subscription.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace abb ::rws
+{
+/**
+ * \brief Behavior of a full \a SubscriptionEventQueue.
+ */
+enum class SubscriptionOverflowPolicy
+{
+  /**
+   * \brief The producer waits until the consumer has made room.
+   */
+  BLOCK,
+
+  /**
+   * \brief The oldest queued event is dropped.
+   */
+  DROP_OLDEST,
+
+  /**
+   * \brief A queued event of the same resource (IO signal, RAPID symbol, execution state, controller state or
+   * operation mode) and source is always replaced by the new event, keeping its place in the queue, so that no stale
+   * states are queued. If the queue is full of other resources, the oldest queued event is dropped.
+   *
+   * Events carry no controller, so a queue shared by several controllers must be fed through one
+   * \a SubscriptionEventQueue::Source per controller. Otherwise the events of equally named resources of different
+   * controllers replace each other.
+   */
+  CONFLATE
+};
+
+/**
+ * \brief Counters of a \a SubscriptionEventQueue.
+ */
+struct SubscriptionEventQueueStatistics
+{
+  /**
+   * \brief Number of queued events.
+   */
+  std::size_t depth = 0;
+
+  /**
+   * \brief Largest number of queued events so far.
+   */
+  std::size_t max_depth = 0;
+
+  /**
+   * \brief Number of events dropped because the queue was full or closed.
+   */
+  std::size_t drops = 0;
+
+  /**
+   * \brief Number of queued events replaced by newer events of the same resource.
+   */
+  std::size_t conflations = 0;
+};
+
+/**
+ * \brief Bounded queue of subscription events between the thread receiving them and the thread consuming them, so
+ * that a slow consumer does not stall the WebSocket.
+ *
+ * The queue is a \a SubscriptionCallback: pass it to \a SubscriptionReceiver::waitForEvent() or
+ * \a SubscriptionReactor::add() to queue the received events, and call dispatch() on the consuming thread to pass
+ * them on to the application's callback.
+ *
+ * When several controllers share one queue, pass each controller's events through its own \a Source instead, so that
+ * conflation keeps them apart. The dispatched events do not tell their source, so use one queue per controller if the
+ * consumer needs to know it.
+ */
+class SubscriptionEventQueue : public SubscriptionCallback
+{
+public:
+  /**
+   * \brief A producer of a queue, queuing the events of one source (e.g. one controller) with its identifier.
+   *
+   * Pass it to \a SubscriptionReceiver::waitForEvent() or \a SubscriptionReactor::add() instead of the queue. Must not
+   * outlive the queue.
+   */
+  class Source : public SubscriptionCallback
+  {
+  public:
+    /**
+     * \brief A constructor.
+     *
+     * \param queue the queue.
+     * \param id identifier of the source, unique among the sources of the queue.
+     */
+    Source(SubscriptionEventQueue& queue, std::string id);
+
+    /**
+     * \brief Queues the events of a message, in order.
+     *
+     * \param events the events.
+     */
+    void processEvents(std::vector<SubscriptionEvent> const& events) override;
+
+  private:
+    SubscriptionEventQueue& queue_;
+    std::string const id_;
+  };
+
+  /**
+   * \brief A constructor.
+   *
+   * \param capacity maximum number of queued events (values less than 1 are treated as 1).
+   * \param policy behavior when the queue is full.
+   */
+  explicit SubscriptionEventQueue(std::size_t capacity,
+                                  SubscriptionOverflowPolicy policy = SubscriptionOverflowPolicy::BLOCK);
+
+  SubscriptionEventQueue(SubscriptionEventQueue const&) = delete;
+  SubscriptionEventQueue& operator=(SubscriptionEventQueue const&) = delete;
+
+  /**
+   * \brief Queues the events of a message, in order.
+   *
+   * \param events the events.
+   */
+  void processEvents(std::vector<SubscriptionEvent> const& events) override;
+
+  /**
+   * \brief Queues an event, applying the overflow policy if the queue is full.
+   *
+   * \param event the event.
+   * \param source identifier of the source of the event. Only events of the same source are conflated.
+   *
+   * \return true if the event has been queued, false if the queue is closed.
+   */
+  bool push(SubscriptionEvent event, std::string const& source = {});
+
+  /**
+   * \brief Waits for queued events and passes all of them to a callback, as one batch.
+   *
+   * \param callback the callback.
+   * \param timeout maximum time to wait for an event.
+   *
+   * \return std::size_t containing the number of dispatched events. 0 if the time has run out or the queue has been
+   * closed and is empty.
+   */
+  std::size_t dispatch(SubscriptionCallback& callback, std::chrono::microseconds timeout);
+
+  /**
+   * \brief Closes the queue, waking up waiting producers and consumers. Events queued afterwards are dropped, while
+   * the queued events can still be dispatched.
+   */
+  void close();
+
+  /**
+   * \brief Retrieves the counters.
+   */
+  SubscriptionEventQueueStatistics getStatistics() const;
+
+private:
+  /**
+   * \brief A slot of the ring buffer.
+   */
+  struct Entry
+  {
+    SubscriptionEvent event;
+
+    /**
+     * \brief Key of the event's resource, if the events are conflated.
+     */
+    std::string key;
+  };
+
+  /**
+   * \brief Key of the source and resource of an event, e.g. "1:" for the RAPID execution state or "0:DO_1" for an IO
+   * signal, prefixed by the length of the source and the source, e.g. "6:robot10:DO_1".
+   */
+  static std::string makeKey(std::string const& source, SubscriptionEvent const& event);
+
+  /**
+   * \brief Removes the oldest queued event. The mutex must be held.
+   */
+  Entry popFront();
+
+  SubscriptionOverflowPolicy const policy_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+
+  /**
+   * \brief Ring buffer of the queued events. The event with sequence number \a n is in slot \a n modulo the capacity.
+   */
+  std::vector<Entry> slots_;
+
+  /**
+   * \brief Sequence number of the oldest queued event.
+   */
+  std::size_t head_ = 0;
+
+  /**
+   * \brief Number of queued events.
+   */
+  std::size_t size_ = 0;
+
+  /**
+   * \brief Sequence numbers of the queued events, by resource key, if the events are conflated.
+   */
+  std::unordered_map<std::string, std::size_t> sequence_by_key_;
+
+  bool closed_ = false;
+  std::size_t max_depth_ = 0;
+  std::size_t drops_ = 0;
+  std::size_t conflations_ = 0;
+};
+}  // namespace abb::rws
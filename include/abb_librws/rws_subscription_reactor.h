@@ -0,0 +1,252 @@
+#pragma once
+
+#include <abb_librws/executor.h>
+#include <abb_librws/rws_subscription.h>
+
+#include <Poco/AutoPtr.h>
+#include <Poco/Net/Socket.h>
+#include <Poco/Net/SocketNotification.h>
+#include <Poco/Net/SocketReactor.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace abb ::rws
+{
+/**
+ * \brief Receives the events of any number of subscriptions, of any number of controllers, on a single thread.
+ *
+ * The reactor waits for all subscription WebSockets at once, receives their frames (answering pings, reassembling
+ * fragmented messages and detecting closed connections), and decodes the events on its own thread. The callbacks are
+ * dispatched on an executor: the events of one subscription are dispatched in order, one message at a time, while
+ * the events of different subscriptions can be dispatched concurrently on the executor's threads.
+ *
+ * This replaces one thread blocked in \a SubscriptionReceiver::waitForEvent() per subscription.
+ *
+ * Poco's WebSocket can only receive whole frames, so once the first bytes of a frame have arrived, the reactor thread
+ * blocks until the rest of the frame arrives, for at most the frame timeout. A controller sending a partial frame
+ * therefore delays the events of all other subscriptions for up to the frame timeout, after which its subscription is
+ * removed as failed. Subscriptions that must not be delayed by others can be given reactors of their own.
+ */
+class SubscriptionReactor
+{
+public:
+  /**
+   * \brief Handler of errors of a subscription, called on the executor.
+   *
+   * Receives the error: a \a CommunicationError if the controller closed the connection, or the exception thrown when
+   * receiving, decoding or dispatching a message.
+   */
+  using ErrorHandler = std::function<void(std::exception_ptr)>;
+
+  /**
+   * \brief Default maximum time to receive a WebSocket frame once its first bytes have arrived.
+   */
+  static const std::chrono::microseconds DEFAULT_FRAME_TIMEOUT;
+
+  /**
+   * \brief A constructor. Starts the reactor thread, with a pool of worker threads dispatching the callbacks.
+   *
+   * \param worker_count number of worker threads (values less than 1 are treated as 1).
+   * \param frame_timeout maximum time to receive a WebSocket frame once its first bytes have arrived, during which
+   * the other subscriptions are not received.
+   */
+  explicit SubscriptionReactor(std::size_t worker_count = 1,
+                               std::chrono::microseconds frame_timeout = DEFAULT_FRAME_TIMEOUT);
+
+  /**
+   * \brief A constructor. Starts the reactor thread, dispatching the callbacks on an executor.
+   *
+   * \param executor the executor. It must outlive the reactor.
+   * \param frame_timeout maximum time to receive a WebSocket frame once its first bytes have arrived, during which
+   * the other subscriptions are not received.
+   */
+  explicit SubscriptionReactor(Executor& executor, std::chrono::microseconds frame_timeout = DEFAULT_FRAME_TIMEOUT);
+
+  /**
+   * \brief Stops the reactor thread, waits for running callbacks to return and closes all WebSocket connections.
+   *
+   * Events that have not been dispatched yet are discarded.
+   */
+  ~SubscriptionReactor();
+
+  SubscriptionReactor(SubscriptionReactor const&) = delete;
+  SubscriptionReactor& operator=(SubscriptionReactor const&) = delete;
+
+  /**
+   * \brief Starts receiving the events of a subscription.
+   *
+   * \param receiver the receiver of the subscription, which is owned by the reactor from now on.
+   * \param callback the callback receiving the events. It must stay valid until the subscription is removed and its
+   * callbacks have returned, or until the reactor is destroyed.
+   * \param error_handler optional handler of errors. Errors of the connection also remove the subscription, while
+   * errors of single messages do not. Without a handler, the errors are logged to the standard error stream.
+   *
+   * \return std::size_t containing the id of the subscription in the reactor.
+   */
+  std::size_t add(std::unique_ptr<SubscriptionReceiver> receiver, SubscriptionCallback& callback,
+                  ErrorHandler error_handler = {});
+
+  /**
+   * \brief Stops receiving the events of a subscription and closes its WebSocket connection.
+   *
+   * Events that have not been dispatched yet are discarded. A callback that is already running may still return
+   * after this method. It does not delete the subscription from the controller.
+   *
+   * \param id the id returned by add(). Unknown ids are ignored.
+   */
+  void remove(std::size_t id);
+
+  /**
+   * \brief Retrieves the number of subscriptions.
+   */
+  std::size_t size() const;
+
+private:
+  /**
+   * \brief A subscription, and the callbacks waiting to be dispatched for it.
+   */
+  struct Subscription
+  {
+    Subscription(std::size_t id, std::unique_ptr<SubscriptionReceiver> receiver, SubscriptionCallback& callback,
+                 ErrorHandler error_handler);
+
+    std::size_t id;
+
+    /**
+     * \brief The receiver, held by pointer since its parser cannot be moved.
+     */
+    std::unique_ptr<SubscriptionReceiver> receiver;
+    SubscriptionCallback& callback;
+    ErrorHandler error_handler;
+
+    /**
+     * \brief Protects \a tasks, \a scheduled and \a removed.
+     */
+    std::mutex mutex;
+
+    /**
+     * \brief Callbacks waiting to be dispatched, in order.
+     */
+    std::deque<std::function<void()>> tasks;
+
+    /**
+     * \brief Whether a task dispatching \a tasks has been submitted to the executor.
+     */
+    bool scheduled = false;
+
+    /**
+     * \brief Whether the subscription has been removed, so that its callbacks are not dispatched anymore.
+     */
+    bool removed = false;
+  };
+
+  /**
+   * \brief Collects the decoded events of a message.
+   */
+  struct EventCollector : SubscriptionCallback
+  {
+    void processEvents(std::vector<SubscriptionEvent> const& events) override
+    {
+      this->events = events;
+    }
+
+    std::vector<SubscriptionEvent> events;
+  };
+
+  /**
+   * \brief Called by the reactor thread when a WebSocket can be read.
+   */
+  void onReadable(Poco::AutoPtr<Poco::Net::ReadableNotification> const& notification);
+
+  /**
+   * \brief Called by the reactor thread when a WebSocket has failed.
+   */
+  void onError(Poco::AutoPtr<Poco::Net::ErrorNotification> const& notification);
+
+  /**
+   * \brief Receives the available frames of a subscription, and dispatches the events of complete messages.
+   */
+  void receive(std::shared_ptr<Subscription> const& subscription);
+
+  /**
+   * \brief Removes a subscription whose connection has failed or been closed, and dispatches the error.
+   */
+  void fail(std::shared_ptr<Subscription> const& subscription, std::exception_ptr error);
+
+  /**
+   * \brief Finds the subscription of a socket.
+   *
+   * \return std::shared_ptr<Subscription> containing the subscription, or null if it has been removed.
+   */
+  std::shared_ptr<Subscription> find(Poco::Net::Socket const& socket) const;
+
+  /**
+   * \brief Stops waiting for the WebSocket of a subscription.
+   */
+  void unregister(Subscription& subscription);
+
+  /**
+   * \brief Discards the queued callbacks of a subscription and shuts its WebSocket connection down.
+   */
+  static void close(Subscription& subscription);
+
+  /**
+   * \brief Queues a callback of a subscription, and submits the dispatching of its queue if it is not running.
+   */
+  void post(std::shared_ptr<Subscription> const& subscription, std::function<void()> task);
+
+  /**
+   * \brief Dispatches the queued callbacks of a subscription, on the executor.
+   */
+  void dispatch(Subscription& subscription);
+
+  /**
+   * \brief Passes an error to the error handler of a subscription, or logs it.
+   */
+  static void handleError(Subscription const& subscription, std::exception_ptr error) noexcept;
+
+  /**
+   * \brief Maximum time to receive a WebSocket frame once its first bytes have arrived.
+   */
+  std::chrono::microseconds const frame_timeout_;
+
+  /**
+   * \brief Executor owned by the reactor, if it has not been given one.
+   */
+  std::unique_ptr<ThreadPoolExecutor> own_executor_;
+
+  /**
+   * \brief Executor dispatching the callbacks.
+   */
+  Executor& executor_;
+
+  /**
+   * \brief Protects \a subscriptions_, \a sockets_ and \a next_id_.
+   */
+  mutable std::mutex mutex_;
+  std::unordered_map<std::size_t, std::shared_ptr<Subscription>> subscriptions_;
+  std::map<Poco::Net::Socket, std::shared_ptr<Subscription>> sockets_;
+  std::size_t next_id_ = 0;
+
+  /**
+   * \brief Number of dispatching tasks submitted to the executor and not finished yet.
+   */
+  std::size_t dispatching_ = 0;
+  std::mutex dispatching_mutex_;
+  std::condition_variable dispatching_done_;
+
+  Poco::Net::SocketReactor reactor_;
+  std::thread thread_;
+};
+}  // namespace abb::rws
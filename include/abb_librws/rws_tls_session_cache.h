@@ -0,0 +1,101 @@
+#pragma once
+
+#include <Poco/Net/Context.h>
+#include <Poco/Net/HTTPSClientSession.h>
+#include <Poco/Net/Session.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace abb ::rws
+{
+/**
+ * \brief Counters of TLS handshakes.
+ */
+struct TLSHandshakeCount
+{
+  /**
+   * \brief Number of full handshakes.
+   */
+  std::size_t full = 0;
+
+  /**
+   * \brief Number of abbreviated handshakes, resuming a previously negotiated TLS session.
+   */
+  std::size_t resumed = 0;
+};
+
+/**
+ * \brief Creates HTTPS sessions sharing one SSL context and resuming each other's TLS sessions.
+ *
+ * All sessions created by the cache (e.g. the pooled HTTP sessions and the subscription WebSocket sessions) offer
+ * the most recently negotiated TLS session to the server when connecting, so that reconnects and new connections
+ * only need an abbreviated handshake. Full and resumed handshakes are counted.
+ */
+class TLSSessionCache
+{
+public:
+  /**
+   * \brief A constructor.
+   *
+   * \param cipher_list OpenSSL cipher list used by the SSL context.
+   */
+  explicit TLSSessionCache(std::string const& cipher_list);
+
+  TLSSessionCache(TLSSessionCache const&) = delete;
+  TLSSessionCache& operator=(TLSSessionCache const&) = delete;
+
+  /**
+   * \brief Creates a new (not yet connected) HTTPS session.
+   *
+   * \param host the server's host name or IP address.
+   * \param port the server's port.
+   *
+   * \return the new session. It must not outlive the cache.
+   */
+  std::unique_ptr<Poco::Net::HTTPSClientSession> createSession(std::string const& host, Poco::UInt16 port);
+
+  /**
+   * \brief The shared SSL context.
+   */
+  Poco::Net::Context::Ptr context() const noexcept
+  {
+    return context_;
+  }
+
+  /**
+   * \brief Retrieves the TLS handshake counters.
+   */
+  TLSHandshakeCount getHandshakeCount() const noexcept
+  {
+    return { full_handshakes_.load(std::memory_order_relaxed), resumed_handshakes_.load(std::memory_order_relaxed) };
+  }
+
+private:
+  class ResumingSession;
+
+  /**
+   * \brief Called by the sessions after each connect (and handshake).
+   *
+   * \param tls_session the TLS session negotiated by the handshake.
+   * \param resumed indicating if the handshake resumed a previous TLS session.
+   */
+  void connected(Poco::Net::Session::Ptr tls_session, bool resumed);
+
+  /**
+   * \brief Most recently negotiated TLS session (null if none).
+   */
+  Poco::Net::Session::Ptr latestSession() const;
+
+  Poco::Net::Context::Ptr context_;
+
+  mutable std::mutex mutex_;
+  Poco::Net::Session::Ptr latest_session_;
+
+  std::atomic<std::size_t> full_handshakes_{ 0 };
+  std::atomic<std::size_t> resumed_handshakes_{ 0 };
+};
+}  // namespace abb::rws
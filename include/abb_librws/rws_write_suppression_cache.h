@@ -0,0 +1,225 @@
+#pragma once
+
+#include <abb_librws/rws_resource.h>
+#include <abb_librws/rws_subscription.h>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace abb ::rws
+{
+/**
+ * \brief Counters of a \a WriteSuppressionCache.
+ */
+struct WriteSuppressionStatistics
+{
+  /**
+   * \brief Number of writes skipped because the value was already confirmed.
+   */
+  std::size_t suppressed = 0;
+
+  /**
+   * \brief Number of writes sent to the controller while the cache was enabled.
+   */
+  std::size_t written = 0;
+
+  /**
+   * \brief Number of confirmed values removed by invalidation (single values or the whole cache).
+   */
+  std::size_t invalidations = 0;
+};
+
+/**
+ * \brief Thread-safe cache of the last confirmed values of RAPID symbols and IO signals, used to skip writes of values
+ * that are already on the controller.
+ *
+ * A value is confirmed by a successful write, or by an observation such as a read or a subscription event. The cache
+ * cannot see changes made by the RAPID program or by other clients, so it is disabled by default and should only be
+ * enabled for resources written exclusively by this client, or be kept coherent with update() and invalidate().
+ */
+class WriteSuppressionCache
+{
+public:
+  WriteSuppressionCache() = default;
+  WriteSuppressionCache(WriteSuppressionCache const&) = delete;
+  WriteSuppressionCache& operator=(WriteSuppressionCache const&) = delete;
+
+  /**
+   * \brief Enables or disables the cache. Disabling it also clears it.
+   *
+   * \param enabled whether writes of confirmed values are skipped.
+   */
+  void setEnabled(bool enabled);
+
+  /**
+   * \brief Checks whether the cache is enabled.
+   */
+  bool isEnabled() const noexcept
+  {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Checks whether a write of a RAPID symbol can be skipped, counting it as suppressed if so.
+   *
+   * \param resource identifying the RAPID symbol.
+   * \param value the serialized value to write.
+   *
+   * \return true if the cache is enabled and \a value is the symbol's confirmed value.
+   */
+  bool suppress(RAPIDResource const& resource, std::string const& value);
+
+  /**
+   * \brief Checks whether a write of an IO signal can be skipped, counting it as suppressed if so.
+   *
+   * \param resource identifying the IO signal.
+   * \param value the value to write.
+   *
+   * \return true if the cache is enabled and \a value is the signal's confirmed value.
+   */
+  bool suppress(IOSignalResource const& resource, std::string const& value);
+
+  /**
+   * \brief Records a successful write of a RAPID symbol.
+   *
+   * \param resource identifying the RAPID symbol.
+   * \param value the serialized value written.
+   */
+  void confirm(RAPIDResource const& resource, std::string const& value);
+
+  /**
+   * \brief Records a successful write of an IO signal.
+   *
+   * \param resource identifying the IO signal.
+   * \param value the value written.
+   */
+  void confirm(IOSignalResource const& resource, std::string const& value);
+
+  /**
+   * \brief Writes a value, unless the write is suppressed.
+   *
+   * A successful write confirms the value. A failed write invalidates the confirmed value, since the write may or may
+   * not have reached the controller.
+   *
+   * \param resource identifying the RAPID symbol or IO signal.
+   * \param value the serialized value to write.
+   * \param write_function function performing the write.
+   *
+   * \return true if the value has been written, false if the write has been suppressed.
+   */
+  template <typename Resource, typename WriteFunction>
+  bool write(Resource const& resource, std::string const& value, WriteFunction&& write_function)
+  {
+    if (suppress(resource, value))
+      return false;
+
+    try
+    {
+      std::forward<WriteFunction>(write_function)();
+    }
+    catch (...)
+    {
+      invalidate(resource);
+      throw;
+    }
+
+    confirm(resource, value);
+    return true;
+  }
+
+  /**
+   * \brief Records the value of a RAPID symbol read from the controller.
+   *
+   * \param resource identifying the RAPID symbol.
+   * \param value the serialized value read.
+   */
+  void observe(RAPIDResource const& resource, std::string const& value);
+
+  /**
+   * \brief Records the value of an IO signal read from the controller.
+   *
+   * \param resource identifying the IO signal.
+   * \param value the value read.
+   */
+  void observe(IOSignalResource const& resource, std::string const& value);
+
+  /**
+   * \brief Records the value of an IO signal reported by a subscription.
+   *
+   * \param event the IO signal state event.
+   */
+  void update(IOSignalStateEvent const& event);
+
+  /**
+   * \brief Records the value of a RAPID symbol reported by a subscription. Events without a value are ignored.
+   *
+   * \param event the RAPID symbol value event.
+   */
+  void update(RAPIDSymbolValueEvent const& event);
+
+  /**
+   * \brief Removes the confirmed value of a RAPID symbol, e.g. after the RAPID program has changed it.
+   *
+   * \param resource identifying the RAPID symbol.
+   */
+  void invalidate(RAPIDResource const& resource);
+
+  /**
+   * \brief Removes the confirmed value of an IO signal.
+   *
+   * \param resource identifying the IO signal.
+   */
+  void invalidate(IOSignalResource const& resource);
+
+  /**
+   * \brief Removes all confirmed values.
+   */
+  void clear();
+
+  /**
+   * \brief Retrieves the counters.
+   */
+  WriteSuppressionStatistics getStatistics() const noexcept
+  {
+    return { suppressed_.load(std::memory_order_relaxed), written_.load(std::memory_order_relaxed),
+             invalidations_.load(std::memory_order_relaxed) };
+  }
+
+private:
+  using ValueMap = std::unordered_map<std::string, std::string>;
+
+  /**
+   * \brief Checks a value against the confirmed value of a key, counting a match as suppressed.
+   */
+  bool suppress(ValueMap const& values, std::string const& key, std::string const& value);
+
+  /**
+   * \brief Sets the confirmed value of a key.
+   */
+  void confirm(ValueMap& values, std::string key, std::string const& value);
+
+  /**
+   * \brief Removes the confirmed value of a key, counting it as invalidated if there was one.
+   */
+  void invalidate(ValueMap& values, std::string const& key);
+
+  /**
+   * \brief Key of a RAPID symbol: "task/module/name".
+   */
+  static std::string makeKey(RAPIDResource const& resource);
+
+  std::atomic<bool> enabled_{ false };
+
+  mutable std::mutex mutex_;
+  ValueMap rapid_symbols_;
+  ValueMap io_signals_;
+
+  std::atomic<std::size_t> suppressed_{ 0 };
+  std::atomic<std::size_t> written_{ 0 };
+  std::atomic<std::size_t> invalidations_{ 0 };
+};
+}  // namespace abb::rws
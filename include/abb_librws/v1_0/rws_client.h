@@ -36,12 +36,14 @@
 
 #pragma once
 
-#include <Poco/DOM/DOMParser.h>
+#include <Poco/DOM/Document.h>
+#include <Poco/AutoPtr.h>
 #include <Poco/Net/HTTPClientSession.h>
 
 #include <abb_librws/system_constants.h>
 #include <abb_librws/rws_rapid.h>
 #include <abb_librws/rws_poco_client.h>
+#include <abb_librws/parsing.h>
 #include <abb_librws/rws_resource.h>
 #include <abb_librws/rws_subscription.h>
 #include <abb_librws/coordinate.h>
@@ -105,6 +107,20 @@ public:
    */
   RWSResult getConfigurationInstances(const std::string& topic, const std::string& type);
 
+  /**
+   * \brief A method for extracting the attributes of the configuration instances of a type, belonging to a specific
+   * configuration topic, in a single streaming pass over the response.
+   *
+   * \param topic specifying the configuration topic.
+   * \param type specifying the type in the configuration topic.
+   * \param on_attribute called with the name and value of each instance attribute, in document order.
+   * \param on_instance called with the instance name, after the last attribute of each instance.
+   *
+   * \throw \a RWSError if something goes wrong.
+   */
+  void getConfigurationInstances(const std::string& topic, const std::string& type,
+                                 XMLFieldCallback const& on_attribute, XMLRecordCallback const& on_instance);
+
   /**
    * \brief A method for retrieving static information about a mechanical unit.
    *
@@ -196,6 +212,30 @@ public:
    */
   void deleteFile(const FileResource& resource);
 
+  /**
+   * \brief Retrieves the HTTP communication log as a text string.
+   *
+   * \note Logging is disabled unless enabled with \a ConnectionOptions::log_mode or \a setHTTPLogMode().
+   *
+   * \param verbose indicating if the log text should be verbose or not.
+   *
+   * \return std::string containing the log text. An empty text string is returned if the log is empty.
+   */
+  std::string getHTTPLogText(bool verbose = false) const
+  {
+    return http_client_.getLogText(verbose);
+  }
+
+  /**
+   * \brief Changes the HTTP communication logging mode.
+   *
+   * \param mode logging mode.
+   * \param content_limit maximum number of response content bytes logged per request in \a HTTPLogMode::FULL.
+   */
+  void setHTTPLogMode(HTTPLogMode mode, std::size_t content_limit = 4096)
+  {
+    http_client_.setLogMode(mode, content_limit);
+  }
 
   /**
    * \brief A method for registering a user as local.
@@ -276,10 +316,11 @@ public:
   POCOResult httpDelete(const std::string& uri);
 
 
-private:
   /**
    * \brief Method for parsing a communication result into an XML document.
    *
+   * The parse time is recorded in the request metrics (if enabled).
+   *
    * \param result containing the result of the parsing.
    *
    * \return parsed content of \a poco_result.
@@ -288,12 +329,52 @@ private:
    */
   RWSResult parseContent(const POCOResult& poco_result);
 
+  /**
+   * \brief Method for extracting fields from a communication result in a single streaming pass, without building
+   * an XML document.
+   *
+   * The parse time is recorded in the request metrics (if enabled).
+   *
+   * \param poco_result containing the communication result.
+   * \param query specifying the records and fields to extract.
+   * \param on_field called for each extracted field.
+   * \param on_record called at the end of each record (optional).
+   *
+   * \throw \a RWSError if something goes wrong.
+   */
+  void extractContent(const POCOResult& poco_result, XMLExtractQuery const& query, XMLFieldCallback const& on_field,
+                      XMLRecordCallback const& on_record = {});
+
+  /**
+   * \brief Per-request latency metrics and error counters of the HTTP communication.
+   *
+   * \note Metrics are only recorded if enabled with \a ConnectionOptions::request_metrics or
+   *       \a RequestMetrics::setEnabled().
+   */
+  RequestMetrics& metrics() noexcept
+  {
+    return http_client_.metrics();
+  }
+
+private:
+
 
   /**
    * \brief A method for logging out the currently active RWS session.
    */
   void logout();
 
+  /**
+   * \brief Decodes one item of a subscription event message.
+   *
+   * \param li_node the "li" element of the item.
+   *
+   * \return SubscriptionEvent containing the decoded event.
+   *
+   * \throw \a ProtocolError if the item cannot be decoded.
+   */
+  static SubscriptionEvent parseEvent(Poco::XML::Node const* li_node);
+
   /**
    * \brief Method for generating a configuration URI path.
    *
@@ -323,9 +404,7 @@ private:
   static std::string generateFilePath(const FileResource& resource);
 
   ConnectionOptions const connectionOptions_;
-  Poco::Net::HTTPClientSession session_;
   POCOClient http_client_;
-  Poco::XML::DOMParser parser_;
 };
 
 } // end namespace rws
@@ -42,6 +42,7 @@
 #include <abb_librws/rws.h>
 #include <abb_librws/rws_cfg.h>
 #include <abb_librws/rws_subscription.h>
+#include <abb_librws/rws_write_suppression_cache.h>
 #include <abb_librws/rws_info.h>
 #include <abb_librws/xml_attribute.h>
 
@@ -377,6 +378,20 @@ public:
    */
   void setRAPIDSymbolData(RAPIDResource const& resource, const RAPIDSymbolDataAbstract& data);
 
+  /**
+   * \brief Cache of the last written RAPID symbol and IO signal values, used to skip writes of unchanged values.
+   *
+   * The cache is disabled by default, see \a WriteSuppressionCache. It is cleared when this interface resets the
+   * program pointer or loads or unloads RAPID modules.
+   *
+   * The values of IO signals and RAPID symbols read synchronously by this interface are recorded in the cache, so that
+   * a read of a value changed by others lets the next write of the previous value through.
+   */
+  WriteSuppressionCache& writeSuppressionCache() noexcept
+  {
+    return write_suppression_cache_;
+  }
+
   /**
    * \brief A method for starting RAPID execution in the robot controller.
    *
@@ -589,10 +604,25 @@ private:
    */
   void setIOSignal(const std::string& iosignal, const std::string& value);
 
+  /**
+   * \brief A method for setting the data of a RAPID symbol in raw text format, unless the write is suppressed.
+   *
+   * \param resource identifying the RAPID symbol.
+   * \param data containing the RAPID symbol's new data.
+   *
+   * \throw \a std::runtime_error if something goes wrong.
+   */
+  void writeRAPIDSymbolData(RAPIDResource const& resource, const std::string& data);
+
   /**
    * \brief The RWS client used to communicate with the robot controller.
    */
   RWSClient& rws_client_;
+
+  /**
+   * \brief Last confirmed values of the written RAPID symbols and IO signals.
+   */
+  WriteSuppressionCache write_suppression_cache_;
 };
 
 }  // namespace abb::rws::v1_0
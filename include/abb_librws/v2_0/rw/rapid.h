@@ -4,8 +4,11 @@
 #include <abb_librws/v2_0/rws.h>
 
 #include <abb_librws/common/rw/rapid.h>
+#include <abb_librws/rws_rapid_value.h>
 
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace abb ::rws ::v2_0 ::rw
 {
@@ -115,6 +118,60 @@ void getRAPIDSymbolData(RWSClient& client, RAPIDResource const& resource, RAPIDS
  */
 std::string getRAPIDSymbolData(RWSClient& client, RAPIDResource const& resource);
 
+/**
+ * \brief A function for retrieving the dimensions of a RAPID array symbol.
+ *
+ * \param client RWS client
+ * \param resource specifies the RAPID task, module, and symbol name for the RAPID resource.
+ *
+ * \return The size of each dimension of the array. Empty if the symbol is not an array.
+ *
+ * \throw \a RWSError if something goes wrong.
+ */
+std::vector<std::size_t> getRAPIDSymbolDimensions(RWSClient& client, RAPIDResource const& resource);
+
+/**
+ * \brief A function for retrieving the layout of a RAPID symbol, e.g. of a user-defined record type.
+ *
+ * The layout of the symbol's data type is discovered from the type and record component properties, recursively, and
+ * cached by the client, so it is retrieved only once per type. Use the result to construct \a RAPIDValue objects,
+ * which can then be read and written like any other RAPID data.
+ *
+ * \param client RWS client
+ * \param resource specifies the RAPID task, module, and symbol name for the RAPID resource.
+ *
+ * \return The layout of the symbol (an array layout, if the symbol is an array).
+ *
+ * \throw \a RWSError if something goes wrong.
+ */
+std::shared_ptr<RAPIDSchema const> getRAPIDSymbolSchema(RWSClient& client, RAPIDResource const& resource);
+
+/**
+ * \brief A function for retrieving a range of elements of a one-dimensional RAPID array symbol.
+ *
+ * The array is first resized to the size of the RAPID array (from the symbol properties). Then only the elements in
+ * the range are transferred, addressed as e.g. "reg{3}". Elements outside of the range are left unchanged.
+ *
+ * RWS addresses single array elements, so each element in the range is a separate request. The requests are
+ * submitted to the client's executor, so they overlap up to the size of the HTTP session pool. When the range covers
+ * more than half of the array, the whole array is read in one request instead, and only the elements in the range are
+ * updated.
+ *
+ * Blocks until the reads have completed, so it must not be called from a completion handler or another task running
+ * on the client's executor (see \a RWSClient::executor()).
+ *
+ * \param client RWS client
+ * \param resource specifies the RAPID task, module, and symbol name for the RAPID resource.
+ * \param data variable for receiving the elements.
+ * \param range specifying the elements to retrieve.
+ *
+ * \throw \a std::invalid_argument if the RAPID symbol is not a one-dimensional array of the element type.
+ * \throw \a std::out_of_range if the range exceeds the size of the RAPID array.
+ * \throw \a RWSError if something else goes wrong.
+ */
+void getRAPIDSymbolData(RWSClient& client, RAPIDResource const& resource, RAPIDDynamicArrayAbstract& data,
+                        RAPIDArrayRange const& range);
+
 /**
  * \brief A function for setting the data of a RAPID symbol (based on the provided struct representing the RAPID data).
  *
@@ -132,6 +189,33 @@ std::string getRAPIDSymbolData(RWSClient& client, RAPIDResource const& resource)
 void setRAPIDSymbolData(RWSClient& client, const RAPIDResource& resource, const RAPIDSymbolDataAbstract& data,
                         bool initval = false, bool log = true, Mastership const& mastership = Mastership::Implicit);
 
+/**
+ * \brief A function for setting a range of elements of a one-dimensional RAPID array symbol.
+ *
+ * Only the elements in the range are transferred, addressed as e.g. "reg{3}". Each element is a separate request,
+ * submitted to the client's executor, so the requests overlap up to the size of the HTTP session pool.
+ *
+ * The writes are not atomic: if a write fails, the other writes still complete, so the RAPID array is left partially
+ * updated, and the error of the first failed write is thrown. The elements are written in no particular order.
+ *
+ * Blocks until the writes have completed, so it must not be called from a completion handler or another task running
+ * on the client's executor (see \a RWSClient::executor()).
+ *
+ * \param client RWS client
+ * \param resource specifying the RAPID task, module and symbol names for the RAPID resource.
+ * \param data containing the elements to set.
+ * \param range specifying the elements to set.
+ * \param initval true -- set the initial value, false -- set the current value.
+ * \param log changes will be updated in elog (not applicable in updating initial value)
+ * \param mastership {implicit | explicit} by default mastership is explicit
+ *
+ * \throw \a std::out_of_range if the range exceeds the size of \a data.
+ * \throw \a RWSError if something else goes wrong.
+ */
+void setRAPIDSymbolData(RWSClient& client, const RAPIDResource& resource, const RAPIDDynamicArrayAbstract& data,
+                        RAPIDArrayRange const& range, bool initval = false, bool log = true,
+                        Mastership const& mastership = Mastership::Implicit);
+
 /**
  * \brief A function for setting the data of a RAPID symbol.
  *
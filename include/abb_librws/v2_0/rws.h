@@ -47,6 +47,11 @@ struct ABB_LIBRWS_EXPORT XMLAttributes
    */
   static const XMLAttribute CLASS_DATTYP;
 
+  /**
+   * \brief Class & array dimensions.
+   */
+  static const XMLAttribute CLASS_DIM;
+
   /**
    * \brief Class & excstate type.
    */
@@ -57,6 +62,11 @@ struct ABB_LIBRWS_EXPORT XMLAttributes
    */
   static const XMLAttribute CLASS_IOS_SIGNAL;
 
+  /**
+   * \brief Class & linked type (of an alias type).
+   */
+  static const XMLAttribute CLASS_LINKTYP;
+
   /**
    * \brief Class & lvalue.
    */
@@ -82,6 +92,11 @@ struct ABB_LIBRWS_EXPORT XMLAttributes
    */
   static const XMLAttribute CLASS_RAP_MODULE_INFO_LI;
 
+  /**
+   * \brief Class & rap-sympropreccomp-li.
+   */
+  static const XMLAttribute CLASS_RAP_SYMPROPRECCOMP_LI;
+
   /**
    * \brief Class & rap-task-li.
    */
@@ -107,11 +122,21 @@ struct ABB_LIBRWS_EXPORT XMLAttributes
    */
   static const XMLAttribute CLASS_SYS_SYSTEM_LI;
 
+  /**
+   * \brief Class & symbol type.
+   */
+  static const XMLAttribute CLASS_SYMTYP;
+
   /**
    * \brief Class & type.
    */
   static const XMLAttribute CLASS_TYPE;
 
+  /**
+   * \brief Class & data type URL.
+   */
+  static const XMLAttribute CLASS_TYPURL;
+
   /**
    * \brief Class & value.
    */
@@ -173,6 +198,11 @@ struct ABB_LIBRWS_EXPORT Identifiers
    */
   static const std::string DATTYP;
 
+  /**
+   * \brief Array dimensions.
+   */
+  static const std::string DIM;
+
   /**
    * \brief Execution state type.
    */
@@ -188,6 +218,11 @@ struct ABB_LIBRWS_EXPORT Identifiers
    */
   static const std::string IOS_SIGNAL;
 
+  /**
+   * \brief Linked type (of an alias type).
+   */
+  static const std::string LINKTYP;
+
   /**
    * \brief Mechanical unit.
    */
@@ -243,6 +278,11 @@ struct ABB_LIBRWS_EXPORT Identifiers
    */
   static const std::string RAP_MODULE_INFO_LI;
 
+  /**
+   * \brief RAPID record component properties list item.
+   */
+  static const std::string RAP_SYMPROPRECCOMP_LI;
+
   /**
    * \brief RAPID task list item.
    */
@@ -283,6 +323,11 @@ struct ABB_LIBRWS_EXPORT Identifiers
    */
   static const std::string SYS_SYSTEM_LI;
 
+  /**
+   * \brief Symbol type.
+   */
+  static const std::string SYMTYP;
+
   /**
    * \brief Title.
    */
@@ -293,6 +338,11 @@ struct ABB_LIBRWS_EXPORT Identifiers
    */
   static const std::string TYPE;
 
+  /**
+   * \brief Data type URL.
+   */
+  static const std::string TYPURL;
+
   /**
    * \brief Value.
    */
@@ -440,6 +490,11 @@ struct ABB_LIBRWS_EXPORT Resources
    */
   static const std::string RW_RAPID_SYMBOL_PROPERTIES_RAPID;
 
+  /**
+   * \brief RAPID symbol search.
+   */
+  static const std::string RW_RAPID_SYMBOLS_SEARCH;
+
   /**
    * \brief RAPID tasks.
    */
@@ -36,19 +36,26 @@
 
 #pragma once
 
-#include <Poco/DOM/DOMParser.h>
+#include <Poco/DOM/Document.h>
+#include <Poco/AutoPtr.h>
 #include <Poco/Net/HTTPSClientSession.h>
 
 #include <abb_librws/system_constants.h>
 #include <abb_librws/rws_rapid.h>
+#include <abb_librws/rws_rapid_symbol_cache.h>
 #include <abb_librws/rws_poco_client.h>
+#include <abb_librws/parsing.h>
+#include <abb_librws/rws_tls_session_cache.h>
 #include <abb_librws/rws_resource.h>
 #include <abb_librws/rws_subscription.h>
 #include <abb_librws/coordinate.h>
 #include <abb_librws/connection_options.h>
+#include <abb_librws/executor.h>
 #include <abb_librws/v2_0/rws.h>
 
+#include <future>
 #include <map>
+#include <memory>
 
 namespace abb ::rws ::v2_0
 {
@@ -76,13 +83,19 @@ public:
    * \brief A constructor.
    *
    * \param connection_options RWS connection options.
+   * \param executor executor running the asynchronous requests. If null, the client creates a \a ThreadPoolExecutor
+   *  with one thread per pooled HTTP session. The executor can be shared with other clients.
    *
    * \throw \a RWSError if something goes wrong.
    */
-  explicit RWSClient(ConnectionOptions const& connection_options);
+  explicit RWSClient(ConnectionOptions const& connection_options, std::shared_ptr<Executor> executor = nullptr);
 
   /**
-   * \brief Logs out the currently active RWS session.
+   * \brief Waits for the pending asynchronous requests of this client and their completion handlers, including those
+   * still queued on the executor, and logs out the currently active RWS session.
+   *
+   * The client must not be destroyed by one of its own asynchronous requests or completion handlers, which would wait
+   * for itself.
    */
   ~RWSClient();
 
@@ -107,6 +120,20 @@ public:
    */
   RWSResult getConfigurationInstances(const std::string& topic, const std::string& type);
 
+  /**
+   * \brief A method for extracting the attributes of the configuration instances of a type, belonging to a specific
+   * configuration topic, in a single streaming pass over the response.
+   *
+   * \param topic specifying the configuration topic.
+   * \param type specifying the type in the configuration topic.
+   * \param on_attribute called with the name and value of each instance attribute, in document order.
+   * \param on_instance called with the instance name, after the last attribute of each instance.
+   *
+   * \throw \a RWSError if something goes wrong.
+   */
+  void getConfigurationInstances(const std::string& topic, const std::string& type,
+                                 XMLFieldCallback const& on_attribute, XMLRecordCallback const& on_instance);
+
   /**
    * \brief A method for retrieving all available IO signals on the controller.
    *
@@ -242,6 +269,39 @@ public:
     http_client_.setTimeout(timeout);
   }
 
+  /**
+   * \brief Retrieves the number of full and resumed TLS handshakes of the HTTP and subscription connections.
+   */
+  TLSHandshakeCount getTLSHandshakeCount() const noexcept
+  {
+    return tls_sessions_.getHandshakeCount();
+  }
+
+  /**
+   * \brief Retrieves the HTTP communication log as a text string.
+   *
+   * \note Logging is disabled unless enabled with \a ConnectionOptions::log_mode or \a setHTTPLogMode().
+   *
+   * \param verbose indicating if the log text should be verbose or not.
+   *
+   * \return std::string containing the log text. An empty text string is returned if the log is empty.
+   */
+  std::string getHTTPLogText(bool verbose = false) const
+  {
+    return http_client_.getLogText(verbose);
+  }
+
+  /**
+   * \brief Changes the HTTP communication logging mode.
+   *
+   * \param mode logging mode.
+   * \param content_limit maximum number of response content bytes logged per request in \a HTTPLogMode::FULL.
+   */
+  void setHTTPLogMode(HTTPLogMode mode, std::size_t content_limit = 4096)
+  {
+    http_client_.setLogMode(mode, content_limit);
+  }
+
   /**
    * \brief A method for registering a user as local.
    *
@@ -320,10 +380,94 @@ RWSClient::RWSResult authenticateController();
    */
   POCOResult httpDelete(const std::string& uri);
 
-private:
+  /**
+   * \brief Asynchronously sends a HTTP GET request and checks the response status.
+   *
+   * \param uri for the URI (path and query).
+   *
+   * \return future of the result.
+   */
+  std::future<POCOResult> httpGetAsync(const std::string& uri);
+
+  /**
+   * \brief Asynchronously sends a HTTP GET request and checks the response status.
+   *
+   * \param uri for the URI (path and query).
+   * \param completion handler called on the executor when the request has completed.
+   */
+  void httpGetAsync(const std::string& uri, Completion<POCOResult> completion);
+
+  /**
+   * \brief Asynchronously sends a HTTP POST request and checks the response status.
+   *
+   * \param uri for the URI (path and query).
+   * \param content for the request's content.
+   * \param content_type for the request's content type.
+   *
+   * \return future of the result.
+   */
+  std::future<POCOResult> httpPostAsync(const std::string& uri, const std::string& content = "",
+                                        const std::string& content_type = "");
+
+  /**
+   * \brief Asynchronously sends a HTTP PUT request and checks the response status.
+   *
+   * \param uri for the URI (path and query).
+   * \param content for the request's content.
+   * \param content_type for the request's content type.
+   *
+   * \return future of the result.
+   */
+  std::future<POCOResult> httpPutAsync(const std::string& uri, const std::string& content = "",
+                                       const std::string& content_type = "");
+
+  /**
+   * \brief Asynchronously sends a HTTP DELETE request and checks the response status.
+   *
+   * \param uri for the URI (path and query).
+   *
+   * \return future of the result.
+   */
+  std::future<POCOResult> httpDeleteAsync(const std::string& uri);
+
+  /**
+   * \brief Asynchronously retrieves the current value of an IO signal.
+   *
+   * \param iosignal for the IO signal's name.
+   *
+   * \return future of the result.
+   */
+  std::future<RWSResult> getIOSignalAsync(const std::string& iosignal);
+
+  /**
+   * \brief Asynchronously retrieves the current value of an IO signal.
+   *
+   * \param iosignal for the IO signal's name.
+   * \param completion handler called on the executor when the request has completed.
+   */
+  void getIOSignalAsync(const std::string& iosignal, Completion<RWSResult> completion);
+
+  /**
+   * \brief The executor running the asynchronous requests.
+   *
+   * Independent requests submitted to the executor are overlapped, up to the size of the HTTP session pool. Tasks
+   * submitted to it are waited for by the destructor.
+   *
+   * A task or completion handler running on the executor must not block on the result of another task of the same
+   * executor, e.g. call \a std::future::get() on the result of an asynchronous request, or a synchronous method
+   * implemented with asynchronous requests, such as the batch \a RWSInterface::getRAPIDSymbolData(). Once all of the
+   * executor's threads are blocked this way, the awaited tasks never run and the threads deadlock.
+   */
+  Executor& executor() const noexcept
+  {
+    return executor_;
+  }
+
   /**
    * \brief Method for parsing a communication result into an XML document.
    *
+   * The parse time is recorded in the request metrics (if enabled).
+   *
    * \param result containing the result of the parsing.
    *
    * \return parsed content of \a poco_result.
@@ -332,11 +476,59 @@ private:
    */
   RWSResult parseContent(const POCOResult& poco_result);
 
+  /**
+   * \brief Method for extracting fields from a communication result in a single streaming pass, without building
+   * an XML document.
+   *
+   * The parse time is recorded in the request metrics (if enabled).
+   *
+   * \param poco_result containing the communication result.
+   * \param query specifying the records and fields to extract.
+   * \param on_field called for each extracted field.
+   * \param on_record called at the end of each record (optional).
+   *
+   * \throw \a RWSError if something goes wrong.
+   */
+  void extractContent(const POCOResult& poco_result, XMLExtractQuery const& query, XMLFieldCallback const& on_field,
+                      XMLRecordCallback const& on_record = {});
+
+  /**
+   * \brief Per-request latency metrics and error counters of the HTTP communication.
+   *
+   * \note Metrics are only recorded if enabled with \a ConnectionOptions::request_metrics or
+   *       \a RequestMetrics::setEnabled().
+   */
+  RequestMetrics& metrics() noexcept
+  {
+    return http_client_.metrics();
+  }
+
+  /**
+   * \brief Cache of validated RAPID symbol information, used by the typed RAPID symbol reads.
+   */
+  RAPIDSymbolCache& rapidSymbolCache() noexcept
+  {
+    return rapid_symbol_cache_;
+  }
+
+private:
+
   /**
    * \brief A method for logging out the currently active RWS session.
    */
   void logout();
 
+  /**
+   * \brief Decodes one item of a subscription event message.
+   *
+   * \param li_node the "li" element of the item.
+   *
+   * \return SubscriptionEvent containing the decoded event.
+   *
+   * \throw \a ProtocolError if the item cannot be decoded.
+   */
+  static SubscriptionEvent parseEvent(Poco::XML::Node const* li_node);
+
   /**
    * \brief Method for generating a configuration URI path.
    *
@@ -375,10 +567,16 @@ private:
   static std::string generateFilePath(const FileResource& resource);
 
   ConnectionOptions const connectionOptions_;
-  Poco::Net::Context::Ptr context_;
-  Poco::Net::HTTPSClientSession session_;
+  TLSSessionCache tls_sessions_;
   POCOClient http_client_;
-  Poco::XML::DOMParser parser_;
   std::map<std::string, int> mastership_count_;
+  RAPIDSymbolCache rapid_symbol_cache_;
+
+  /**
+   * \brief Executor running the asynchronous requests, keeping track of them so that the destructor can wait for them.
+   *
+   * Declared last, so that an owned thread pool is joined before the rest of the client is destroyed.
+   */
+  mutable TrackingExecutor executor_;
 };
 }  // namespace abb::rws::v2_0
\ No newline at end of file
@@ -41,11 +41,16 @@
 #include <abb_librws/v2_0/rws.h>
 #include <abb_librws/common/rw/io.h>
 #include <abb_librws/rws_subscription.h>
+#include <abb_librws/rws_write_suppression_cache.h>
 #include <abb_librws/rws_info.h>
 #include <abb_librws/xml_attribute.h>
 
 #include <chrono>
 #include <cstdint>
+#include <exception>
+#include <future>
+#include <utility>
+#include <vector>
 
 namespace abb ::rws ::v2_0
 {
@@ -222,6 +227,41 @@ public:
   RobTarget getMechanicalUnitRobTarget(const std::string& mechunit, Coordinate coordinate = Coordinate::ACTIVE,
                                        const std::string& tool = "", const std::string& wobj = "");
 
+  /**
+   * \brief Asynchronously retrieves the current jointtarget values of a mechanical unit.
+   *
+   * \param mechunit for the mechanical unit's name.
+   *
+   * \return future of the jointtarget data.
+   */
+  std::future<JointTarget> getMechanicalUnitJointTargetAsync(const std::string& mechunit);
+
+  /**
+   * \brief Asynchronously retrieves the current robtarget values of a mechanical unit.
+   *
+   * \param mechunit for the mechanical unit's name.
+   * \param coordinate for the coordinate mode (base, world, tool, or wobj) in which the robtarget will be reported.
+   * \param tool for the tool frame relative to which the robtarget will be reported.
+   * \param wobj for the work object (wobj) relative to which the robtarget will be reported.
+   *
+   * \return future of the robtarget data.
+   */
+  std::future<RobTarget> getMechanicalUnitRobTargetAsync(const std::string& mechunit,
+                                                         Coordinate coordinate = Coordinate::ACTIVE,
+                                                         const std::string& tool = "", const std::string& wobj = "");
+
+  /**
+   * \brief Asynchronously retrieves the current robtarget values of a mechanical unit.
+   *
+   * \param mechunit for the mechanical unit's name.
+   * \param coordinate for the coordinate mode (base, world, tool, or wobj) in which the robtarget will be reported.
+   * \param tool for the tool frame relative to which the robtarget will be reported.
+   * \param wobj for the work object (wobj) relative to which the robtarget will be reported.
+   * \param completion handler called on the executor when the request has completed.
+   */
+  void getMechanicalUnitRobTargetAsync(const std::string& mechunit, Coordinate coordinate, const std::string& tool,
+                                       const std::string& wobj, Completion<RobTarget> completion);
+
   /**
    * \brief A method for retrieving the data of a RAPID symbol in raw text format.
    *
@@ -247,6 +287,51 @@ public:
    */
   void getRAPIDSymbolData(RAPIDResource const& resource, RAPIDSymbolDataAbstract& data);
 
+  /**
+   * \brief Asynchronously retrieves the data of a RAPID symbol in raw text format.
+   *
+   * \param resource specifies the RAPID task, module and symbol name.
+   *
+   * \return future of the data.
+   */
+  std::future<std::string> getRAPIDSymbolDataAsync(RAPIDResource const& resource);
+
+  /**
+   * \brief Asynchronously retrieves the data of a RAPID symbol (parsed into a struct representing the RAPID data).
+   *
+   * \param resource specifies the RAPID task, module and symbol name.
+   * \param data for storing the retrieved RAPID symbol data. Must not be accessed until the operation has completed.
+   *
+   * \return future signalling the completion of the operation.
+   */
+  std::future<void> getRAPIDSymbolDataAsync(RAPIDResource const& resource, RAPIDSymbolDataAbstract& data);
+
+  /**
+   * \brief Asynchronously retrieves the data of a RAPID symbol (parsed into a struct representing the RAPID data).
+   *
+   * \param resource specifies the RAPID task, module and symbol name.
+   * \param data for storing the retrieved RAPID symbol data. Must not be accessed until the operation has completed.
+   * \param completion handler called on the executor when the operation has completed.
+   */
+  void getRAPIDSymbolDataAsync(RAPIDResource const& resource, RAPIDSymbolDataAbstract& data,
+                               Completion<void> completion);
+
+  /**
+   * \brief Retrieves the data of many RAPID symbols (parsed into structs representing the RAPID data).
+   *
+   * The reads are submitted to the client's executor, so they overlap up to the size of the HTTP session pool, and
+   * each symbol is parsed as soon as its response arrives. A failing read does not abort the other reads.
+   *
+   * Blocks until the reads have completed, so it must not be called from a completion handler or another task running
+   * on the client's executor (see \a RWSClient::executor()).
+   *
+   * \param symbols pairs of the RAPID resource and the struct for storing its data (not null).
+   *
+   * \return one entry per symbol, in the same order: null on success, otherwise the error of the read.
+   */
+  std::vector<std::exception_ptr>
+  getRAPIDSymbolData(std::vector<std::pair<RAPIDResource, RAPIDSymbolDataAbstract*>> const& symbols);
+
   /**
    * \brief A method for retrieving information about the RAPID modules of a RAPID task defined in the robot controller.
    *
@@ -369,6 +454,21 @@ public:
    */
   void setRAPIDSymbolData(RAPIDResource const& resource, const RAPIDSymbolDataAbstract& data);
 
+  /**
+   * \brief Cache of the last written RAPID symbol and IO signal values, used to skip writes of unchanged values.
+   *
+   * The cache is disabled by default, see \a WriteSuppressionCache. It is cleared when this interface resets the
+   * program pointer.
+   *
+   * The values of IO signals and RAPID symbols read by this interface, synchronously, asynchronously or in a batch, are
+   * recorded in the cache, so that a read of a value changed by others lets the next write of the previous value
+   * through.
+   */
+  WriteSuppressionCache& writeSuppressionCache() noexcept
+  {
+    return write_suppression_cache_;
+  }
+
   /**
    * \brief A method for starting RAPID execution in the robot controller.
    *
@@ -582,10 +682,25 @@ private:
    */
   void setIOSignal(const std::string& iosignal, const std::string& value);
 
+  /**
+   * \brief A method for setting the data of a RAPID symbol in raw text format, unless the write is suppressed.
+   *
+   * \param resource identifying the RAPID symbol.
+   * \param data containing the RAPID symbol's new data.
+   *
+   * \throw \a std::runtime_error if something goes wrong.
+   */
+  void writeRAPIDSymbolData(RAPIDResource const& resource, const std::string& data);
+
   /**
    * \brief The RWS client used to communicate with the robot controller.
    */
   RWSClient& rws_client_;
+
+  /**
+   * \brief Last confirmed values of the written RAPID symbols and IO signals.
+   */
+  WriteSuppressionCache write_suppression_cache_;
 };
 
 }  // namespace abb::rws::v2_0
@@ -376,12 +376,19 @@ public:
   /**
    * \brief Representation of a custom RAPID record, for settings to EGMSetupUC RAPID instructions.
    */
-  struct EGMSetupUCSettings : public RAPIDRecord
+  struct EGMSetupUCSettings : public RAPIDRecordTemplate<EGMSetupUCSettings>
   {
-    EGMSetupUCSettings() : RAPIDRecord("EGMSetupUCSettings")
+    /**
+     * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
+     */
+    static constexpr char const* RECORD_TYPE_NAME = "EGMSetupUCSettings";
+
+    /**
+     * \brief The record's components, in the order of the RAPID record declaration.
+     */
+    static constexpr auto fields()
     {
-      components_.push_back(&use_filtering);
-      components_.push_back(&comm_timeout);
+      return std::make_tuple(&EGMSetupUCSettings::use_filtering, &EGMSetupUCSettings::comm_timeout);
     }
 
     /**
@@ -401,51 +408,23 @@ public:
   /**
    * \brief Representation of a custom RAPID record, for settings to EGMAct RAPID instructions.
    */
-  struct EGMActivateSettings : public RAPIDRecord
+  struct EGMActivateSettings : public RAPIDRecordTemplate<EGMActivateSettings>
   {
   public:
     /**
-     * \brief A default constructor.
+     * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
      */
-    EGMActivateSettings() : RAPIDRecord("EGMActivateSettings")
-    {
-      components_.push_back(&tool);
-      components_.push_back(&wobj);
-      components_.push_back(&correction_frame);
-      components_.push_back(&sensor_frame);
-      components_.push_back(&cond_min_max);
-      components_.push_back(&lp_filter);
-      components_.push_back(&sample_rate);
-      components_.push_back(&max_speed_deviation);
-    };
+    static constexpr char const* RECORD_TYPE_NAME = "EGMActivateSettings";
 
     /**
-     * \brief Copy constructor.
-     *
-     * \param other containing the values to copy.
+     * \brief The record's components, in the order of the RAPID record declaration.
      */
-    EGMActivateSettings(const EGMActivateSettings& other) : RAPIDRecord(other.record_type_name_)
+    static constexpr auto fields()
     {
-      if (this != &other)
-      {
-        tool = other.tool;
-        wobj = other.wobj;
-        correction_frame = other.correction_frame;
-        sensor_frame = other.sensor_frame;
-        cond_min_max = other.cond_min_max;
-        lp_filter = other.lp_filter;
-        sample_rate = other.sample_rate;
-        max_speed_deviation = other.max_speed_deviation;
-        components_.clear();
-        components_.push_back(&tool);
-        components_.push_back(&wobj);
-        components_.push_back(&correction_frame);
-        components_.push_back(&sensor_frame);
-        components_.push_back(&cond_min_max);
-        components_.push_back(&lp_filter);
-        components_.push_back(&sample_rate);
-        components_.push_back(&max_speed_deviation);
-      }
+      return std::make_tuple(&EGMActivateSettings::tool, &EGMActivateSettings::wobj,
+                             &EGMActivateSettings::correction_frame, &EGMActivateSettings::sensor_frame,
+                             &EGMActivateSettings::cond_min_max, &EGMActivateSettings::lp_filter,
+                             &EGMActivateSettings::sample_rate, &EGMActivateSettings::max_speed_deviation);
     }
 
     /**
@@ -503,38 +482,20 @@ public:
   /**
    * \brief Representation of a custom RAPID record, for settings to EGMRun RAPID instructions.
    */
-  struct EGMRunSettings : public RAPIDRecord
+  struct EGMRunSettings : public RAPIDRecordTemplate<EGMRunSettings>
   {
     /**
-     * \brief A default constructor.
+     * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
      */
-    EGMRunSettings() : RAPIDRecord("EGMRunSettings")
-    {
-      components_.push_back(&cond_time);
-      components_.push_back(&ramp_in_time);
-      components_.push_back(&offset);
-      components_.push_back(&pos_corr_gain);
-    }
+    static constexpr char const* RECORD_TYPE_NAME = "EGMRunSettings";
 
     /**
-     * \brief Copy constructor.
-     *
-     * \param other containing the values to copy.
+     * \brief The record's components, in the order of the RAPID record declaration.
      */
-    EGMRunSettings(const EGMRunSettings& other) : RAPIDRecord(other.record_type_name_)
+    static constexpr auto fields()
     {
-      if (this != &other)
-      {
-        cond_time = other.cond_time;
-        ramp_in_time = other.ramp_in_time;
-        offset = other.offset;
-        pos_corr_gain = other.pos_corr_gain;
-        components_.clear();
-        components_.push_back(&cond_time);
-        components_.push_back(&ramp_in_time);
-        components_.push_back(&offset);
-        components_.push_back(&pos_corr_gain);
-      }
+      return std::make_tuple(&EGMRunSettings::cond_time, &EGMRunSettings::ramp_in_time, &EGMRunSettings::offset,
+                             &EGMRunSettings::pos_corr_gain);
     }
 
     /**
@@ -563,14 +524,19 @@ public:
   /**
    * \brief Representation of a custom RAPID record, for settings to EGMStop RAPID instructions.
    */
-  struct EGMStopSettings : public RAPIDRecord
+  struct EGMStopSettings : public RAPIDRecordTemplate<EGMStopSettings>
   {
     /**
-     * \brief A default constructor.
+     * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
      */
-    EGMStopSettings() : RAPIDRecord("EGMStopSettings")
+    static constexpr char const* RECORD_TYPE_NAME = "EGMStopSettings";
+
+    /**
+     * \brief The record's components, in the order of the RAPID record declaration.
+     */
+    static constexpr auto fields()
     {
-      components_.push_back(&ramp_out_time);
+      return std::make_tuple(&EGMStopSettings::ramp_out_time);
     }
 
     /**
@@ -582,44 +548,20 @@ public:
   /**
    * \brief Representation of a custom RAPID record, for settings to EGM RAPID instructions.
    */
-  struct EGMSettings : public RAPIDRecord
+  struct EGMSettings : public RAPIDRecordTemplate<EGMSettings>
   {
     /**
-     * \brief A default constructor.
+     * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
      */
-    EGMSettings() : RAPIDRecord("EGMSettings")
-    {
-      components_.push_back(&allow_egm_motions);
-      components_.push_back(&use_presync);
-      components_.push_back(&setup_uc);
-      components_.push_back(&activate);
-      components_.push_back(&run);
-      components_.push_back(&stop);
-    }
+    static constexpr char const* RECORD_TYPE_NAME = "EGMSettings";
 
     /**
-     * \brief Copy constructor.
-     *
-     * \param other containing the values to copy.
+     * \brief The record's components, in the order of the RAPID record declaration.
      */
-    EGMSettings(const EGMSettings& other) : RAPIDRecord(other.record_type_name_)
+    static constexpr auto fields()
     {
-      if (this != &other)
-      {
-        allow_egm_motions = other.allow_egm_motions;
-        use_presync = other.use_presync;
-        setup_uc = other.setup_uc;
-        activate = other.activate;
-        run = other.run;
-        stop = other.stop;
-        components_.clear();
-        components_.push_back(&allow_egm_motions);
-        components_.push_back(&use_presync);
-        components_.push_back(&setup_uc);
-        components_.push_back(&activate);
-        components_.push_back(&run);
-        components_.push_back(&stop);
-      }
+      return std::make_tuple(&EGMSettings::allow_egm_motions, &EGMSettings::use_presync, &EGMSettings::setup_uc,
+                             &EGMSettings::activate, &EGMSettings::run, &EGMSettings::stop);
     }
 
     /**
@@ -658,16 +600,19 @@ public:
   /**
    * \brief Representation of a custom RAPID record, for settings to SmartGripper RAPID instructions.
    */
-  struct SGSettings : public RAPIDRecord
+  struct SGSettings : public RAPIDRecordTemplate<SGSettings>
   {
     /**
-     * \brief A default constructor.
+     * \brief The name of the RAPID record type (i.e. its name in the RAPID code).
+     */
+    static constexpr char const* RECORD_TYPE_NAME = "SGSettings";
+
+    /**
+     * \brief The record's components, in the order of the RAPID record declaration.
      */
-    SGSettings() : RAPIDRecord("SGSettings")
+    static constexpr auto fields()
     {
-      components_.push_back(&max_speed);
-      components_.push_back(&hold_force);
-      components_.push_back(&physical_limit);
+      return std::make_tuple(&SGSettings::max_speed, &SGSettings::hold_force, &SGSettings::physical_limit);
     }
 
     /**
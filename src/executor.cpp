@@ -0,0 +1,131 @@
+#include <abb_librws/executor.h>
+
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <utility>
+
+namespace abb ::rws
+{
+/***********************************************************************************************************************
+ * Class definitions: ThreadPoolExecutor
+ */
+
+ThreadPoolExecutor::ThreadPoolExecutor(std::size_t thread_count)
+{
+  thread_count = std::max<std::size_t>(thread_count, 1);
+  threads_.reserve(thread_count);
+
+  for (std::size_t i = 0; i < thread_count; ++i)
+    threads_.emplace_back([this] { run(); });
+}
+
+ThreadPoolExecutor::~ThreadPoolExecutor()
+{
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+    stopping_ = true;
+  }
+
+  task_available_.notify_all();
+
+  for (auto& thread : threads_)
+    thread.join();
+}
+
+void ThreadPoolExecutor::execute(std::function<void()> task)
+{
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+    tasks_.push_back(std::move(task));
+  }
+
+  task_available_.notify_one();
+}
+
+void ThreadPoolExecutor::run()
+{
+  for (;;)
+  {
+    std::function<void()> task;
+
+    {
+      std::unique_lock<std::mutex> lock{ mutex_ };
+      task_available_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+
+      if (tasks_.empty())
+        return;
+
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+
+    try
+    {
+      task();
+    }
+    catch (std::exception const& e)
+    {
+      // A throwing task must not terminate the worker thread.
+      std::cerr << "Exception in ThreadPoolExecutor task: " << e.what() << std::endl;
+    }
+    catch (...)
+    {
+      std::cerr << "Unknown exception in ThreadPoolExecutor task" << std::endl;
+    }
+  }
+}
+
+/***********************************************************************************************************************
+ * Class definitions: TrackingExecutor
+ */
+
+TrackingExecutor::TrackingExecutor(std::shared_ptr<Executor> executor) : executor_{ std::move(executor) }
+{
+}
+
+void TrackingExecutor::execute(std::function<void()> task)
+{
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+    ++pending_;
+  }
+
+  try
+  {
+    executor_->execute([this, task = std::move(task)] {
+      try
+      {
+        task();
+      }
+      catch (...)
+      {
+        finish();
+        throw;
+      }
+
+      finish();
+    });
+  }
+  catch (...)
+  {
+    finish();
+    throw;
+  }
+}
+
+void TrackingExecutor::wait()
+{
+  std::unique_lock<std::mutex> lock{ mutex_ };
+  finished_.wait(lock, [this] { return pending_ == 0; });
+}
+
+void TrackingExecutor::finish()
+{
+  // Notify while holding the lock, since the waiting thread may destroy this object as soon as it is released.
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  if (--pending_ == 0)
+    finished_.notify_all();
+}
+}  // namespace abb::rws
@@ -0,0 +1,1613 @@
+#include <abb_librws/mock/mock_controller.h>
+#include <abb_librws/v1_0/rws.h>
+#include <abb_librws/v2_0/rws.h>
+#include <abb_librws/parsing.h>
+#include <abb_librws/system_constants.h>
+
+#include <Poco/DigestEngine.h>
+#include <Poco/MD5Engine.h>
+#include <Poco/Net/Context.h>
+#include <Poco/Net/HTTPAuthenticationParams.h>
+#include <Poco/Net/HTTPBasicCredentials.h>
+#include <Poco/Net/HTTPCookie.h>
+#include <Poco/Net/HTTPRequestHandler.h>
+#include <Poco/Net/HTTPRequestHandlerFactory.h>
+#include <Poco/Net/HTTPServerParams.h>
+#include <Poco/Net/NameValueCollection.h>
+#include <Poco/Net/NetException.h>
+#include <Poco/Net/SecureServerSocket.h>
+#include <Poco/Net/ServerSocket.h>
+#include <Poco/Net/SocketAddress.h>
+#include <Poco/Net/WebSocket.h>
+#include <Poco/StreamCopier.h>
+#include <Poco/String.h>
+#include <Poco/URI.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+
+namespace abb ::rws ::mock
+{
+using namespace Poco::Net;
+
+namespace
+{
+char const SESSION_COOKIE[] = "-http-session-";
+char const ABBCX_COOKIE[] = "ABBCX";
+char const REALM[] = "validusers@robotcontroller.com";
+
+/**
+ * \brief Interval in which a subscription WebSocket is checked for incoming frames while no events are pending.
+ */
+std::chrono::milliseconds const POLL_INTERVAL{ 50 };
+
+bool startsWith(std::string const& str, std::string const& prefix)
+{
+  return str.compare(0, prefix.size(), prefix) == 0;
+}
+
+bool endsWith(std::string const& str, std::string const& suffix)
+{
+  return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+std::string md5(std::string const& text)
+{
+  Poco::MD5Engine engine;
+  engine.update(text);
+  return Poco::DigestEngine::digestToHex(engine.digest());
+}
+
+/**
+ * \brief Computes the expected "response" parameter of digest credentials (RFC 2617, MD5 with qop "auth").
+ */
+std::string digestResponse(std::string const& method, HTTPAuthenticationParams const& params,
+                           std::string const& password)
+{
+  std::string const ha1 = md5(params.get("username", "") + ':' + REALM + ':' + password);
+  std::string const ha2 = md5(method + ':' + params.get("uri", ""));
+
+  return md5(ha1 + ':' + params.get("nonce", "") + ':' + params.get("nc", "") + ':' + params.get("cnonce", "") + ':' +
+             params.get("qop", "") + ':' + ha2);
+}
+
+template <typename T>
+std::string toString(T const& value)
+{
+  std::ostringstream ss;
+  ss << value;
+  return ss.str();
+}
+
+std::string escape(std::string const& text)
+{
+  std::string escaped;
+  escaped.reserve(text.size());
+
+  for (char c : text)
+  {
+    switch (c)
+    {
+      case '&':
+        escaped += "&amp;";
+        break;
+      case '<':
+        escaped += "&lt;";
+        break;
+      case '>':
+        escaped += "&gt;";
+        break;
+      case '"':
+        escaped += "&quot;";
+        break;
+      default:
+        escaped += c;
+    }
+  }
+
+  return escaped;
+}
+
+std::string span(std::string const& class_name, std::string const& text)
+{
+  return "<span class=\"" + class_name + "\">" + escape(text) + "</span>";
+}
+
+std::string link(std::string const& href)
+{
+  return "<a href=\"" + escape(href) + "\" rel=\"self\"></a>";
+}
+
+std::string li(std::string const& class_name, std::string const& title, std::string const& content)
+{
+  return "<li class=\"" + class_name + "\" title=\"" + escape(title) + "\">" + content + "</li>";
+}
+
+/**
+ * \brief Parses an "application/x-www-form-urlencoded" string (request content or query) into (name, value) pairs.
+ */
+std::vector<std::pair<std::string, std::string>> parseFormPairs(std::string const& form)
+{
+  std::vector<std::pair<std::string, std::string>> pairs;
+
+  std::size_t position = 0;
+  while (position < form.size())
+  {
+    std::size_t const end = std::min(form.find('&', position), form.size());
+    std::string const field = form.substr(position, end - position);
+
+    if (!field.empty())
+    {
+      std::size_t const equals = field.find('=');
+      std::string name;
+      std::string value;
+
+      Poco::URI::decode(field.substr(0, equals), name);
+      if (equals != std::string::npos)
+        Poco::URI::decode(field.substr(equals + 1), value);
+
+      pairs.emplace_back(std::move(name), std::move(value));
+    }
+
+    position = end + 1;
+  }
+
+  return pairs;
+}
+
+std::map<std::string, std::string> parseForm(std::string const& form)
+{
+  std::map<std::string, std::string> fields;
+
+  for (auto& [name, value] : parseFormPairs(form))
+    fields[name] = std::move(value);
+
+  return fields;
+}
+
+std::string formValue(std::map<std::string, std::string> const& form, std::string const& name)
+{
+  auto const it = form.find(name);
+  return it != form.end() ? it->second : "";
+}
+
+/**
+ * \brief Splits the path of a RAPID symbol resource (below "/rw/rapid/symbol/") into the symbol's
+ * "task/module/name" key and the requested part ("data", "properties" or empty).
+ *
+ * Both the RWS 1.0 ("data/RAPID/T_ROB1/user/reg1") and the RWS 2.0 ("RAPID/T_ROB1/user/reg1/data") forms are
+ * accepted.
+ *
+ * \return the key, or an empty string if the path is invalid.
+ */
+std::string parseSymbolPath(std::string path, std::string& part)
+{
+  part.clear();
+
+  for (std::string const prefix : { "data/", "properties/" })
+  {
+    if (startsWith(path, prefix))
+    {
+      part = prefix.substr(0, prefix.size() - 1);
+      path.erase(0, prefix.size());
+    }
+  }
+
+  if (!startsWith(path, "RAPID/"))
+    return "";
+
+  path.erase(0, 6);
+
+  if (part.empty())
+  {
+    for (std::string const suffix : { "/data", "/properties" })
+    {
+      if (endsWith(path, suffix))
+      {
+        part = suffix.substr(1);
+        path.erase(path.size() - suffix.size());
+      }
+    }
+  }
+
+  return std::count(path.begin(), path.end(), '/') == 2 ? path : "";
+}
+
+void respond(HTTPServerResponse& response, HTTPResponse::HTTPStatus status, std::string const& content = "",
+          std::string const& content_type = "")
+{
+  response.setStatusAndReason(status);
+
+  if (!content_type.empty())
+    response.setContentType(content_type);
+
+  response.sendBuffer(content.data(), content.size());
+}
+
+std::vector<std::pair<std::string, std::string>> jointTargetSpans(JointTarget const& value)
+{
+  return { { "rax_1", value.robax.rax_1.constructString() }, { "rax_2", value.robax.rax_2.constructString() },
+           { "rax_3", value.robax.rax_3.constructString() }, { "rax_4", value.robax.rax_4.constructString() },
+           { "rax_5", value.robax.rax_5.constructString() }, { "rax_6", value.robax.rax_6.constructString() },
+           { "eax_a", value.extax.eax_a.constructString() }, { "eax_b", value.extax.eax_b.constructString() },
+           { "eax_c", value.extax.eax_c.constructString() }, { "eax_d", value.extax.eax_d.constructString() },
+           { "eax_e", value.extax.eax_e.constructString() }, { "eax_f", value.extax.eax_f.constructString() } };
+}
+
+std::vector<std::pair<std::string, std::string>> robTargetSpans(RobTarget const& value)
+{
+  return { { "x", value.pos.x.constructString() },          { "y", value.pos.y.constructString() },
+           { "z", value.pos.z.constructString() },          { "q1", value.orient.q1.constructString() },
+           { "q2", value.orient.q2.constructString() },     { "q3", value.orient.q3.constructString() },
+           { "q4", value.orient.q4.constructString() },     { "cf1", value.robconf.cf1.constructString() },
+           { "cf4", value.robconf.cf4.constructString() },  { "cf6", value.robconf.cf6.constructString() },
+           { "cfx", value.robconf.cfx.constructString() },  { "eax_a", value.extax.eax_a.constructString() },
+           { "eax_b", value.extax.eax_b.constructString() }, { "eax_c", value.extax.eax_c.constructString() },
+           { "eax_d", value.extax.eax_d.constructString() }, { "eax_e", value.extax.eax_e.constructString() },
+           { "eax_f", value.extax.eax_f.constructString() } };
+}
+}  // namespace
+
+/***********************************************************************************************************************
+ * Class definitions: MockController::RequestHandler
+ */
+
+/**
+ * \brief Forwards the requests of the HTTP server to the mock.
+ */
+class MockController::RequestHandler : public HTTPRequestHandler
+{
+public:
+  explicit RequestHandler(MockController& controller) : controller_{ controller }
+  {
+  }
+
+  void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response) override
+  {
+    controller_.handleRequest(request, response);
+  }
+
+private:
+  MockController& controller_;
+};
+
+/***********************************************************************************************************************
+ * Class definitions: MockController::RequestHandlerFactory
+ */
+
+class MockController::RequestHandlerFactory : public HTTPRequestHandlerFactory
+{
+public:
+  explicit RequestHandlerFactory(MockController& controller) : controller_{ controller }
+  {
+  }
+
+  HTTPRequestHandler* createRequestHandler(HTTPServerRequest const&) override
+  {
+    return new RequestHandler{ controller_ };
+  }
+
+private:
+  MockController& controller_;
+};
+
+/***********************************************************************************************************************
+ * Class definitions: MockController
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+MockController::MockController(MockControllerOptions const& options)
+  : options_{ options }
+  , latency_{ options.latency.count() }
+  , jitter_{ options.jitter.count() }
+  , service_unavailable_probability_{ options.service_unavailable_probability }
+  , event_rate_{ options.event_rate }
+  , random_{ options.seed }
+  , thread_pool_{ 2, std::max(options.max_connections, 2) }
+{
+  rapid_modules_["T_ROB1"];
+  setJointTarget("ROB_1", JointTarget{});
+  setRobTarget("ROB_1", RobTarget{});
+
+  SocketAddress const address{ "127.0.0.1", options_.port };
+  ServerSocket socket;
+
+  if (!options_.certificate_file.empty() && !options_.private_key_file.empty())
+  {
+    Context::Ptr context{ new Context{ Context::SERVER_USE, options_.private_key_file, options_.certificate_file, "",
+                                       Context::VERIFY_NONE, 9, false, "ALL:!ADH:!LOW:!EXP:!MD5:@STRENGTH" } };
+
+    // Allow the clients to resume their TLS sessions.
+    context->enableSessionCache(true, "abb_librws_mock");
+    socket = SecureServerSocket{ address, 64, context };
+  }
+  else
+  {
+    socket = ServerSocket{ address, 64 };
+  }
+
+  port_ = socket.address().port();
+
+  HTTPServerParams::Ptr params{ new HTTPServerParams };
+  params->setMaxThreads(std::max(options_.max_connections, 2));
+  params->setMaxQueued(64);
+  params->setKeepAlive(true);
+  params->setMaxKeepAliveRequests(0);
+
+  server_ = std::make_unique<HTTPServer>(new RequestHandlerFactory{ *this }, thread_pool_, socket, params);
+  server_->start();
+
+  generator_ = std::thread{ [this] { generateEvents(); } };
+}
+
+MockController::~MockController()
+{
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+    stopping_ = true;
+
+    for (auto& group : subscription_groups_)
+      group.second->event_available.notify_all();
+  }
+
+  generator_wakeup_.notify_all();
+  generator_.join();
+
+  server_->stopAll(true);
+  thread_pool_.joinAll();
+}
+
+Poco::UInt16 MockController::port() const
+{
+  return port_;
+}
+
+ConnectionOptions MockController::connectionOptions() const
+{
+  return ConnectionOptions{ "127.0.0.1", port_, options_.username, options_.password };
+}
+
+void MockController::setLatency(std::chrono::microseconds latency, std::chrono::microseconds jitter)
+{
+  latency_.store(latency.count());
+  jitter_.store(jitter.count());
+}
+
+void MockController::setServiceUnavailableProbability(double probability)
+{
+  service_unavailable_probability_.store(probability);
+}
+
+void MockController::setEventRate(double rate)
+{
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+    event_rate_.store(rate);
+  }
+
+  generator_wakeup_.notify_all();
+}
+
+void MockController::expireNonces()
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  nonces_.clear();
+}
+
+void MockController::injectEventItem(std::string const& item)
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  for (auto& group : subscription_groups_)
+  {
+    for (auto const& subscription : group.second->resources)
+      queueEvent(*group.second, eventItem(subscription));
+
+    queueEvent(*group.second, item);
+
+    for (auto const& subscription : group.second->resources)
+      queueEvent(*group.second, eventItem(subscription));
+  }
+}
+
+void MockController::setIOSignal(std::string const& name, std::string const& value, std::string const& type)
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  io_signals_[name] = IOSignal{ type, value };
+  notify(ResourceKind::IO_SIGNAL, name);
+}
+
+std::optional<std::string> MockController::getIOSignal(std::string const& name) const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  auto const it = io_signals_.find(name);
+  if (it == io_signals_.end())
+    return std::nullopt;
+
+  return it->second.value;
+}
+
+void MockController::setRAPIDSymbol(RAPIDResource const& resource, std::string const& value,
+                                    std::string const& data_type)
+{
+  std::string const key = resource.task + "/" + resource.module + "/" + resource.name;
+
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  rapid_symbols_[key] = RAPIDSymbol{ data_type, value };
+  rapid_modules_[resource.task].insert(resource.module);
+  notify(ResourceKind::RAPID_SYMBOL, key);
+}
+
+void MockController::setRAPIDSymbol(RAPIDResource const& resource, RAPIDSymbolDataAbstract const& value)
+{
+  setRAPIDSymbol(resource, value.constructString(), value.getType());
+}
+
+void MockController::setRAPIDArraySymbol(RAPIDResource const& resource, RAPIDSymbolDataAbstract const& value)
+{
+  std::string const key = resource.task + "/" + resource.module + "/" + resource.name;
+  std::string const string = value.constructString();
+  std::size_t const size = splitDelimitedSubstrings(string, '[', ']', ',').size();
+
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  rapid_symbols_[key] = RAPIDSymbol{ value.getType(), string, { size } };
+  rapid_modules_[resource.task].insert(resource.module);
+  notify(ResourceKind::RAPID_SYMBOL, key);
+}
+
+void MockController::setRAPIDRecordType(RAPIDResource const& type,
+                                        std::vector<std::pair<std::string, std::string>> const& components)
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  rapid_record_types_[type.task + "/" + type.module + "/" + type.name] = components;
+  rapid_modules_[type.task].insert(type.module);
+}
+
+std::optional<std::string> MockController::getRAPIDSymbol(RAPIDResource const& resource) const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  auto const it = rapid_symbols_.find(resource.task + "/" + resource.module + "/" + resource.name);
+  if (it == rapid_symbols_.end())
+    return std::nullopt;
+
+  return it->second.value;
+}
+
+void MockController::setRAPIDExecutionState(rw::RAPIDExecutionState state)
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  rapid_execution_state_ = state;
+  notify(ResourceKind::RAPID_EXECUTION, "");
+}
+
+rw::RAPIDExecutionState MockController::getRAPIDExecutionState() const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  return rapid_execution_state_;
+}
+
+void MockController::setControllerState(rw::ControllerState state)
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  controller_state_ = state;
+  notify(ResourceKind::CONTROLLER_STATE, "");
+}
+
+rw::ControllerState MockController::getControllerState() const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  return controller_state_;
+}
+
+void MockController::setOperationMode(rw::OperationMode mode)
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  operation_mode_ = mode;
+  notify(ResourceKind::OPERATION_MODE, "");
+}
+
+rw::OperationMode MockController::getOperationMode() const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  return operation_mode_;
+}
+
+void MockController::setJointTarget(std::string const& mechunit, JointTarget const& value)
+{
+  auto spans = jointTargetSpans(value);
+
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  mechanical_units_[mechunit].jointtarget = std::move(spans);
+}
+
+void MockController::setRobTarget(std::string const& mechunit, RobTarget const& value)
+{
+  auto spans = robTargetSpans(value);
+
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  mechanical_units_[mechunit].robtarget = std::move(spans);
+}
+
+void MockController::setCFGInstances(std::string const& topic, std::string const& type,
+                                     std::vector<CFGInstance> instances)
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  cfg_instances_[topic + "/" + type] = std::move(instances);
+}
+
+void MockController::setFile(std::string const& path, std::string const& content)
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  files_[path] = content;
+}
+
+std::optional<std::string> MockController::getFile(std::string const& path) const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  auto const it = files_.find(path);
+  if (it == files_.end())
+    return std::nullopt;
+
+  return it->second;
+}
+
+MockController::Statistics MockController::getStatistics() const noexcept
+{
+  Statistics statistics;
+  statistics.requests = requests_.load();
+  statistics.service_unavailable = service_unavailable_.load();
+  statistics.events = events_.load();
+  statistics.frames = frames_.load();
+  statistics.dropped_events = dropped_events_.load();
+  statistics.unauthorized = unauthorized_.load();
+
+  return statistics;
+}
+
+std::size_t MockController::subscriptionCount() const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  return subscription_groups_.size();
+}
+
+/************************************************************
+ * Request handling
+ */
+
+void MockController::handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+{
+  ++requests_;
+
+  try
+  {
+    Poco::URI const uri{ request.getURI() };
+    std::string const& method = request.getMethod();
+    std::string const path = uri.getPath();
+    std::map<std::string, std::string> const query = parseForm(uri.getRawQuery());
+
+    // Subscription WebSockets are neither delayed nor rejected.
+    if (startsWith(path, "/poll/"))
+    {
+      if (authorize(request, response))
+        handlePoll(path.substr(6), request, response);
+
+      return;
+    }
+
+    std::string body;
+    Poco::StreamCopier::copyToString(request.stream(), body);
+
+    delay();
+
+    if (injectServiceUnavailable())
+    {
+      ++service_unavailable_;
+      respond(response, HTTPResponse::HTTP_SERVICE_UNAVAILABLE);
+      return;
+    }
+
+    if (!authorize(request, response))
+      return;
+
+    // RWS 1.0 passes actions as query parameters, RWS 2.0 as the last path segment.
+    std::string const action = formValue(query, "action");
+
+    if (path == v2_0::Resources::LOGOUT)
+    {
+      NameValueCollection cookies;
+      request.getCookies(cookies);
+
+      std::lock_guard<std::mutex> lock{ mutex_ };
+      sessions_.erase(cookies.get(SESSION_COOKIE, ""));
+      respond(response, HTTPResponse::HTTP_NO_CONTENT);
+    }
+    else if (path == v2_0::Services::USERS || startsWith(path, "/rw/mastership"))
+      respond(response, method == HTTPRequest::HTTP_POST ? HTTPResponse::HTTP_NO_CONTENT : HTTPResponse::HTTP_OK);
+    else if (path == v2_0::Services::CTRL || path == v2_0::Resources::RW_SYSTEM)
+      handleSystem(method, path, response);
+    else if (startsWith(path, v2_0::Resources::RW_IOSYSTEM_SIGNALS))
+      handleIOSystem(method, path, action, body, response);
+    else if (startsWith(path, "/rw/rapid/"))
+      handleRAPID(method, path, action, query, body, response);
+    else if (startsWith(path, "/rw/panel/"))
+      handlePanel(method, path, body, response);
+    else if (startsWith(path, v2_0::Resources::RW_MOTIONSYSTEM_MECHUNITS))
+      handleMotionSystem(method, path, query, response);
+    else if (startsWith(path, v2_0::Resources::RW_CFG + "/"))
+      handleCFG(method, path, response);
+    else if (startsWith(path, v2_0::Services::FILESERVICE + "/"))
+      handleFileService(method, path, body, response);
+    else if (startsWith(path, v2_0::Services::SUBSCRIPTION))
+      handleSubscription(method, path, body, response);
+    else
+      respond(response, HTTPResponse::HTTP_NOT_FOUND);
+  }
+  catch (std::exception const&)
+  {
+    // Invalid values in the request, or the connection was closed.
+    if (!response.sent())
+      respond(response, HTTPResponse::HTTP_BAD_REQUEST);
+  }
+}
+
+bool MockController::authorize(HTTPServerRequest& request, HTTPServerResponse& response)
+{
+  NameValueCollection cookies;
+  request.getCookies(cookies);
+
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  if (sessions_.count(cookies.get(SESSION_COOKIE, "")) > 0)
+    return true;
+
+  bool stale = false;
+
+  if (request.hasCredentials())
+  {
+    std::string scheme;
+    std::string authentication_info;
+    request.getCredentials(scheme, authentication_info);
+
+    bool authenticated = false;
+
+    if (options_.digest_authentication)
+    {
+      if (Poco::icompare(scheme, "Digest") == 0)
+      {
+        HTTPAuthenticationParams const params{ authentication_info };
+
+        if (nonces_.count(params.get("nonce", "")) == 0)
+          stale = true;
+        else
+          authenticated = params.get("username", "") == options_.username &&
+                          params.get("response", "") == digestResponse(request.getMethod(), params, options_.password);
+      }
+    }
+    else if (Poco::icompare(scheme, "Basic") == 0)
+    {
+      HTTPBasicCredentials const credentials{ authentication_info };
+      authenticated = credentials.getUsername() == options_.username && credentials.getPassword() == options_.password;
+    }
+
+    if (authenticated)
+    {
+      std::string const session = std::to_string(next_session_id_++);
+      sessions_.insert(session);
+
+      HTTPCookie session_cookie{ SESSION_COOKIE, session };
+      session_cookie.setPath("/");
+      response.addCookie(session_cookie);
+
+      HTTPCookie abbcx_cookie{ ABBCX_COOKIE, session };
+      abbcx_cookie.setPath("/");
+      response.addCookie(abbcx_cookie);
+
+      return true;
+    }
+  }
+
+  ++unauthorized_;
+
+  if (options_.digest_authentication)
+  {
+    std::string const nonce = md5(REALM + std::string{ ":" } + std::to_string(next_nonce_++));
+    nonces_.insert(nonce);
+
+    response.set("WWW-Authenticate", std::string{ "Digest realm=\"" } + REALM + "\", qop=\"auth\", nonce=\"" + nonce +
+                                         "\", algorithm=MD5" + (stale ? ", stale=true" : ""));
+  }
+  else
+  {
+    response.set("WWW-Authenticate", std::string{ "Basic realm=\"" } + REALM + "\"");
+  }
+
+  respond(response, HTTPResponse::HTTP_UNAUTHORIZED);
+
+  return false;
+}
+
+void MockController::handleSystem(std::string const& method, std::string const& path, HTTPServerResponse& response)
+{
+  if (method != HTTPRequest::HTTP_GET)
+    return respond(response, HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+
+  std::string items;
+
+  if (path == v2_0::Services::CTRL)
+  {
+    items = li("ctrl-identity-info", "identity", span("ctrl-name", "MockController") +
+                                                     span(v2_0::Identifiers::CTRL_TYPE, "Virtual Controller"));
+  }
+  else
+  {
+    std::string const& system_li = isVersion1() ? v1_0::Identifiers::SYS_SYSTEM_LI : v2_0::Identifiers::SYS_SYSTEM_LI;
+    std::string const& option_li = isVersion1() ? v1_0::Identifiers::SYS_OPTION_LI : v2_0::Identifiers::SYS_OPTION_LI;
+    std::string const version = isVersion1() ? "6.08.00.00" : "7.2.0";
+
+    items = li(system_li, "system",
+               span(v2_0::Identifiers::NAME, "MockController") + span("rwversion", version) +
+                   span(v2_0::Identifiers::RW_VERSION_NAME, version));
+
+    for (std::string const option : { "RobotWare Base", "PC Interface", "Multitasking" })
+      items += li(option_li, option, span(v2_0::Identifiers::OPTION, option));
+  }
+
+  respond(response, HTTPResponse::HTTP_OK, document("system", items), xhtmlContentType());
+}
+
+void MockController::handleIOSystem(std::string const& method, std::string const& path, std::string const& action,
+                                    std::string const& body, HTTPServerResponse& response)
+{
+  std::string const prefix = v2_0::Resources::RW_IOSYSTEM_SIGNALS;
+  std::string name = path.size() > prefix.size() ? path.substr(prefix.size() + 1) : "";
+
+  bool const set =
+      method == HTTPRequest::HTTP_POST && (action == "set" || endsWith(name, "/" + v2_0::Queries::ACTION_SET));
+
+  if (endsWith(name, "/" + v2_0::Queries::ACTION_SET))
+    name.erase(name.size() - v2_0::Queries::ACTION_SET.size() - 1);
+
+  auto const item = [&](std::string const& signal_name, IOSignal const& signal) {
+    return li("ios-signal-li", signal_name,
+              link(prefix + "/" + signal_name) + span(v2_0::Identifiers::NAME, signal_name) +
+                  span(v2_0::Identifiers::TYPE, signal.type) + span(v2_0::Identifiers::LVALUE, signal.value) +
+                  span("lstate", "not simulated"));
+  };
+
+  std::unique_lock<std::mutex> lock{ mutex_ };
+
+  if (name.empty())
+  {
+    if (method != HTTPRequest::HTTP_GET)
+      return respond(response, HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+
+    std::string items;
+    for (auto const& [signal_name, signal] : io_signals_)
+      items += item(signal_name, signal);
+
+    lock.unlock();
+    return respond(response, HTTPResponse::HTTP_OK, document("signals", items), xhtmlContentType());
+  }
+
+  auto const signal = io_signals_.find(name);
+  if (signal == io_signals_.end())
+    return respond(response, HTTPResponse::HTTP_BAD_REQUEST);
+
+  if (set)
+  {
+    signal->second.value = formValue(parseForm(body), v2_0::Identifiers::LVALUE);
+    notify(ResourceKind::IO_SIGNAL, name);
+
+    return respond(response, HTTPResponse::HTTP_NO_CONTENT);
+  }
+
+  if (method != HTTPRequest::HTTP_GET)
+    return respond(response, HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+
+  std::string const content = document("signal", item(name, signal->second));
+  lock.unlock();
+
+  respond(response, HTTPResponse::HTTP_OK, content, xhtmlContentType());
+}
+
+void MockController::handleRAPID(std::string const& method, std::string const& path, std::string const& action,
+                                 std::map<std::string, std::string> const& query, std::string const& body,
+                                 HTTPServerResponse& response)
+{
+  bool const get = method == HTTPRequest::HTTP_GET;
+  bool const post = method == HTTPRequest::HTTP_POST;
+  std::string const& execution = v2_0::Resources::RW_RAPID_EXECUTION;
+  std::string const& tasks = v2_0::Resources::RW_RAPID_TASKS;
+  std::string const symbol_prefix = "/rw/rapid/symbol/";
+
+  std::unique_lock<std::mutex> lock{ mutex_ };
+
+  auto const modules = [&](std::string const& task) {
+    auto const it = rapid_modules_.find(task);
+    if (it == rapid_modules_.end())
+      return respond(response, HTTPResponse::HTTP_BAD_REQUEST);
+
+    std::string const& module_li = isVersion1() ? v1_0::Identifiers::RAP_MODULE_INFO_LI :
+                                                  v2_0::Identifiers::RAP_MODULE_INFO_LI;
+    std::string items;
+    for (auto const& module : it->second)
+      items += li(module_li, module, span(v2_0::Identifiers::NAME, module) + span(v2_0::Identifiers::TYPE, "ProgMod"));
+
+    respond(response, HTTPResponse::HTTP_OK, document("modules", items), xhtmlContentType());
+  };
+
+  if (path == execution || startsWith(path, execution + "/"))
+  {
+    std::string const operation = path == execution ? action : path.substr(execution.size() + 1);
+
+    if (get && operation.empty())
+    {
+      std::string const item = li("rap-execution", "execution",
+                                  span(v2_0::Identifiers::CTRLEXECSTATE, toString(rapid_execution_state_)) +
+                                      span("cycle", "forever"));
+
+      return respond(response, HTTPResponse::HTTP_OK, document("execution", item), xhtmlContentType());
+    }
+
+    if (!post)
+      return respond(response, HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+
+    if (operation == "start" || operation == "stop")
+    {
+      auto const state = operation == "start" ? rw::RAPIDExecutionState::running : rw::RAPIDExecutionState::stopped;
+
+      if (state != rapid_execution_state_)
+      {
+        rapid_execution_state_ = state;
+        notify(ResourceKind::RAPID_EXECUTION, "");
+      }
+    }
+    else if (operation != "resetpp")
+      return respond(response, HTTPResponse::HTTP_BAD_REQUEST);
+
+    return respond(response, HTTPResponse::HTTP_NO_CONTENT);
+  }
+
+  if (path == tasks)
+  {
+    if (!get)
+      return respond(response, HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+
+    std::string const& task_li = isVersion1() ? v1_0::Identifiers::RAP_TASK_LI : v2_0::Identifiers::RAP_TASK_LI;
+    bool const running = rapid_execution_state_ == rw::RAPIDExecutionState::running;
+    std::string items;
+
+    for (auto const& task : rapid_modules_)
+    {
+      bool const motion_task = startsWith(task.first, "T_ROB");
+      items += li(task_li, task.first,
+                  span(v2_0::Identifiers::NAME, task.first) + span(v2_0::Identifiers::TYPE, "norm") +
+                      span("taskstate", "link") + span(v2_0::Identifiers::EXCSTATE, running ? "star" : "read") +
+                      span(v2_0::Identifiers::ACTIVE, "On") +
+                      span(v2_0::Identifiers::MOTIONTASK,
+                           motion_task ? SystemConstants::RAPID::RAPID_TRUE : SystemConstants::RAPID::RAPID_FALSE));
+    }
+
+    return respond(response, HTTPResponse::HTTP_OK, document("tasks", items), xhtmlContentType());
+  }
+
+  if (startsWith(path, tasks + "/"))
+  {
+    std::string task = path.substr(tasks.size() + 1);
+    std::string operation = action;
+
+    std::size_t const slash = task.find('/');
+    if (slash != std::string::npos)
+    {
+      operation = task.substr(slash + 1);
+      task.erase(slash);
+    }
+
+    if (get && operation == "modules")
+      return modules(task);
+
+    if (!post)
+      return respond(response, HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+
+    auto const form = parseForm(body);
+
+    if (operation == "loadmod")
+    {
+      // The module is named after the file, without directory and extension.
+      std::string module = formValue(form, v2_0::Identifiers::MODULEPATH);
+      module = module.substr(module.find_last_of('/') + 1);
+      module = module.substr(0, module.find('.'));
+
+      rapid_modules_[task].insert(module);
+    }
+    else if (operation == "unloadmod")
+    {
+      std::string module = formValue(form, v2_0::Identifiers::MODULE);
+      module = module.substr(0, module.find('.'));
+
+      rapid_modules_[task].erase(module);
+    }
+    else
+      return respond(response, HTTPResponse::HTTP_BAD_REQUEST);
+
+    return respond(response, HTTPResponse::HTTP_NO_CONTENT);
+  }
+
+  if (path == v1_0::Resources::RW_RAPID_MODULES && get)
+    return modules(formValue(query, "task"));
+
+  if (path == v2_0::Resources::RW_RAPID_SYMBOLS_SEARCH)
+  {
+    if (!post)
+      return respond(response, HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+
+    // Only the search for the components of a record type is supported.
+    auto const form = parseForm(body);
+    std::string const block = formValue(form, "blockurl");
+
+    if (formValue(form, v2_0::Identifiers::SYMTYP) != "rcp" || !startsWith(block, "RAPID/"))
+      return respond(response, HTTPResponse::HTTP_BAD_REQUEST);
+
+    auto const type = rapid_record_types_.find(block.substr(6));
+    std::string items;
+
+    if (type != rapid_record_types_.end())
+    {
+      std::string const task = type->first.substr(0, type->first.find('/'));
+
+      for (auto const& [name, data_type] : type->second)
+        items += li(v2_0::Identifiers::RAP_SYMPROPRECCOMP_LI, block + "/" + name,
+                    span("symburl", block + "/" + name) + span(v2_0::Identifiers::NAME, name) +
+                        span(v2_0::Identifiers::SYMTYP, "rcp") + span(v2_0::Identifiers::DATTYP, data_type) +
+                        span(v2_0::Identifiers::TYPURL, rapidTypeURL(task, data_type)));
+    }
+
+    return respond(response, HTTPResponse::HTTP_OK, document("symbols", items), xhtmlContentType());
+  }
+
+  if (startsWith(path, symbol_prefix))
+  {
+    std::string part;
+    std::string key = parseSymbolPath(path.substr(symbol_prefix.size()), part);
+
+    // A single array element is addressed as e.g. "reg{3}" (one-based).
+    std::optional<std::size_t> element;
+    std::size_t const brace = key.find('{');
+    if (brace != std::string::npos && endsWith(key, "}"))
+    {
+      element = std::strtoul(key.c_str() + brace + 1, nullptr, 10);
+      key.erase(brace);
+    }
+
+    auto const type = rapid_record_types_.find(key);
+    if (type != rapid_record_types_.end() && get && part == "properties")
+    {
+      std::string const name = key.substr(key.find_last_of('/') + 1);
+      std::string const item = li("rap-symproprecord", name,
+                                  span("symburl", "RAPID/" + key) + span(v2_0::Identifiers::NAME, name) +
+                                      span(v2_0::Identifiers::SYMTYP, "rec") +
+                                      span("ncom", std::to_string(type->second.size())));
+
+      return respond(response, HTTPResponse::HTTP_OK, document("properties", item), xhtmlContentType());
+    }
+
+    auto const symbol = rapid_symbols_.find(key);
+    if (symbol == rapid_symbols_.end())
+      return respond(response, HTTPResponse::HTTP_BAD_REQUEST);
+
+    std::string const name = key.substr(key.find_last_of('/') + 1);
+    std::vector<std::string> elements;
+
+    if (element)
+    {
+      elements = extractDelimitedSubstrings(symbol->second.value, '[', ']', ',');
+      if (symbol->second.dimensions.size() != 1 || *element < 1 || *element > elements.size())
+        return respond(response, HTTPResponse::HTTP_BAD_REQUEST);
+    }
+
+    if (get && part == "data")
+    {
+      std::string const& value = element ? elements[*element - 1] : symbol->second.value;
+      std::string const item = li("rap-data", name, span(v2_0::Identifiers::VALUE, value));
+      return respond(response, HTTPResponse::HTTP_OK, document("data", item), xhtmlContentType());
+    }
+
+    if (get && part == "properties")
+    {
+      std::string const task = key.substr(0, key.find('/'));
+      std::string dim;
+      for (std::size_t const size : symbol->second.dimensions)
+        dim += (dim.empty() ? "" : " ") + std::to_string(size);
+
+      std::string const item =
+          li("rap-sympropvar", name,
+             span("symburl", "RAPID/" + key) + span("name", name) + span("symtyp", "per") +
+                 span(v2_0::Identifiers::DATTYP, symbol->second.data_type) +
+                 span(v2_0::Identifiers::TYPURL, rapidTypeURL(task, symbol->second.data_type)) +
+                 span("ndim", std::to_string(symbol->second.dimensions.size())) +
+                 (dim.empty() ? "" : span(v2_0::Identifiers::DIM, dim)));
+
+      return respond(response, HTTPResponse::HTTP_OK, document("properties", item), xhtmlContentType());
+    }
+
+    if (post && part == "data")
+    {
+      std::string const value = formValue(parseForm(body), v2_0::Identifiers::VALUE);
+
+      if (element)
+      {
+        elements[*element - 1] = value;
+
+        symbol->second.value = "[";
+        for (std::size_t i = 0; i < elements.size(); ++i)
+          symbol->second.value += (i == 0 ? "" : ",") + elements[i];
+        symbol->second.value += "]";
+      }
+      else
+      {
+        symbol->second.value = value;
+      }
+
+      notify(ResourceKind::RAPID_SYMBOL, key);
+
+      return respond(response, HTTPResponse::HTTP_NO_CONTENT);
+    }
+
+    return respond(response, HTTPResponse::HTTP_BAD_REQUEST);
+  }
+
+  respond(response, HTTPResponse::HTTP_NOT_FOUND);
+}
+
+void MockController::handlePanel(std::string const& method, std::string const& path, std::string const& body,
+                                 HTTPServerResponse& response)
+{
+  bool const get = method == HTTPRequest::HTTP_GET;
+  bool const post = method == HTTPRequest::HTTP_POST;
+  auto const form = parseForm(body);
+
+  std::unique_lock<std::mutex> lock{ mutex_ };
+
+  if (path == v1_0::Resources::RW_PANEL_CTRLSTATE || path == v2_0::Resources::RW_PANEL_CTRLSTATE)
+  {
+    if (post)
+    {
+      controller_state_ = rw::makeControllerState(formValue(form, "ctrl-state"));
+      notify(ResourceKind::CONTROLLER_STATE, "");
+
+      return respond(response, HTTPResponse::HTTP_NO_CONTENT);
+    }
+
+    if (get)
+    {
+      std::string const item =
+          li("pnl-ctrlstate", "ctrlstate", span(v2_0::Identifiers::CTRLSTATE, toString(controller_state_)));
+      return respond(response, HTTPResponse::HTTP_OK, document("panel", item), xhtmlContentType());
+    }
+  }
+  else if (path == v2_0::Resources::RW_PANEL_OPMODE)
+  {
+    if (post)
+    {
+      operation_mode_ = rw::makeOperationMode(formValue(form, "opmode"));
+      notify(ResourceKind::OPERATION_MODE, "");
+
+      return respond(response, HTTPResponse::HTTP_NO_CONTENT);
+    }
+
+    if (get)
+    {
+      std::string const item = li("pnl-opmode", "opmode", span(v2_0::Identifiers::OPMODE, toString(operation_mode_)));
+      return respond(response, HTTPResponse::HTTP_OK, document("panel", item), xhtmlContentType());
+    }
+  }
+  else if (path == "/rw/panel/speedratio")
+  {
+    if (post)
+    {
+      speed_ratio_ = std::stoul(formValue(form, "speed-ratio"));
+      return respond(response, HTTPResponse::HTTP_NO_CONTENT);
+    }
+
+    if (get)
+    {
+      std::string const item = li("pnl-speedratio", "speedratio", span("speedratio", std::to_string(speed_ratio_)));
+      return respond(response, HTTPResponse::HTTP_OK, document("panel", item), xhtmlContentType());
+    }
+  }
+  else
+    return respond(response, HTTPResponse::HTTP_NOT_FOUND);
+
+  respond(response, HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+}
+
+void MockController::handleMotionSystem(std::string const& method, std::string const& path,
+                                        std::map<std::string, std::string> const& query,
+                                        HTTPServerResponse& response)
+{
+  if (method != HTTPRequest::HTTP_GET)
+    return respond(response, HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+
+  std::string const& prefix = v2_0::Resources::RW_MOTIONSYSTEM_MECHUNITS;
+  std::string mechunit = path.size() > prefix.size() ? path.substr(prefix.size() + 1) : "";
+  std::string resource;
+
+  std::size_t const slash = mechunit.find('/');
+  if (slash != std::string::npos)
+  {
+    resource = mechunit.substr(slash + 1);
+    mechunit.erase(slash);
+  }
+
+  std::unique_lock<std::mutex> lock{ mutex_ };
+
+  if (mechunit.empty())
+  {
+    std::string items;
+    for (auto const& unit : mechanical_units_)
+      items += li("ms-mechunit-li", unit.first, span(v2_0::Identifiers::NAME, unit.first));
+
+    return respond(response, HTTPResponse::HTTP_OK, document("mechunits", items), xhtmlContentType());
+  }
+
+  auto const unit = mechanical_units_.find(mechunit);
+  if (unit == mechanical_units_.end())
+    return respond(response, HTTPResponse::HTTP_BAD_REQUEST);
+
+  std::vector<std::pair<std::string, std::string>> spans;
+  std::string class_name;
+
+  if (resource == "jointtarget")
+  {
+    class_name = "ms-jointtarget";
+    spans = unit->second.jointtarget;
+  }
+  else if (resource == "robtarget")
+  {
+    class_name = "ms-robtargets";
+    spans = unit->second.robtarget;
+  }
+  else if (resource.empty() && formValue(query, "resource") == "static")
+  {
+    class_name = "ms-mechunit";
+    spans = { { "task-name", "T_ROB1" }, { "is-integrated-unit", "false" }, { "has-integrated-unit", "false" },
+              { "type", "TCPRobot" },    { "axes", "6" },                     { "axes-total", "6" } };
+  }
+  else if (resource.empty() && formValue(query, "resource") == "dynamic")
+  {
+    class_name = "ms-mechunit";
+    spans = { { "tool-name", "tool0" },      { "wobj-name", "wobj0" }, { "payload-name", "load0" },
+              { "total-payload-name", "load0" }, { "status", "Activated" }, { "mode", "Activated" },
+              { "jog-mode", "Cartesian" },   { "coord-system", "Base" } };
+  }
+  else
+    return respond(response, HTTPResponse::HTTP_BAD_REQUEST);
+
+  lock.unlock();
+
+  std::string content;
+  for (auto const& [span_class, text] : spans)
+    content += span(span_class, text);
+
+  respond(response, HTTPResponse::HTTP_OK, document("mechunit", li(class_name, mechunit, content)), xhtmlContentType());
+}
+
+void MockController::handleCFG(std::string const& method, std::string const& path, HTTPServerResponse& response)
+{
+  if (method != HTTPRequest::HTTP_GET)
+    return respond(response, HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+
+  std::string const& suffix = v2_0::Resources::INSTANCES;
+  if (!endsWith(path, suffix))
+    return respond(response, HTTPResponse::HTTP_NOT_FOUND);
+
+  std::string const& prefix = v2_0::Resources::RW_CFG;
+  std::string const key = path.substr(prefix.size() + 1, path.size() - prefix.size() - 1 - suffix.size());
+
+  std::string const& instance_li =
+      isVersion1() ? v1_0::Identifiers::CFG_DT_INSTANCE_LI : v2_0::Identifiers::CFG_DT_INSTANCE_LI;
+  std::string const& attribute_li = isVersion1() ? v1_0::Identifiers::CFG_IA_T_LI : v2_0::Identifiers::CFG_IA_T_LI;
+  std::string items;
+
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+
+    auto const instances = cfg_instances_.find(key);
+    if (instances != cfg_instances_.end())
+    {
+      for (auto const& instance : instances->second)
+      {
+        std::string attributes;
+        for (auto const& [name, value] : instance.attributes)
+          attributes += li(attribute_li, name, span(v2_0::Identifiers::VALUE, value));
+
+        items += li(instance_li, instance.name,
+                    link(prefix + "/" + key + "/" + instance.name) + "<ul>" + attributes + "</ul>");
+      }
+    }
+  }
+
+  respond(response, HTTPResponse::HTTP_OK, document("instances", items), xhtmlContentType());
+}
+
+void MockController::handleFileService(std::string const& method, std::string const& path, std::string const& body,
+                                       HTTPServerResponse& response)
+{
+  std::string const file = path.substr(v2_0::Services::FILESERVICE.size() + 1);
+
+  std::unique_lock<std::mutex> lock{ mutex_ };
+  auto const it = files_.find(file);
+
+  if (method == HTTPRequest::HTTP_PUT)
+  {
+    bool const created = it == files_.end();
+    files_[file] = body;
+
+    return respond(response, created ? HTTPResponse::HTTP_CREATED : HTTPResponse::HTTP_OK);
+  }
+
+  if (it == files_.end())
+    return respond(response, HTTPResponse::HTTP_NOT_FOUND);
+
+  if (method == HTTPRequest::HTTP_DELETE)
+  {
+    files_.erase(it);
+    return respond(response, HTTPResponse::HTTP_NO_CONTENT);
+  }
+
+  if (method != HTTPRequest::HTTP_GET)
+    return respond(response, HTTPResponse::HTTP_METHOD_NOT_ALLOWED);
+
+  std::string const content = it->second;
+  lock.unlock();
+
+  respond(response, HTTPResponse::HTTP_OK, content, "text/plain");
+}
+
+void MockController::handleSubscription(std::string const& method, std::string const& path, std::string const& body,
+                                        HTTPServerResponse& response)
+{
+  std::string const& prefix = v2_0::Services::SUBSCRIPTION;
+
+  if (path == prefix && method == HTTPRequest::HTTP_POST)
+  {
+    auto const fields = parseFormPairs(body);
+    std::map<std::string, std::string> const form{ fields.begin(), fields.end() };
+    auto group = std::make_shared<SubscriptionGroup>();
+
+    for (auto const& [name, index] : fields)
+    {
+      if (name != "resources")
+        continue;
+
+      std::string const uri = formValue(form, index);
+      std::string const resource = uri.substr(0, uri.find(';'));
+      std::string const parameter = uri.find(';') != std::string::npos ? uri.substr(uri.find(';') + 1) : "";
+      std::string const signal_prefix = v2_0::Resources::RW_IOSYSTEM_SIGNALS + "/";
+      std::string const symbol_prefix = "/rw/rapid/symbol/";
+
+      Subscription subscription{ uri, ResourceKind::IO_SIGNAL, "" };
+
+      if (startsWith(resource, signal_prefix) && parameter == v2_0::Identifiers::STATE)
+        subscription.key = resource.substr(signal_prefix.size());
+      else if (resource == v2_0::Resources::RW_RAPID_EXECUTION && parameter == v2_0::Identifiers::CTRLEXECSTATE)
+        subscription.kind = ResourceKind::RAPID_EXECUTION;
+      else if (resource == v1_0::Resources::RW_PANEL_CTRLSTATE || resource == v2_0::Resources::RW_PANEL_CTRLSTATE)
+        subscription.kind = ResourceKind::CONTROLLER_STATE;
+      else if (resource == v2_0::Resources::RW_PANEL_OPMODE)
+        subscription.kind = ResourceKind::OPERATION_MODE;
+      else if (startsWith(resource, symbol_prefix) && parameter == v2_0::Identifiers::VALUE)
+      {
+        std::string part;
+        subscription.kind = ResourceKind::RAPID_SYMBOL;
+        subscription.key = parseSymbolPath(resource.substr(symbol_prefix.size()), part);
+      }
+
+      if ((subscription.kind == ResourceKind::IO_SIGNAL || subscription.kind == ResourceKind::RAPID_SYMBOL) &&
+          subscription.key.empty())
+        return respond(response, HTTPResponse::HTTP_BAD_REQUEST);
+
+      group->resources.push_back(std::move(subscription));
+    }
+
+    if (group->resources.empty())
+      return respond(response, HTTPResponse::HTTP_BAD_REQUEST);
+
+    std::string id;
+    {
+      std::lock_guard<std::mutex> lock{ mutex_ };
+      id = std::to_string(next_subscription_group_id_++);
+      subscription_groups_[id] = std::move(group);
+    }
+
+    response.set("Location", baseURI() + "poll/" + id);
+    return respond(response, HTTPResponse::HTTP_CREATED);
+  }
+
+  if (startsWith(path, prefix + "/") && method == HTTPRequest::HTTP_DELETE)
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+
+    auto const group = subscription_groups_.find(path.substr(prefix.size() + 1));
+    if (group == subscription_groups_.end())
+      return respond(response, HTTPResponse::HTTP_NOT_FOUND);
+
+    group->second->closed = true;
+    group->second->event_available.notify_all();
+    subscription_groups_.erase(group);
+
+    return respond(response, HTTPResponse::HTTP_OK);
+  }
+
+  respond(response, HTTPResponse::HTTP_BAD_REQUEST);
+}
+
+void MockController::handlePoll(std::string const& group_id, HTTPServerRequest& request,
+                                HTTPServerResponse& response)
+{
+  std::shared_ptr<SubscriptionGroup> group;
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+
+    auto const it = subscription_groups_.find(group_id);
+    if (it != subscription_groups_.end())
+      group = it->second;
+  }
+
+  if (!group)
+    return respond(response, HTTPResponse::HTTP_NOT_FOUND);
+
+  response.set("Sec-WebSocket-Protocol", request.get("Sec-WebSocket-Protocol", ""));
+  WebSocket websocket{ request, response };
+
+  std::size_t const max_items = std::max<std::size_t>(options_.max_events_per_frame, 1);
+  char buffer[1024];
+
+  while (true)
+  {
+    std::string items;
+    std::size_t item_count = 0;
+
+    {
+      std::unique_lock<std::mutex> lock{ mutex_ };
+      group->event_available.wait_for(lock, POLL_INTERVAL,
+                                      [&] { return stopping_ || group->closed || !group->pending_events.empty(); });
+
+      if (stopping_ || group->closed)
+        break;
+
+      for (; item_count < max_items && !group->pending_events.empty(); ++item_count)
+      {
+        items += group->pending_events.front();
+        group->pending_events.pop_front();
+      }
+    }
+
+    if (item_count > 0)
+    {
+      std::string const message = document("event", items);
+      std::size_t const frame_size = options_.max_frame_size > 0 ? options_.max_frame_size : message.size();
+
+      for (std::size_t offset = 0; offset < message.size(); offset += frame_size)
+      {
+        std::size_t const size = std::min(frame_size, message.size() - offset);
+        int const opcode = offset == 0 ? WebSocket::FRAME_OP_TEXT : WebSocket::FRAME_OP_CONT;
+        int const fin = offset + size == message.size() ? WebSocket::FRAME_FLAG_FIN : 0;
+
+        websocket.sendFrame(message.data() + offset, static_cast<int>(size), opcode | fin);
+
+        // Control frames may be interleaved with the fragments of a message.
+        if (offset == 0 && !fin)
+          websocket.sendFrame("mock", 4, WebSocket::FRAME_FLAG_FIN | WebSocket::FRAME_OP_PING);
+      }
+
+      events_ += item_count;
+      ++frames_;
+    }
+
+    // Answer pings, and stop when the client closes the connection.
+    bool closed = false;
+    while (!closed && websocket.poll(Poco::Timespan{ 0 }, Socket::SELECT_READ))
+    {
+      int flags = 0;
+      int const received = websocket.receiveFrame(buffer, sizeof(buffer), flags);
+      int const opcode = flags & WebSocket::FRAME_OP_BITMASK;
+
+      if (opcode == WebSocket::FRAME_OP_PING)
+        websocket.sendFrame(buffer, received, WebSocket::FRAME_FLAG_FIN | WebSocket::FRAME_OP_PONG);
+      else if (opcode == WebSocket::FRAME_OP_CLOSE || (received == 0 && flags == 0))
+        closed = true;
+    }
+
+    if (closed)
+      return;
+  }
+
+  try
+  {
+    websocket.shutdown();
+  }
+  catch (Poco::Exception const&)
+  {
+    // The client may already have closed the connection.
+  }
+}
+
+/************************************************************
+ * Auxiliary methods
+ */
+
+void MockController::notify(ResourceKind kind, std::string const& key)
+{
+  for (auto& group : subscription_groups_)
+  {
+    for (auto const& subscription : group.second->resources)
+    {
+      if (subscription.kind == kind && subscription.key == key)
+        queueEvent(*group.second, eventItem(subscription));
+    }
+  }
+}
+
+std::string MockController::eventItem(Subscription const& subscription) const
+{
+  switch (subscription.kind)
+  {
+    case ResourceKind::IO_SIGNAL:
+    {
+      auto const signal = io_signals_.find(subscription.key);
+      std::string const value = signal != io_signals_.end() ? signal->second.value : "";
+
+      return li("ios-signalstate-ev", "ios-signalstate",
+                link(subscription.uri) + span(v2_0::Identifiers::LVALUE, value) + span("lstate", "not simulated"));
+    }
+    case ResourceKind::RAPID_SYMBOL:
+    {
+      auto const symbol = rapid_symbols_.find(subscription.key);
+      std::string const value = symbol != rapid_symbols_.end() ? symbol->second.value : "";
+
+      return li("rap-value-ev", "rap-value", link(subscription.uri) + span(v2_0::Identifiers::VALUE, value));
+    }
+    case ResourceKind::RAPID_EXECUTION:
+      return li("rap-ctrlexecstate-ev", "rap-ctrlexecstate",
+                link(subscription.uri) +
+                    span(v2_0::Identifiers::CTRLEXECSTATE, toString(rapid_execution_state_)));
+    case ResourceKind::CONTROLLER_STATE:
+      return li("pnl-ctrlstate-ev", "pnl-ctrlstate",
+                link(subscription.uri) + span(v2_0::Identifiers::CTRLSTATE, toString(controller_state_)));
+    case ResourceKind::OPERATION_MODE:
+      return li("pnl-opmode-ev", "pnl-opmode",
+                link(subscription.uri) + span(v2_0::Identifiers::OPMODE, toString(operation_mode_)));
+  }
+
+  return "";
+}
+
+std::string MockController::rapidTypeURL(std::string const& task, std::string const& data_type) const
+{
+  for (auto const& type : rapid_record_types_)
+  {
+    if (startsWith(type.first, task + "/") && endsWith(type.first, "/" + data_type))
+      return "RAPID/" + type.first;
+  }
+
+  return "RAPID/" + data_type;
+}
+
+void MockController::queueEvent(SubscriptionGroup& group, std::string item)
+{
+  if (group.pending_events.size() >= MAX_PENDING_EVENTS)
+  {
+    group.pending_events.pop_front();
+    ++dropped_events_;
+  }
+
+  group.pending_events.push_back(std::move(item));
+  group.event_available.notify_all();
+}
+
+void MockController::generateEvents()
+{
+  using Clock = std::chrono::steady_clock;
+
+  std::unique_lock<std::mutex> lock{ mutex_ };
+  Clock::time_point next = Clock::now();
+
+  while (!stopping_)
+  {
+    double const rate = event_rate_.load();
+
+    if (rate <= 0.0)
+    {
+      generator_wakeup_.wait(lock, [this] { return stopping_ || event_rate_.load() > 0.0; });
+      next = Clock::now();
+      continue;
+    }
+
+    next += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>{ 1.0 / rate });
+
+    // Do not try to catch up after a long stall.
+    Clock::time_point const now = Clock::now();
+    if (next < now - std::chrono::seconds{ 1 })
+      next = now;
+
+    if (generator_wakeup_.wait_until(lock, next, [this] { return stopping_; }))
+      break;
+
+    for (auto& group : subscription_groups_)
+    {
+      for (auto const& subscription : group.second->resources)
+        queueEvent(*group.second, eventItem(subscription));
+    }
+  }
+}
+
+void MockController::delay()
+{
+  std::chrono::microseconds::rep duration = latency_.load();
+  std::chrono::microseconds::rep const jitter = jitter_.load();
+
+  if (jitter > 0)
+  {
+    std::lock_guard<std::mutex> lock{ random_mutex_ };
+    duration += std::uniform_int_distribution<std::chrono::microseconds::rep>{ 0, jitter }(random_);
+  }
+
+  if (duration > 0)
+    std::this_thread::sleep_for(std::chrono::microseconds{ duration });
+}
+
+bool MockController::injectServiceUnavailable()
+{
+  double const probability = service_unavailable_probability_.load();
+
+  if (probability <= 0.0)
+    return false;
+
+  std::lock_guard<std::mutex> lock{ random_mutex_ };
+  return std::bernoulli_distribution{ std::min(probability, 1.0) }(random_);
+}
+
+std::string MockController::baseURI() const
+{
+  bool const secure = !options_.certificate_file.empty() && !options_.private_key_file.empty();
+  return std::string{ secure ? "https" : "http" } + "://127.0.0.1:" + std::to_string(port_) + "/";
+}
+
+std::string MockController::xhtmlContentType() const
+{
+  return isVersion1() ? "application/xhtml+xml" : "application/xhtml+xml;v=2.0";
+}
+
+std::string MockController::document(std::string const& title, std::string const& items) const
+{
+  std::string content;
+  content.reserve(items.size() + 256);
+
+  content += "<?xml version=\"1.0\" encoding=\"utf-8\"?>";
+  content += "<html xmlns=\"http://www.w3.org/1999/xhtml\"><head><title>";
+  content += title;
+  content += "</title><base href=\"";
+  content += baseURI();
+  content += "\"/></head><body><div class=\"state\"><ul>";
+  content += items;
+  content += "</ul></div></body></html>";
+
+  return content;
+}
+}  // namespace abb::rws::mock
@@ -7,9 +7,98 @@
 #include <Poco/DOM/NodeIterator.h>
 #include <Poco/DOM/NodeList.h>
 #include <Poco/DOM/DOMParser.h>
+#include <Poco/DOM/Element.h>
+#include <Poco/SAX/Attributes.h>
+#include <Poco/SAX/DefaultHandler.h>
+#include <Poco/SAX/SAXParser.h>
+#include <Poco/String.h>
+
+#include <algorithm>
 
 namespace abb ::rws
 {
+namespace
+{
+/**
+ * \brief SAX content handler, which reports the fields requested by an \a XMLExtractQuery.
+ */
+class XMLExtractHandler : public Poco::XML::DefaultHandler
+{
+public:
+  XMLExtractHandler(XMLExtractQuery const& query, XMLFieldCallback const& on_field, XMLRecordCallback const& on_record)
+    : query_{ query }, on_field_{ on_field }, on_record_{ on_record }
+  {
+  }
+
+  void startElement(const Poco::XML::XMLString&, const Poco::XML::XMLString&, const Poco::XML::XMLString&,
+                    const Poco::XML::Attributes& attributes) override
+  {
+    ++depth_;
+
+    if (record_depth_ == 0)
+    {
+      if (attributes.getValue(query_.record.name) == query_.record.value)
+      {
+        record_depth_ = depth_;
+        record_key_ = attributes.getValue(query_.key_attribute);
+      }
+    }
+    else if (field_depth_ == 0)
+    {
+      Poco::XML::XMLString const& key = attributes.getValue(query_.key_attribute);
+
+      if (!key.empty() &&
+          (query_.keys.empty() || std::find(query_.keys.begin(), query_.keys.end(), key) != query_.keys.end()) &&
+          (query_.field.name.empty() || attributes.getValue(query_.field.name) == query_.field.value))
+      {
+        field_depth_ = depth_;
+        field_key_ = key;
+        text_.clear();
+      }
+    }
+  }
+
+  void endElement(const Poco::XML::XMLString&, const Poco::XML::XMLString&, const Poco::XML::XMLString&) override
+  {
+    if (field_depth_ == depth_)
+    {
+      field_depth_ = 0;
+      on_field_(field_key_, Poco::trimInPlace(text_));
+    }
+    else if (record_depth_ == depth_)
+    {
+      record_depth_ = 0;
+      if (on_record_)
+        on_record_(record_key_);
+    }
+
+    --depth_;
+  }
+
+  void characters(const Poco::XML::XMLChar ch[], int start, int length) override
+  {
+    if (field_depth_ != 0)
+      text_.append(ch + start, length);
+  }
+
+private:
+  XMLExtractQuery const& query_;
+  XMLFieldCallback const& on_field_;
+  XMLRecordCallback const& on_record_;
+
+  /**
+   * \brief Depth of the current element, and of the current record and field elements (0 if outside of one).
+   */
+  int depth_ = 0;
+  int record_depth_ = 0;
+  int field_depth_ = 0;
+
+  std::string record_key_;
+  std::string field_key_;
+  std::string text_;
+};
+}  // namespace
+
 Poco::AutoPtr<Poco::XML::Document> parseXml(std::string const& xml_string)
 {
   static thread_local Poco::XML::DOMParser parser;
@@ -118,6 +207,78 @@ std::string xmlFindTextContent(const Poco::XML::Node* p_node, const XMLAttribute
   return result;
 }
 
+XMLTextContentQuery::XMLTextContentQuery(std::initializer_list<XMLAttribute> attributes) : size_{ attributes.size() }
+{
+  std::size_t i = 0;
+  for (auto const& attribute : attributes)
+  {
+    auto by_name = std::find_if(index_.begin(), index_.end(),
+                                [&](auto const& entry) { return entry.first == attribute.name; });
+    if (by_name == index_.end())
+      by_name = index_.emplace(index_.end(), attribute.name, std::unordered_multimap<std::string, std::size_t>{});
+
+    by_name->second.emplace(attribute.value, i++);
+  }
+}
+
+std::vector<std::string> XMLTextContentQuery::find(const Poco::XML::Node* p_root) const
+{
+  std::vector<std::string> result(size_);
+  std::vector<bool> found(size_, false);
+  std::size_t remaining = size_;
+
+  // Depth-first traversal in document order, without allocating node lists or iterators.
+  const Poco::XML::Node* p_node = p_root;
+  while (p_node && remaining > 0)
+  {
+    if (p_node->nodeType() == Poco::XML::Node::ELEMENT_NODE)
+    {
+      auto const* p_element = static_cast<const Poco::XML::Element*>(p_node);
+
+      for (auto const& [name, by_value] : index_)
+      {
+        auto const range = by_value.equal_range(p_element->getAttribute(name));
+
+        for (auto it = range.first; it != range.second; ++it)
+        {
+          if (found[it->second])
+            continue;
+
+          for (const Poco::XML::Node* p_child = p_element->firstChild(); p_child; p_child = p_child->nextSibling())
+          {
+            if (p_child->nodeType() == Poco::XML::Node::TEXT_NODE)
+            {
+              result[it->second] = p_child->nodeValue();
+              found[it->second] = true;
+              --remaining;
+              break;
+            }
+          }
+        }
+      }
+    }
+
+    if (p_node->firstChild())
+    {
+      p_node = p_node->firstChild();
+    }
+    else
+    {
+      while (p_node != p_root && !p_node->nextSibling())
+        p_node = p_node->parentNode();
+
+      p_node = p_node == p_root ? nullptr : p_node->nextSibling();
+    }
+  }
+
+  return result;
+}
+
+std::vector<std::string> XMLTextContentQuery::find(Poco::AutoPtr<Poco::XML::Document> p_xml_document) const
+{
+  return find(p_xml_document.get());
+}
+
 std::string xmlNodeGetAttributeValue(const Poco::XML::Node* p_node, const std::string& name)
 {
   std::string result;
@@ -167,6 +328,16 @@ bool xmlNodeHasAttribute(const Poco::XML::Node* p_node, const std::string& name,
   return xmlNodeHasAttribute(p_node, XMLAttribute(name, value));
 }
 
+void xmlExtract(std::string const& xml_string, XMLExtractQuery const& query, XMLFieldCallback const& on_field,
+                XMLRecordCallback const& on_record)
+{
+  XMLExtractHandler handler{ query, on_field, on_record };
+
+  Poco::XML::SAXParser parser;
+  parser.setContentHandler(&handler);
+  parser.parseMemoryNP(xml_string.data(), xml_string.size());
+}
+
 std::string findSubstringContent(const std::string& whole_string, const std::string& substring_start,
                                  const std::string& substring_end)
 {
@@ -198,80 +369,68 @@ std::string findSubstringContent(const std::string& whole_string, const std::str
   return result;
 }
 
-unsigned int countCharInString(std::string input, const char character)
+unsigned int countCharInString(const std::string& input, const char character)
 {
-  bool done = false;
-  unsigned int count = 0;
-  size_t position = 0;
+  return static_cast<unsigned int>(std::count(input.begin(), input.end(), character));
+}
 
-  do
-  {
-    position = input.find_first_of(character);
+std::vector<std::string> extractDelimitedSubstrings(const std::string& input, const char start_delimiter,
+                                                    const char end_delimiter, const char separator)
+{
+  std::vector<std::string> values;
 
-    if (position != std::string::npos)
-    {
-      ++count;
-      input.erase(position, 1);
-    }
-    else
-    {
-      done = true;
-    }
-  } while (!done);
+  for (std::string_view const substring : splitDelimitedSubstrings(input, start_delimiter, end_delimiter, separator))
+    values.emplace_back(substring);
 
-  return count;
+  return values;
 }
 
-std::vector<std::string> extractDelimitedSubstrings(const std::string& input, const char start_delimiter,
-                                                    const char end_delimiter, const char separator)
+std::vector<std::string_view> splitDelimitedSubstrings(std::string_view input, const char start_delimiter,
+                                                       const char end_delimiter, const char separator)
 {
-  // Prepare the input by removing any starting and ending '[' respective ']'
-  std::string temp_0(input);
-  size_t position_1 = 0;
-  size_t position_2 = 0;
+  static constexpr char const* WHITESPACE = " \t\r\n";
 
-  position_1 = temp_0.find_first_of(start_delimiter);
-  position_2 = temp_0.find_last_of(end_delimiter);
+  // Remove the outermost delimiters (and any surrounding whitespace).
+  std::size_t const first = input.find_first_not_of(WHITESPACE);
+  std::size_t const last = input.find_last_not_of(WHITESPACE);
+  input = first == std::string_view::npos ? std::string_view{} : input.substr(first, last - first + 1);
 
-  if (position_1 != std::string::npos && position_2 != std::string::npos)
-  {
-    temp_0.erase(position_1, 1);
-    temp_0.erase(position_2 - 1, 1);
-  }
+  if (input.size() >= 2 && input.front() == start_delimiter && input.back() == end_delimiter)
+    input = input.substr(1, input.size() - 2);
 
-  // Extract and merge the delimited substrings in the prepared input string.
-  std::stringstream ss(temp_0);
-  std::vector<std::string> values;
-  std::string temp_1;
-  std::string temp_2;
-  int counter = 0;
+  std::vector<std::string_view> values;
+  auto const push = [&values](std::string_view value) {
+    std::size_t const begin = value.find_first_not_of(WHITESPACE);
+    if (begin != std::string_view::npos)
+      values.push_back(value.substr(begin, value.find_last_not_of(WHITESPACE) - begin + 1));
+  };
+
+  int depth = 0;
+  bool quoted = false;
+  std::size_t start = 0;
 
-  while (std::getline(ss, temp_1, separator))
+  for (std::size_t i = 0; i < input.size(); ++i)
   {
-    if (!temp_1.empty())
+    char const c = input[i];
+
+    // Note: RAPID escapes a double quote inside a string by doubling it, which toggles the state twice.
+    if (c == '"')
+      quoted = !quoted;
+    else if (quoted)
+      continue;
+    else if (c == start_delimiter)
+      ++depth;
+    else if (c == end_delimiter)
+      --depth;
+    else if (c == separator && depth == 0)
     {
-      counter += countCharInString(temp_1, start_delimiter);
-      counter -= countCharInString(temp_1, end_delimiter);
-
-      if (counter == 0)
-      {
-        if (!temp_2.empty())
-        {
-          values.push_back(temp_2 + temp_1);
-          temp_2 = "";
-        }
-        else
-        {
-          values.push_back(temp_1);
-        }
-      }
-      else
-      {
-        temp_2 += temp_1 + ",";
-      }
+      push(input.substr(start, i - start));
+      start = i + 1;
     }
   }
 
+  push(input.substr(start));
+
   return values;
 }
 }  // namespace abb::rws
\ No newline at end of file
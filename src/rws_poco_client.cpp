@@ -34,6 +34,7 @@
  ***********************************************************************************************************************
  */
 
+#include <algorithm>
 #include <sstream>
 #include <iostream>
 
@@ -56,9 +57,15 @@ namespace rws
  */
 
 POCOClient::POCOClient(Poco::Net::HTTPClientSession& session, const std::string& username, const std::string& password)
-  : http_client_session_{ session }, http_credentials_{ username, password }
+  : session_pool_{ session }, http_credentials_{ username, password }
+{
+}
+
+POCOClient::POCOClient(POCOSessionPool::SessionFactory session_factory, const std::string& username,
+                       const std::string& password, std::size_t session_pool_size, bool session_metrics)
+  : session_pool_{ std::move(session_factory), session_pool_size, session_metrics }
+  , http_credentials_{ username, password }
 {
-  http_client_session_.setKeepAlive(true);
 }
 
 POCOClient::~POCOClient()
@@ -72,16 +79,17 @@ POCOClient::~POCOClient()
  POCOResult POCOClient::httpAuthenticate(const std::string& uri)
 {
       // The response and the request.
-      HTTPResponse response;
-      std::string response_content;
+      auto const response = std::make_shared<HTTPResponse>();
+      std::shared_ptr<std::string const> response_content;
       std::string content;
 
       HTTPRequest request(HTTPRequest::HTTP_GET, uri, HTTPRequest::HTTP_1_1);
       request.setCredentials("Basic", "RGVmYXVsdCBVc2VyOnJvYm90aWNz");
       request.add("accept", "application/xhtml+xml;v=2.0");
 
-      authenticate(request, response, content, response_content);
-      return POCOResult{ response.getStatus(), response.getReason(), response, response_content };
+      auto lease = session_pool_.acquire();
+      authenticate(lease.session(), request, *response, content, response_content);
+      return POCOResult{ response, std::move(response_content), request.getMethod(), uri };
 }
 
 
@@ -108,13 +116,13 @@ POCOResult POCOClient::httpDelete(const std::string& uri)
 POCOResult POCOClient::makeHTTPRequest(const std::string& method, const std::string& uri, const std::string& content,
                      const std::string& content_type)
 {
-  // The response and the request.
-  HTTPResponse response;
-  std::string response_content;
+  // The response and the request. The response is shared with the returned result, so that it is not copied.
+  auto const response = std::make_shared<HTTPResponse>();
+  std::shared_ptr<std::string const> response_content;
 
   HTTPRequest request(method, uri, HTTPRequest::HTTP_1_1);
   request.add("accept", "application/xhtml+xml;v=2.0");
-  request.setCookies(cookies_);
+  request.setCookies(getCookies());
   request.setContentLength(content.length());
 
   if (!content_type.empty())
@@ -126,47 +134,50 @@ POCOResult POCOClient::makeHTTPRequest(const std::string& method, const std::str
     request.setContentType("application/x-www-form-urlencoded");
   }
 
+  // Use the same session for the whole request, including retries and authentication.
+  auto lease = session_pool_.acquire();
+
   // Attempt the communication.
   try
-  { 
-    sendAndReceive(request, response, content, response_content);
+  {
+    // Without a session cookie the server will ask for credentials, so send them right away.
+    addPreemptiveCredentials(request);
+    sendAndReceive(lease.session(), request, *response, content, response_content);
 
     // Check if the server has sent an update for the cookies.
-    std::vector<HTTPCookie> temp_cookies;
-    response.getCookies(temp_cookies);
-    for (size_t i = 0; i < temp_cookies.size(); ++i)
-    {
-      if (cookies_.find(temp_cookies[i].getName()) != cookies_.end())
-      {
-        cookies_.set(temp_cookies[i].getName(), temp_cookies[i].getValue());
-      }
-      else
-      {
-        cookies_.add(temp_cookies[i].getName(), temp_cookies[i].getValue());
-      }
-    }
+    storeCookies(*response);
 
     // Check if there was a server error, if so, make another attempt with a clean sheet.
-    if (response.getStatus() >= HTTPResponse::HTTP_INTERNAL_SERVER_ERROR)
+    if (response->getStatus() >= HTTPResponse::HTTP_INTERNAL_SERVER_ERROR)
     {
-      http_client_session_.reset();
+      request_metrics_.countServerErrorReset();
+      request_metrics_.countRetry();
+
+      lease.reset();
       request.erase(HTTPRequest::COOKIE);
-      sendAndReceive(request, response, content, response_content);
+      addPreemptiveCredentials(request);
+      sendAndReceive(lease.session(), request, *response, content, response_content);
     }
 
-    // Check if the request was unauthorized, if so add credentials.
-    if (response.getStatus() == HTTPResponse::HTTP_UNAUTHORIZED)
+    // Check if the request was unauthorized (e.g. the cookie or the preemptive credentials were rejected),
+    // if so add credentials according to the server's challenge.
+    if (response->getStatus() == HTTPResponse::HTTP_UNAUTHORIZED)
     {
-      authenticate(request, response, content, response_content);
+      request_metrics_.countReauthentication();
+      request_metrics_.countRetry();
+
+      authenticate(lease.session(), request, *response, content, response_content);
     }
 
-    return POCOResult{ response.getStatus(), response.getReason(), response, response_content };
+    return POCOResult{ response, std::move(response_content), method, uri };
   }
   catch (CommunicationError const&)
   {
+    request_metrics_.countCommunicationError();
+
     // If an error occurred, clear the cookies and reset the session.
-    cookies_.clear();
-    http_client_session_.reset();
+    clearCookies();
+    lease.reset();
 
     throw;
   }
@@ -179,7 +190,8 @@ Poco::Net::WebSocket POCOClient::webSocketConnect(const std::string& uri, const
   HTTPResponse response;
   HTTPRequest request(HTTPRequest::HTTP_GET, uri, HTTPRequest::HTTP_1_1);
   request.set("Sec-WebSocket-Protocol", protocol);
-  request.setCookies(cookies_);
+  request.setCookies(getCookies());
+  addPreemptiveCredentials(request);
 
   // Attempt the communication.
   try
@@ -207,25 +219,43 @@ Poco::Net::WebSocket POCOClient::webSocketConnect(const std::string& uri, const
  * Auxiliary methods
  */
 
-void POCOClient::sendAndReceive(HTTPRequest& request, HTTPResponse& response, const std::string& request_content,
-                                std::string& response_content)
+void POCOClient::sendAndReceive(HTTPClientSession& session, HTTPRequest& request, HTTPResponse& response,
+                                const std::string& request_content,
+                                std::shared_ptr<std::string const>& response_content)
 {
-  HTTPInfo log_entry;
-
-  // Add request info to the log entry.
-  log_entry.addHTTPRequestInfo(request, request_content);
-
   // Add cookies to the request.
-  if (cookies_.size() > 0)
+  NameValueCollection const cookies = getCookies();
+  if (cookies.size() > 0)
   {
-    request.setCookies(cookies_);
+    request.setCookies(cookies);
   }
 
+  bool const collect_metrics = request_metrics_.enabled();
+  RequestMetrics::Timestamps timestamps;
+
   // Contact the server.
   try
   {
-    std::ostream& request_content_stream = http_client_session_.sendRequest(request);
+    if (collect_metrics)
+    {
+      timestamps.reconnected = !session.connected();
+      timestamps.start = RequestMetrics::Clock::now();
+    }
+
+    // Connects (and performs the TLS handshake) if needed, then sends the request header.
+    std::ostream& request_content_stream = session.sendRequest(request);
+
+    if (collect_metrics)
+    {
+      timestamps.header_sent = RequestMetrics::Clock::now();
+    }
+
     request_content_stream << request_content;
+
+    if (collect_metrics)
+    {
+      timestamps.sent = RequestMetrics::Clock::now();
+    }
   }
   catch (Poco::Exception const& e)
   {
@@ -237,10 +267,28 @@ void POCOClient::sendAndReceive(HTTPRequest& request, HTTPResponse& response, co
 
   try
   {
-    std::istream& response_content_stream = http_client_session_.receiveResponse(response);
+    std::istream& response_content_stream = session.receiveResponse(response);
+
+    if (collect_metrics)
+    {
+      timestamps.headers_received = RequestMetrics::Clock::now();
+    }
+
+    // Read the content once, directly into a buffer of the announced size.
+    auto content = std::make_shared<std::string>();
+    if (response.hasContentLength() && response.getContentLength64() > 0)
+    {
+      Poco::Int64 const reserve = std::min<Poco::Int64>(response.getContentLength64(), MAX_CONTENT_RESERVE);
+      content->reserve(static_cast<std::size_t>(reserve));
+    }
+
+    StreamCopier::copyToString(response_content_stream, *content);
+    response_content = std::move(content);
 
-    response_content.clear();
-    StreamCopier::copyToString(response_content_stream, response_content);
+    if (collect_metrics)
+    {
+      timestamps.received = RequestMetrics::Clock::now();
+    }
   }
   catch (Poco::Exception const& e)
   {
@@ -250,122 +298,132 @@ void POCOClient::sendAndReceive(HTTPRequest& request, HTTPResponse& response, co
                           << boost::errinfo_nested_exception{ boost::current_exception() });
   }
 
-  // Add response info to the log entry.
-  log_entry.addHTTPResponseInfo(response, response_content);
-
-  // Add entry to the log.
-  if (log_.size() >= LOG_SIZE)
+  if (collect_metrics)
   {
-    log_.pop_back();
+    request_metrics_.recordExchange(request.getMethod(), request.getURI(), timestamps);
   }
 
-  log_.push_front(log_entry);
+  // Add the exchange to the log.
+  log_.add(request, request_content, response, response_content);
 }
 
-void POCOClient::authenticate(HTTPRequest& request, HTTPResponse& response, const std::string& request_content,
-                              std::string& response_content)
+void POCOClient::authenticate(HTTPClientSession& session, HTTPRequest& request, HTTPResponse& response,
+                              const std::string& request_content,
+                              std::shared_ptr<std::string const>& response_content)
 {
   // Authenticate with the provided credentials.
-  http_credentials_.authenticate(request, response);
+  {
+    std::lock_guard<std::mutex> lock{ credentials_mutex_ };
+    http_credentials_.authenticate(request, response);
+  }
 
   // Contact the server, and extract and store the received cookies.
-  sendAndReceive(request, response, request_content, response_content);
+  sendAndReceive(session, request, response, request_content, response_content);
+
+  // Remember the negotiated authorization, to send credentials preemptively when there is no session cookie.
+  {
+    std::lock_guard<std::mutex> lock{ credentials_mutex_ };
+
+    if (response.getStatus() != HTTPResponse::HTTP_UNAUTHORIZED && request.has(HTTPRequest::AUTHORIZATION))
+    {
+      authorization_ = request.get(HTTPRequest::AUTHORIZATION);
+    }
+    else
+    {
+      authorization_.clear();
+    }
+  }
 
   // Update cookies with the ones received in the response.
-  // std::vector<HTTPCookie> temp_cookies;
-  // response.getCookies(temp_cookies);
+  std::lock_guard<std::mutex> lock{ cookies_mutex_ };
+
   for (const auto& header : response)
   {
     if (header.first == HTTPResponse::SET_COOKIE)
     {
-      // std::cout << "[DEBUG] Received cookie: " << header.second << std::endl;
-      HTTPCookie cookie(header.second);
       extractAndStoreCookie(header.second);
     }
   }
 }
 
-void POCOClient::extractAndStoreCookie(const std::string& cookie_string)
+bool POCOClient::addPreemptiveCredentials(HTTPRequest& request)
 {
-  // Find the positions of the cookie delimiters.
-  size_t position_1 = cookie_string.find_first_of("=");
-  size_t position_2 = cookie_string.find_first_of(";");
-
-  // Extract and store the cookie (if the delimiters was found).
-  if (position_1 != std::string::npos && position_2 != std::string::npos)
+  if (!getCookies().empty())
   {
-    std::string result = cookie_string.substr(0, position_1++);
-    std::string result2 = cookie_string.substr(position_1, position_2 - position_1);
+    return false;
+  }
 
-    cookies_.set(result, result2);
+  std::lock_guard<std::mutex> lock{ credentials_mutex_ };
+
+  if (authorization_.empty())
+  {
+    return false;
   }
+
+  // Start from the previously accepted authorization and let the credentials update it for this request
+  // (new URI, and incremented nonce count in case of digest authentication).
+  request.set(HTTPRequest::AUTHORIZATION, authorization_);
+  http_credentials_.updateAuthInfo(request);
+
+  return true;
 }
 
-std::string POCOClient::getLogText(bool verbose) const
+void POCOClient::storeCookies(const HTTPResponse& response)
 {
-  if (log_.size() == 0)
-  {
-    return "";
-  }
+  std::vector<HTTPCookie> temp_cookies;
+  response.getCookies(temp_cookies);
 
-  std::stringstream ss;
+  std::lock_guard<std::mutex> lock{ cookies_mutex_ };
 
-  for (size_t i = 0; i < log_.size(); ++i)
+  for (size_t i = 0; i < temp_cookies.size(); ++i)
   {
-    std::stringstream temp;
-    temp << i + 1 << ". ";
-    ss << temp.str() << log_[i].toString(verbose, temp.str().size()) << std::endl;
+    if (cookies_.find(temp_cookies[i].getName()) != cookies_.end())
+    {
+      cookies_.set(temp_cookies[i].getName(), temp_cookies[i].getValue());
+    }
+    else
+    {
+      cookies_.add(temp_cookies[i].getName(), temp_cookies[i].getValue());
+    }
   }
-
-  return ss.str();
 }
 
-std::string POCOClient::getLogTextLatestEvent(bool verbose) const
+NameValueCollection POCOClient::getCookies() const
 {
-  return (log_.size() == 0 ? "" : log_[0].toString(verbose, 0));
+  std::lock_guard<std::mutex> lock{ cookies_mutex_ };
+  return cookies_;
 }
 
-void POCOClient::HTTPInfo::addHTTPRequestInfo(const Poco::Net::HTTPRequest& request, const std::string& request_content)
+void POCOClient::clearCookies()
 {
-  this->request = { request.getMethod(), request.getURI(), request_content };
+  std::lock_guard<std::mutex> lock{ cookies_mutex_ };
+  cookies_.clear();
 }
 
-void POCOClient::HTTPInfo::addHTTPResponseInfo(const Poco::Net::HTTPResponse& response,
-                                               const std::string& response_content)
+void POCOClient::extractAndStoreCookie(const std::string& cookie_string)
 {
-  std::string header_info;
+  // Find the positions of the cookie delimiters.
+  size_t position_1 = cookie_string.find_first_of("=");
+  size_t position_2 = cookie_string.find_first_of(";");
 
-  for (HTTPResponse::ConstIterator i = response.begin(); i != response.end(); ++i)
+  // Extract and store the cookie (if the delimiters was found).
+  if (position_1 != std::string::npos && position_2 != std::string::npos)
   {
-    header_info += i->first + "=" + i->second + "\n";
-  }
+    std::string result = cookie_string.substr(0, position_1++);
+    std::string result2 = cookie_string.substr(position_1, position_2 - position_1);
 
-  this->response = HTTPInfo::ResponseInfo{ response.getStatus(), header_info, response_content };
+    cookies_.set(result, result2);
+  }
 }
 
-std::string POCOClient::HTTPInfo::toString(bool verbose, size_t indent) const
+std::string POCOClient::getLogText(bool verbose) const
 {
-  std::stringstream ss;
-
-  std::string seperator = (indent == 0 ? " | " : "\n" + std::string(indent, ' '));
-
-  if (request)
-  {
-    ss << seperator << "HTTP Request: " << request->method << " " << request->uri;
-  }
-
-  if (response)
-  {
-    ss << seperator << "HTTP Response: " << response->status << " - "
-       << HTTPResponse::getReasonForStatus(response->status);
-
-    if (verbose)
-    {
-      ss << seperator << "HTTP Response Content: " << response->content;
-    }
-  }
+  return log_.getText(verbose);
+}
 
-  return ss.str();
+std::string POCOClient::getLogTextLatestEvent(bool verbose) const
+{
+  return log_.getTextLatestEvent(verbose);
 }
 
 }  // end namespace rws
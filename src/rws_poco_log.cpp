@@ -0,0 +1,119 @@
+#include <abb_librws/rws_poco_log.h>
+
+#include <sstream>
+
+using namespace Poco::Net;
+
+namespace abb ::rws
+{
+/***********************************************************************************************************************
+ * Class definitions: POCOLog
+ */
+
+POCOLog::POCOLog(HTTPLogMode mode, std::size_t content_limit) : mode_{ mode }, content_limit_{ content_limit }
+{
+}
+
+void POCOLog::setMode(HTTPLogMode mode, std::size_t content_limit)
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  content_limit_ = content_limit;
+  mode_.store(mode, std::memory_order_relaxed);
+}
+
+void POCOLog::add(HTTPRequest const& request, std::string const& request_content, HTTPResponse const& response,
+                  std::shared_ptr<std::string const> const& response_content)
+{
+  HTTPLogMode const mode = mode_.load(std::memory_order_relaxed);
+
+  if (mode == HTTPLogMode::OFF)
+    return;
+
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  // Overwrite the oldest entry, reusing its buffers.
+  Entry& entry = entries_[next_];
+  next_ = (next_ + 1) % CAPACITY;
+  if (size_ < CAPACITY)
+    ++size_;
+
+  entry.method.assign(request.getMethod());
+  entry.uri.assign(request.getURI());
+  entry.request_content_size = request_content.size();
+  entry.status = response.getStatus();
+  entry.response_content_size = response_content ? response_content->size() : 0;
+  entry.response_content.reset();
+  entry.response_content_prefix.clear();
+  entry.has_content = false;
+
+  if (mode == HTTPLogMode::FULL && response_content)
+  {
+    if (response_content->size() <= content_limit_)
+      entry.response_content = response_content;
+    else
+      entry.response_content_prefix.assign(*response_content, 0, content_limit_);
+
+    entry.has_content = true;
+  }
+}
+
+void POCOLog::clear()
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  for (auto& entry : entries_)
+    entry.response_content.reset();
+
+  size_ = 0;
+}
+
+std::string POCOLog::getText(bool verbose) const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  std::stringstream ss;
+
+  for (std::size_t i = 0; i < size_; ++i)
+  {
+    std::string const number = std::to_string(i + 1) + ". ";
+    ss << number << recent(i).toString(verbose, number.size()) << std::endl;
+  }
+
+  return ss.str();
+}
+
+std::string POCOLog::getTextLatestEvent(bool verbose) const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  return size_ == 0 ? "" : recent(0).toString(verbose, 0);
+}
+
+std::string POCOLog::Entry::toString(bool verbose, std::size_t indent) const
+{
+  std::stringstream ss;
+
+  std::string seperator = (indent == 0 ? " | " : "\n" + std::string(indent, ' '));
+
+  ss << seperator << "HTTP Request: " << method << " " << uri;
+  ss << seperator << "HTTP Response: " << status << " - " << HTTPResponse::getReasonForStatus(status);
+
+  if (verbose)
+  {
+    ss << seperator << "HTTP Request Content Size: " << request_content_size;
+    ss << seperator << "HTTP Response Content Size: " << response_content_size;
+
+    if (has_content)
+    {
+      ss << seperator << "HTTP Response Content: ";
+
+      if (response_content)
+        ss << *response_content;
+      else
+        ss << response_content_prefix << "... (truncated)";
+    }
+  }
+
+  return ss.str();
+}
+}  // namespace abb::rws
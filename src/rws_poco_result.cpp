@@ -3,6 +3,7 @@
 #include <Poco/Net/WebSocket.h>
 
 #include <sstream>
+#include <utility>
 
 using namespace Poco;
 using namespace Poco::Net;
@@ -12,10 +13,24 @@ namespace abb ::rws
 /***********************************************************************************************************************
  * Struct definitions: POCOResult
  */
+POCOResult::POCOResult(std::shared_ptr<Poco::Net::HTTPResponse const> response,
+                       std::shared_ptr<std::string const> content, std::string method, std::string uri)
+  : response_{ std::move(response) }
+  , content_{ std::move(content) }
+  , method_{ std::move(method) }
+  , uri_{ std::move(uri) }
+{
+}
+
 POCOResult::POCOResult(Poco::Net::HTTPResponse::HTTPStatus http_status, std::string const& reason,
                        Poco::Net::NameValueCollection const& header_info, std::string const& content)
-  : httpStatus_{ http_status }
-  , reason_{ reason }
-  , headerInfo_(header_info.begin(), header_info.end())
-  , content_{ content } {};
-}  // namespace abb::rws
\ No newline at end of file
+  : content_{ std::make_shared<std::string const>(content) }
+{
+  auto response = std::make_shared<HTTPResponse>(http_status, reason);
+
+  for (auto const& header : header_info)
+    response->add(header.first, header.second);
+
+  response_ = std::move(response);
+}
+}  // namespace abb::rws
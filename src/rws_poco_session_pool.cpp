@@ -0,0 +1,166 @@
+#include <abb_librws/rws_poco_session_pool.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace abb ::rws
+{
+/***********************************************************************************************************************
+ * Class definitions: POCOSessionPool::Lease
+ */
+
+POCOSessionPool::Lease::Lease(POCOSessionPool& pool, Slot& slot, std::chrono::steady_clock::time_point acquired)
+  : pool_{ &pool }, slot_{ &slot }, acquired_{ acquired }
+{
+}
+
+POCOSessionPool::Lease::Lease(Lease&& other) noexcept
+  : pool_{ std::exchange(other.pool_, nullptr) }
+  , slot_{ std::exchange(other.slot_, nullptr) }
+  , acquired_{ other.acquired_ }
+{
+}
+
+POCOSessionPool::Lease::~Lease()
+{
+  if (pool_)
+    pool_->release(*slot_, acquired_);
+}
+
+void POCOSessionPool::Lease::reset()
+{
+  slot_->session->reset();
+
+  if (pool_->collect_statistics_)
+  {
+    std::lock_guard<std::mutex> lock{ pool_->mutex_ };
+    ++slot_->statistics.resets;
+  }
+}
+
+/***********************************************************************************************************************
+ * Class definitions: POCOSessionPool
+ */
+
+POCOSessionPool::POCOSessionPool(SessionFactory session_factory, std::size_t size, bool collect_statistics)
+  : session_factory_{ std::move(session_factory) }
+  , size_{ std::max<std::size_t>(size, 1) }
+  , collect_statistics_{ collect_statistics }
+{
+  slots_.reserve(size_);
+  idle_.reserve(size_);
+}
+
+POCOSessionPool::POCOSessionPool(Poco::Net::HTTPClientSession& session, bool collect_statistics)
+  : size_{ 1 }, collect_statistics_{ collect_statistics }
+{
+  // Wrap the externally owned session without taking ownership.
+  auto slot = std::make_unique<Slot>();
+  slot->session = std::shared_ptr<Poco::Net::HTTPClientSession>{ &session, [](Poco::Net::HTTPClientSession*) {} };
+  slot->session->setKeepAlive(true);
+
+  idle_.push_back(slot.get());
+  slots_.push_back(std::move(slot));
+}
+
+POCOSessionPool::Lease POCOSessionPool::acquire()
+{
+  auto const start = std::chrono::steady_clock::now();
+  std::unique_lock<std::mutex> lock{ mutex_ };
+
+  if (idle_.empty() && slots_.size() < size_)
+  {
+    auto slot = std::make_unique<Slot>();
+    slot->session = session_factory_();
+    slot->session->setKeepAlive(true);
+    slot->settings_generation = settings_generation_;
+
+    if (timeout_)
+      slot->session->setTimeout(*timeout_);
+
+    idle_.push_back(slot.get());
+    slots_.push_back(std::move(slot));
+  }
+
+  available_.wait(lock, [this] { return !idle_.empty(); });
+
+  Slot& slot = *idle_.back();
+  idle_.pop_back();
+
+  if (slot.settings_generation != settings_generation_)
+    applySettings(slot);
+
+  auto const acquired = std::chrono::steady_clock::now();
+
+  if (collect_statistics_)
+  {
+    ++slot.statistics.requests;
+    slot.statistics.wait_time += acquired - start;
+  }
+
+  return Lease{ *this, slot, acquired };
+}
+
+void POCOSessionPool::setTimeout(Poco::Timespan const& timeout)
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  timeout_ = timeout;
+  ++settings_generation_;
+
+  for (Slot* slot : idle_)
+    applySettings(*slot);
+}
+
+void POCOSessionPool::resetAll()
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  ++settings_generation_;
+
+  for (Slot* slot : idle_)
+    applySettings(*slot);
+}
+
+std::vector<POCOSessionPool::SessionStatistics> POCOSessionPool::getStatistics() const
+{
+  std::vector<SessionStatistics> statistics;
+
+  if (collect_statistics_)
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+
+    statistics.reserve(slots_.size());
+    for (auto const& slot : slots_)
+      statistics.push_back(slot->statistics);
+  }
+
+  return statistics;
+}
+
+void POCOSessionPool::release(Slot& slot, std::chrono::steady_clock::time_point acquired)
+{
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+
+    if (collect_statistics_)
+      slot.statistics.busy_time += std::chrono::steady_clock::now() - acquired;
+
+    idle_.push_back(&slot);
+  }
+
+  available_.notify_one();
+}
+
+void POCOSessionPool::applySettings(Slot& slot)
+{
+  if (timeout_)
+    slot.session->setTimeout(*timeout_);
+
+  slot.session->reset();
+  slot.settings_generation = settings_generation_;
+
+  if (collect_statistics_)
+    ++slot.statistics.resets;
+}
+}  // namespace abb::rws
@@ -34,8 +34,16 @@
  ***********************************************************************************************************************
  */
 
-#include <sstream>
+#include <charconv>
+#include <cmath>
+#include <stdexcept>
+
+#if !defined(__cpp_lib_to_chars)
+#include <algorithm>
 #include <iomanip>
+#include <locale>
+#include <sstream>
+#endif
 
 #include <abb_librws/system_constants.h>
 #include <abb_librws/rws_rapid.h>
@@ -46,6 +54,78 @@ namespace rws
 {
 typedef SystemConstants::RAPID RAPID;
 
+namespace
+{
+/**
+ * \brief Write a RAPID num/dnum value string into a buffer.
+ *
+ * Produces the same characters as stream formatting with std::setprecision(precision), and std::fixed for values
+ * with absolute value greater than 1, but without constructing a stream or depending on the global locale.
+ *
+ * Floating point std::to_chars() requires a recent standard library (e.g. libstdc++ of GCC 11). Otherwise a stream
+ * with the classic locale is used.
+ */
+template <typename T>
+char* formatRAPIDNumber(char* first, char* last, T value, int precision)
+{
+  // Use fixed format for floating point values with absolute value greater than 1,
+  // otherwise RWS can complain about exponential notation with a positive exponent.
+#if defined(__cpp_lib_to_chars)
+  std::to_chars_result const result = std::abs(value) > T(1) ?
+                                          std::to_chars(first, last, value, std::chars_format::fixed, precision) :
+                                          std::to_chars(first, last, value, std::chars_format::general, precision);
+
+  if (result.ec != std::errc())
+    BOOST_THROW_EXCEPTION(std::length_error{ "Buffer is too small for the RAPID value string" });
+
+  return result.ptr;
+#else
+  std::ostringstream ss;
+  ss.imbue(std::locale::classic());
+
+  if (std::abs(value) > T(1))
+    ss << std::fixed;
+
+  ss << std::setprecision(precision) << value;
+
+  std::string const str = ss.str();
+  if (str.size() > static_cast<std::size_t>(last - first))
+    BOOST_THROW_EXCEPTION(std::length_error{ "Buffer is too small for the RAPID value string" });
+
+  return std::copy(str.begin(), str.end(), first);
+#endif
+}
+
+/**
+ * \brief Parse a RAPID num/dnum value string, accepting what stream extraction accepted.
+ */
+template <typename T>
+T parseRAPIDNumber(std::string_view value_string)
+{
+  std::size_t const start = value_string.find_first_not_of(" \t\r\n");
+  if (start == std::string_view::npos)
+    return T(0);
+
+  value_string.remove_prefix(start);
+  if (value_string.front() == '+')
+    value_string.remove_prefix(1);
+
+  T value = T(0);
+#if defined(__cpp_lib_to_chars)
+  if (std::from_chars(value_string.data(), value_string.data() + value_string.size(), value).ec != std::errc())
+    return T(0);
+#else
+  std::istringstream ss{ std::string{ value_string } };
+  ss.imbue(std::locale::classic());
+
+  if (!(ss >> value))
+    return T(0);
+#endif
+
+  return value;
+}
+}  // namespace
+
 /***********************************************************************************************************************
  * Struct definitions: RAPIDAtomic<RAPIDAtomicTypes>
  */
@@ -81,30 +161,26 @@ std::string RAPIDAtomic<RAPID_BOOL>::constructString() const
 
 std::string RAPIDAtomic<RAPID_NUM>::constructString() const
 {
-  std::stringstream ss;
+  char buffer[MAX_STRING_SIZE];
 
-  // Use fixed format for floating point values with absolute value greater than 1,
-  // otherwise RWS can complain about exponential notation with a positive exponent.
-  if (std::abs(value) > 1.f)
-    ss << std::fixed;
-
-  ss << std::setprecision(SINGLE_PRECISION_DIGITS) << value;
+  return std::string(buffer, constructString(buffer, buffer + MAX_STRING_SIZE));
+}
 
-  return ss.str();
+char* RAPIDAtomic<RAPID_NUM>::constructString(char* first, char* last) const
+{
+  return formatRAPIDNumber(first, last, value, SINGLE_PRECISION_DIGITS);
 }
 
 std::string RAPIDAtomic<RAPID_DNUM>::constructString() const
 {
-  std::stringstream ss;
+  char buffer[MAX_STRING_SIZE];
 
-  // Use fixed format for floating point values with absolute value greater than 1,
-  // otherwise RWS can complain about exponential notation with a positive exponent.
-  if (std::abs(value) > 1.)
-    ss << std::fixed;
-
-  ss << std::setprecision(DOUBLE_PRECISION_DIGITS) << value;
+  return std::string(buffer, constructString(buffer, buffer + MAX_STRING_SIZE));
+}
 
-  return ss.str();
+char* RAPIDAtomic<RAPID_DNUM>::constructString(char* first, char* last) const
+{
+  return formatRAPIDNumber(first, last, value, DOUBLE_PRECISION_DIGITS);
 }
 
 std::string RAPIDAtomic<RAPID_STRING>::constructString() const
@@ -114,25 +190,51 @@ std::string RAPIDAtomic<RAPID_STRING>::constructString() const
 
 void RAPIDAtomic<RAPID_BOOL>::parseString(const std::string& value_string)
 {
-  value = value_string.compare(RAPID::RAPID_TRUE) == 0 ? true : false;
+  parseStringView(value_string);
+}
+
+void RAPIDAtomic<RAPID_BOOL>::parseStringView(std::string_view value_string)
+{
+  value = value_string == RAPID::RAPID_TRUE;
+}
+
+void RAPIDAtomic<RAPID_NUM>::parseString(const std::string& value_string)
+{
+  parseStringView(value_string);
+}
+
+void RAPIDAtomic<RAPID_NUM>::parseStringView(std::string_view value_string)
+{
+  value = parseRAPIDNumber<float>(value_string);
+}
+
+void RAPIDAtomic<RAPID_DNUM>::parseString(const std::string& value_string)
+{
+  parseStringView(value_string);
+}
+
+void RAPIDAtomic<RAPID_DNUM>::parseStringView(std::string_view value_string)
+{
+  value = parseRAPIDNumber<double>(value_string);
 }
 
 void RAPIDAtomic<RAPID_STRING>::parseString(const std::string& value_string)
 {
-  std::string temp = value_string;
+  parseStringView(value_string);
+}
 
-  size_t position = temp.find_first_of("\"");
-  if (position == 0)
+void RAPIDAtomic<RAPID_STRING>::parseStringView(std::string_view value_string)
+{
+  if (!value_string.empty() && value_string.front() == '"')
   {
-    temp.erase(position, 1);
+    value_string.remove_prefix(1);
   }
-  position = temp.find_last_of("\"");
-  if (position == temp.size() - 1)
+  if (!value_string.empty() && value_string.back() == '"')
   {
-    temp.erase(position, 1);
+    value_string.remove_suffix(1);
   }
 
-  value = temp;
+  value.assign(value_string.data(), value_string.size());
 }
 
 /***********************************************************************************************************************
@@ -154,36 +256,39 @@ std::string RAPIDRecord::getType() const
 
 void RAPIDRecord::parseString(const std::string& value_string)
 {
-  std::vector<std::string> substrings = extractDelimitedSubstrings(value_string, '[', ']', ',');
+  parseStringView(value_string);
+}
+
+void RAPIDRecord::parseStringView(std::string_view value_string)
+{
+  std::vector<std::string_view> const substrings = splitDelimitedSubstrings(value_string, '[', ']', ',');
 
   if (components_.size() == substrings.size())
   {
     for (size_t i = 0; i < components_.size(); ++i)
     {
-      components_.at(i)->parseString(substrings.at(i));
+      components_.at(i)->parseStringView(substrings.at(i));
     }
   }
 }
 
 std::string RAPIDRecord::constructString() const
 {
-  std::stringstream ss;
-
-  ss << "[";
+  std::string result = "[";
 
   for (size_t i = 0; i < components_.size(); ++i)
   {
-    ss << components_.at(i)->constructString();
+    result += components_.at(i)->constructString();
 
     if (i != components_.size() - 1)
     {
-      ss << ",";
+      result += ',';
     }
   }
 
-  ss << "]";
+  result += ']';
 
-  return ss.str();
+  return result;
 }
 
 RAPIDRecord& RAPIDRecord::operator=(const RAPIDRecord& other)
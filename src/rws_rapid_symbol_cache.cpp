@@ -0,0 +1,72 @@
+#include <abb_librws/rws_rapid_symbol_cache.h>
+
+namespace abb ::rws
+{
+std::optional<RAPIDSymbolInfo> RAPIDSymbolCache::find(RAPIDResource const& resource) const
+{
+  std::string const key = makeKey(resource);
+
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  auto const it = symbols_.find(key);
+  if (it == symbols_.end())
+  {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return std::nullopt;
+  }
+
+  hits_.fetch_add(1, std::memory_order_relaxed);
+  return it->second;
+}
+
+void RAPIDSymbolCache::insert(RAPIDResource const& resource, RAPIDSymbolInfo info)
+{
+  std::string key = makeKey(resource);
+
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  symbols_.insert_or_assign(std::move(key), std::move(info));
+}
+
+void RAPIDSymbolCache::erase(RAPIDResource const& resource)
+{
+  std::string const key = makeKey(resource);
+
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  symbols_.erase(key);
+}
+
+std::shared_ptr<RAPIDSchema const> RAPIDSymbolCache::findSchema(std::string const& type_url) const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  auto const it = schemas_.find(type_url);
+  if (it == schemas_.end())
+  {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  hits_.fetch_add(1, std::memory_order_relaxed);
+  return it->second;
+}
+
+void RAPIDSymbolCache::insertSchema(std::string type_url, std::shared_ptr<RAPIDSchema const> schema)
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  schemas_.insert_or_assign(std::move(type_url), std::move(schema));
+}
+
+void RAPIDSymbolCache::clear()
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  symbols_.clear();
+  schemas_.clear();
+  invalidations_.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::string RAPIDSymbolCache::makeKey(RAPIDResource const& resource)
+{
+  return resource.task + "/" + resource.module + "/" + resource.name;
+}
+}  // namespace abb::rws
@@ -0,0 +1,371 @@
+#include <abb_librws/rws_rapid_value.h>
+#include <abb_librws/system_constants.h>
+
+#include <boost/throw_exception.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+#include <system_error>
+
+namespace abb ::rws
+{
+namespace
+{
+/**
+ * \brief Parses an atomic value, replacing the stored value.
+ */
+void parseAtomic(RAPIDAtomicKind kind, std::string_view value_string, RAPIDAtomicValue& value)
+{
+  switch (kind)
+  {
+    case RAPIDAtomicKind::BOOL: {
+      RAPIDBool atomic;
+      atomic.parseStringView(value_string);
+      value = atomic.value;
+      break;
+    }
+    case RAPIDAtomicKind::NUM: {
+      RAPIDNum atomic;
+      atomic.parseStringView(value_string);
+      value = atomic.value;
+      break;
+    }
+    case RAPIDAtomicKind::DNUM: {
+      RAPIDDnum atomic;
+      atomic.parseStringView(value_string);
+      value = atomic.value;
+      break;
+    }
+    case RAPIDAtomicKind::STRING: {
+      RAPIDString atomic;
+      atomic.parseStringView(value_string);
+      value = std::move(atomic.value);
+      break;
+    }
+    case RAPIDAtomicKind::TEXT:
+      // Reuse the stored string's capacity.
+      std::get<std::string>(value).assign(value_string.data(), value_string.size());
+      break;
+  }
+}
+
+/**
+ * \brief Appends the value string of an atomic value.
+ */
+void constructAtomic(RAPIDAtomicKind kind, RAPIDAtomicValue const& value, std::string& result)
+{
+  switch (kind)
+  {
+    case RAPIDAtomicKind::BOOL:
+      result += std::get<bool>(value) ? SystemConstants::RAPID::RAPID_TRUE : SystemConstants::RAPID::RAPID_FALSE;
+      break;
+    case RAPIDAtomicKind::NUM: {
+      char buffer[RAPIDNum::MAX_STRING_SIZE];
+      result.append(buffer, RAPIDNum{ std::get<float>(value) }.constructString(buffer, buffer + sizeof(buffer)));
+      break;
+    }
+    case RAPIDAtomicKind::DNUM: {
+      char buffer[RAPIDDnum::MAX_STRING_SIZE];
+      result.append(buffer, RAPIDDnum{ std::get<double>(value) }.constructString(buffer, buffer + sizeof(buffer)));
+      break;
+    }
+    case RAPIDAtomicKind::STRING:
+      result += RAPIDString{ std::get<std::string>(value) }.constructString();
+      break;
+    case RAPIDAtomicKind::TEXT:
+      result += std::get<std::string>(value);
+      break;
+  }
+}
+}  // namespace
+
+/***********************************************************************************************************************
+ * Class definitions: RAPIDSchema
+ */
+
+RAPIDSchema RAPIDSchema::atomic(std::string data_type, RAPIDAtomicKind kind)
+{
+  RAPIDSchema schema;
+
+  RAPIDSchemaNode node;
+  node.atomic = kind;
+  node.data_type = std::move(data_type);
+  schema.nodes_.push_back(std::move(node));
+
+  return schema;
+}
+
+RAPIDSchema RAPIDSchema::atomic(std::string const& data_type)
+{
+  if (data_type == RAPIDBool().getType())
+    return atomic(data_type, RAPIDAtomicKind::BOOL);
+
+  if (data_type == RAPIDNum().getType())
+    return atomic(data_type, RAPIDAtomicKind::NUM);
+
+  if (data_type == RAPIDDnum().getType())
+    return atomic(data_type, RAPIDAtomicKind::DNUM);
+
+  if (data_type == RAPIDString().getType())
+    return atomic(data_type, RAPIDAtomicKind::STRING);
+
+  return atomic(data_type, RAPIDAtomicKind::TEXT);
+}
+
+RAPIDSchema RAPIDSchema::record(std::string data_type,
+                                std::vector<std::pair<std::string, RAPIDSchema>> const& components)
+{
+  RAPIDSchema schema;
+
+  RAPIDSchemaNode root;
+  root.kind = RAPIDNodeKind::RECORD;
+  root.data_type = std::move(data_type);
+  root.size = components.size();
+  root.slot_count = 0;
+  schema.nodes_.push_back(std::move(root));
+
+  for (auto const& [name, component] : components)
+    schema.append(component, name);
+
+  return schema;
+}
+
+RAPIDSchema RAPIDSchema::array(RAPIDSchema const& element, std::vector<std::size_t> const& dimensions)
+{
+  if (dimensions.empty())
+    return element;
+
+  // Multi-dimensional arrays are arrays of arrays, outermost first.
+  RAPIDSchema const inner = array(element, { dimensions.begin() + 1, dimensions.end() });
+  RAPIDSchema schema;
+
+  RAPIDSchemaNode root;
+  root.kind = RAPIDNodeKind::ARRAY;
+  root.data_type = element.getType();
+  root.size = dimensions.front();
+  root.slot_count = 0;
+  schema.nodes_.reserve(1 + root.size * inner.nodes_.size());
+  schema.nodes_.push_back(std::move(root));
+
+  for (std::size_t i = 0; i < dimensions.front(); ++i)
+    schema.append(inner, "");
+
+  return schema;
+}
+
+std::size_t RAPIDSchema::component(std::size_t node, std::string_view name) const
+{
+  RAPIDSchemaNode const& record = nodes_.at(node);
+
+  if (record.kind != RAPIDNodeKind::RECORD)
+    BOOST_THROW_EXCEPTION(std::invalid_argument{ "RAPID node of type '" + record.data_type + "' is not a record" });
+
+  std::size_t child = node + 1;
+  for (std::size_t i = 0; i < record.size; ++i)
+  {
+    if (nodes_[child].name == name)
+      return child;
+
+    child += nodes_[child].extent;
+  }
+
+  BOOST_THROW_EXCEPTION(std::invalid_argument{ "RAPID record '" + record.data_type + "' has no component '" +
+                                               std::string{ name } + "'" });
+}
+
+std::size_t RAPIDSchema::element(std::size_t node, std::size_t index) const
+{
+  RAPIDSchemaNode const& array = nodes_.at(node);
+
+  if (array.kind != RAPIDNodeKind::ARRAY)
+    BOOST_THROW_EXCEPTION(std::invalid_argument{ "RAPID node of type '" + array.data_type + "' is not an array" });
+
+  if (index >= array.size)
+    BOOST_THROW_EXCEPTION(std::out_of_range{ "RAPID array index exceeds the size of the RAPID array" });
+
+  // The elements have the same layout, so they all have the extent of the first one.
+  return node + 1 + index * nodes_[node + 1].extent;
+}
+
+std::size_t RAPIDSchema::find(std::string_view path) const
+{
+  std::size_t node = 0;
+
+  while (!path.empty())
+  {
+    if (path.front() == '.')
+    {
+      path.remove_prefix(1);
+    }
+    else if (path.front() == '{')
+    {
+      std::size_t const close = path.find('}');
+      std::size_t index = 0;
+
+      if (close == std::string_view::npos)
+        BOOST_THROW_EXCEPTION(std::invalid_argument{ "Unterminated RAPID array index in path" });
+
+      auto const [end, error] = std::from_chars(path.data() + 1, path.data() + close, index);
+      if (error != std::errc{} || end != path.data() + close || index == 0)
+        BOOST_THROW_EXCEPTION(std::invalid_argument{ "Invalid RAPID array index in path" });
+
+      node = element(node, index - 1);
+      path.remove_prefix(close + 1);
+    }
+    else
+    {
+      std::size_t const end = std::min(path.find_first_of(".{"), path.size());
+
+      node = component(node, path.substr(0, end));
+      path.remove_prefix(end);
+    }
+  }
+
+  return node;
+}
+
+void RAPIDSchema::append(RAPIDSchema const& subtree, std::string name)
+{
+  RAPIDSchemaNode& root = nodes_.front();
+  std::size_t const first = nodes_.size();
+  std::size_t const slot = root.slot_count;
+
+  root.extent += subtree.nodes_.size();
+  root.slot_count += subtree.slotCount();
+
+  nodes_.insert(nodes_.end(), subtree.nodes_.begin(), subtree.nodes_.end());
+  for (std::size_t i = first; i < nodes_.size(); ++i)
+    nodes_[i].slot += slot;
+
+  nodes_[first].name = std::move(name);
+}
+
+/***********************************************************************************************************************
+ * Class definitions: RAPIDValue
+ */
+
+RAPIDValue::RAPIDValue(std::shared_ptr<RAPIDSchema const> schema) : schema_{ std::move(schema) }
+{
+  if (!schema_)
+    BOOST_THROW_EXCEPTION(std::invalid_argument{ "RAPIDValue requires a schema" });
+
+  values_.resize(schema_->slotCount());
+
+  for (RAPIDSchemaNode const& node : schema_->nodes())
+  {
+    if (node.kind != RAPIDNodeKind::ATOMIC)
+      continue;
+
+    switch (node.atomic)
+    {
+      case RAPIDAtomicKind::BOOL:
+        values_[node.slot] = false;
+        break;
+      case RAPIDAtomicKind::NUM:
+        values_[node.slot] = 0.f;
+        break;
+      case RAPIDAtomicKind::DNUM:
+        values_[node.slot] = 0.;
+        break;
+      case RAPIDAtomicKind::STRING:
+      case RAPIDAtomicKind::TEXT:
+        values_[node.slot] = std::string{};
+        break;
+    }
+  }
+}
+
+RAPIDAtomicValue& RAPIDValue::at(std::size_t node)
+{
+  return const_cast<RAPIDAtomicValue&>(static_cast<RAPIDValue const&>(*this).at(node));
+}
+
+RAPIDAtomicValue const& RAPIDValue::at(std::size_t node) const
+{
+  RAPIDSchemaNode const& atomic = schema_->node(node);
+
+  if (atomic.kind != RAPIDNodeKind::ATOMIC)
+    BOOST_THROW_EXCEPTION(std::invalid_argument{ "RAPID node of type '" + atomic.data_type + "' is not atomic" });
+
+  return values_[atomic.slot];
+}
+
+std::string RAPIDValue::constructString() const
+{
+  return constructString(0);
+}
+
+std::string RAPIDValue::constructString(std::size_t node) const
+{
+  std::string result;
+  constructNode(node, result);
+
+  return result;
+}
+
+void RAPIDValue::parseString(const std::string& value_string)
+{
+  parseStringView(value_string);
+}
+
+void RAPIDValue::parseStringView(std::string_view value_string)
+{
+  parseNode(0, value_string);
+}
+
+std::string RAPIDValue::getType() const
+{
+  return schema_->getType();
+}
+
+std::size_t RAPIDValue::parseNode(std::size_t node, std::string_view value_string)
+{
+  RAPIDSchemaNode const& current = schema_->nodes()[node];
+
+  if (current.kind == RAPIDNodeKind::ATOMIC)
+  {
+    parseAtomic(current.atomic, value_string, values_[current.slot]);
+    return node + 1;
+  }
+
+  std::vector<std::string_view> const substrings = splitDelimitedSubstrings(value_string, '[', ']', ',');
+
+  if (substrings.size() != current.size)
+    BOOST_THROW_EXCEPTION(std::invalid_argument{ "Cannot parse: The passed value_string=\"" +
+                                                 std::string{ value_string } + "\" does not match the layout of '" +
+                                                 current.data_type + "'" });
+
+  std::size_t child = node + 1;
+  for (std::string_view const substring : substrings)
+    child = parseNode(child, substring);
+
+  return child;
+}
+
+std::size_t RAPIDValue::constructNode(std::size_t node, std::string& result) const
+{
+  RAPIDSchemaNode const& current = schema_->nodes()[node];
+
+  if (current.kind == RAPIDNodeKind::ATOMIC)
+  {
+    constructAtomic(current.atomic, values_[current.slot], result);
+    return node + 1;
+  }
+
+  result += '[';
+
+  std::size_t child = node + 1;
+  for (std::size_t i = 0; i < current.size; ++i)
+  {
+    if (i != 0)
+      result += ',';
+
+    child = constructNode(child, result);
+  }
+
+  result += ']';
+
+  return child;
+}
+}  // namespace abb::rws
@@ -0,0 +1,339 @@
+#include <abb_librws/rws_request_metrics.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+namespace abb ::rws
+{
+namespace
+{
+/**
+ * \brief Marks a URI pattern whose parameter spans all remaining segments (except a trailing action).
+ */
+std::size_t constexpr VARIABLE_PARAMETERS = std::numeric_limits<std::size_t>::max();
+
+/**
+ * \brief URI pattern of an RWS resource that is addressed by parameters, e.g. a signal name or a RAPID symbol path.
+ */
+struct URIPattern
+{
+  /**
+   * \brief Path segments identifying the resource.
+   */
+  std::vector<std::string> prefix;
+
+  /**
+   * \brief Number of parameter segments following the prefix, or VARIABLE_PARAMETERS. The segments after them (e.g.
+   * actions) are kept.
+   */
+  std::size_t parameters;
+
+  /**
+   * \brief Trailing segment that is not part of a variable parameter (if not empty).
+   */
+  std::string action;
+};
+
+/**
+ * \brief Patterns of the parameterized RWS resources (RWS 1.0 and 2.0). Other URIs are templated verbatim.
+ */
+std::vector<URIPattern> const URI_PATTERNS{
+  { { "fileservice" }, VARIABLE_PARAMETERS, "" },
+  { { "poll" }, 1, "" },
+  { { "rw", "cfg" }, 2, "" },
+  { { "rw", "iosystem", "signals" }, VARIABLE_PARAMETERS, "set-value" },
+  { { "rw", "mastership" }, 1, "" },
+  { { "rw", "motionsystem", "mechunits" }, 1, "" },
+  { { "rw", "rapid", "modules" }, 1, "" },
+  { { "rw", "rapid", "symbol", "RAPID" }, 3, "" },
+  { { "rw", "rapid", "symbol", "data", "RAPID" }, 3, "" },
+  { { "rw", "rapid", "symbol", "properties", "RAPID" }, 3, "" },
+  { { "rw", "rapid", "tasks" }, 1, "" },
+  { { "subscription" }, 1, "" },
+};
+
+std::string escapeLabelValue(std::string const& value)
+{
+  std::string escaped;
+  escaped.reserve(value.size());
+
+  for (char c : value)
+  {
+    switch (c)
+    {
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      default:
+        escaped += c;
+    }
+  }
+
+  return escaped;
+}
+
+double toSeconds(std::chrono::nanoseconds duration)
+{
+  return std::chrono::duration<double>(duration).count();
+}
+}  // namespace
+
+char const* requestPhaseName(RequestPhase phase) noexcept
+{
+  switch (phase)
+  {
+    case RequestPhase::SEND_HEADER:
+      return "send_header";
+    case RequestPhase::SEND_CONTENT:
+      return "send_content";
+    case RequestPhase::WAIT:
+      return "wait";
+    case RequestPhase::RECEIVE:
+      return "receive";
+    case RequestPhase::PARSE:
+      return "parse";
+    case RequestPhase::TOTAL:
+      return "total";
+  }
+
+  return "unknown";
+}
+
+/***********************************************************************************************************************
+ * Struct definitions: LatencyHistogram
+ */
+
+void LatencyHistogram::record(std::chrono::nanoseconds latency) noexcept
+{
+  auto const us = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+  auto const bucket = std::lower_bound(BUCKET_BOUNDS.begin(), BUCKET_BOUNDS.end(), us) - BUCKET_BOUNDS.begin();
+
+  ++bucket_counts[static_cast<std::size_t>(bucket)];
+  ++count;
+  sum += latency;
+}
+
+/***********************************************************************************************************************
+ * Class definitions: RequestMetrics
+ */
+
+RequestMetrics::RequestMetrics(bool enabled) : enabled_{ enabled }
+{
+}
+
+void RequestMetrics::recordExchange(std::string const& method, std::string const& uri, Timestamps const& timestamps)
+{
+  if (!enabled())
+    return;
+
+  Endpoint key{ method, uriTemplate(uri) };
+
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  EndpointStatistics& statistics = endpoints_[std::move(key)];
+
+  if (timestamps.reconnected)
+    reconnects_.fetch_add(1, std::memory_order_relaxed);
+
+  statistics[static_cast<std::size_t>(RequestPhase::SEND_HEADER)].record(timestamps.header_sent - timestamps.start);
+  statistics[static_cast<std::size_t>(RequestPhase::SEND_CONTENT)].record(timestamps.sent - timestamps.header_sent);
+  statistics[static_cast<std::size_t>(RequestPhase::WAIT)].record(timestamps.headers_received - timestamps.sent);
+  statistics[static_cast<std::size_t>(RequestPhase::RECEIVE)].record(timestamps.received -
+                                                                      timestamps.headers_received);
+  statistics[static_cast<std::size_t>(RequestPhase::TOTAL)].record(timestamps.received - timestamps.start);
+}
+
+void RequestMetrics::recordParse(std::string const& method, std::string const& uri, std::chrono::nanoseconds duration)
+{
+  if (!enabled())
+    return;
+
+  Endpoint key{ method, uriTemplate(uri) };
+
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  endpoints_[std::move(key)][static_cast<std::size_t>(RequestPhase::PARSE)].record(duration);
+}
+
+void RequestMetrics::countRetry() noexcept
+{
+  if (enabled())
+    retries_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RequestMetrics::countReauthentication() noexcept
+{
+  if (enabled())
+    reauthentications_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RequestMetrics::countServerErrorReset() noexcept
+{
+  if (enabled())
+    server_error_resets_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RequestMetrics::countCommunicationError() noexcept
+{
+  if (enabled())
+    communication_errors_.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::map<RequestMetrics::Endpoint, RequestMetrics::EndpointStatistics> RequestMetrics::getEndpointStatistics() const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  return endpoints_;
+}
+
+RequestMetrics::Counters RequestMetrics::getCounters() const noexcept
+{
+  Counters counters;
+  counters.retries = retries_.load(std::memory_order_relaxed);
+  counters.reauthentications = reauthentications_.load(std::memory_order_relaxed);
+  counters.server_error_resets = server_error_resets_.load(std::memory_order_relaxed);
+  counters.communication_errors = communication_errors_.load(std::memory_order_relaxed);
+  counters.reconnects = reconnects_.load(std::memory_order_relaxed);
+
+  return counters;
+}
+
+void RequestMetrics::reset()
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  endpoints_.clear();
+  retries_ = 0;
+  reauthentications_ = 0;
+  server_error_resets_ = 0;
+  communication_errors_ = 0;
+  reconnects_ = 0;
+}
+
+std::string RequestMetrics::toPrometheusText(std::string const& prefix) const
+{
+  auto const endpoints = getEndpointStatistics();
+  auto const counters = getCounters();
+  std::string const histogram_name = prefix + "_request_duration_seconds";
+
+  std::ostringstream ss;
+  ss << std::setprecision(9);
+
+  ss << "# HELP " << histogram_name << " Latency of RWS requests per endpoint and phase.\n";
+  ss << "# TYPE " << histogram_name << " histogram\n";
+
+  for (auto const& [endpoint, statistics] : endpoints)
+  {
+    for (std::size_t phase = 0; phase < REQUEST_PHASE_COUNT; ++phase)
+    {
+      LatencyHistogram const& histogram = statistics[phase];
+
+      if (histogram.count == 0)
+        continue;
+
+      std::string const labels = "method=\"" + escapeLabelValue(endpoint.method) + "\",endpoint=\"" +
+                                 escapeLabelValue(endpoint.uri_template) + "\",phase=\"" +
+                                 requestPhaseName(static_cast<RequestPhase>(phase)) + "\"";
+
+      std::uint64_t cumulative = 0;
+      for (std::size_t i = 0; i < LatencyHistogram::BUCKET_BOUNDS.size(); ++i)
+      {
+        cumulative += histogram.bucket_counts[i];
+        ss << histogram_name << "_bucket{" << labels << ",le=\"" << LatencyHistogram::BUCKET_BOUNDS[i] * 1e-6
+           << "\"} " << cumulative << "\n";
+      }
+
+      ss << histogram_name << "_bucket{" << labels << ",le=\"+Inf\"} " << histogram.count << "\n";
+      ss << histogram_name << "_sum{" << labels << "} " << toSeconds(histogram.sum) << "\n";
+      ss << histogram_name << "_count{" << labels << "} " << histogram.count << "\n";
+    }
+  }
+
+  auto const counter = [&](char const* name, char const* help, std::uint64_t value) {
+    ss << "# HELP " << prefix << "_" << name << " " << help << "\n";
+    ss << "# TYPE " << prefix << "_" << name << " counter\n";
+    ss << prefix << "_" << name << " " << value << "\n";
+  };
+
+  counter("request_retries_total", "Requests sent again after a server error or an authentication challenge.",
+          counters.retries);
+  counter("request_reauthentications_total", "401 responses answered by re-authenticating.",
+          counters.reauthentications);
+  counter("request_server_error_resets_total", "5xx responses that caused a session reset.",
+          counters.server_error_resets);
+  counter("request_communication_errors_total", "Requests failed due to communication errors.",
+          counters.communication_errors);
+  counter("request_reconnects_total", "Requests for which the HTTP session had to (re)connect.",
+          counters.reconnects);
+
+  return ss.str();
+}
+
+std::string RequestMetrics::uriTemplate(std::string const& uri)
+{
+  // Split the path into segments, ignoring the query and matrix parameters.
+  std::vector<std::string> segments;
+  std::size_t const end = std::min(uri.find('?'), uri.size());
+
+  for (std::size_t position = 0; position < end;)
+  {
+    std::size_t const segment_end = std::min(uri.find('/', position), end);
+    std::size_t const name_end = std::min(uri.find(';', position), segment_end);
+
+    if (name_end > position)
+      segments.push_back(uri.substr(position, name_end - position));
+
+    position = segment_end + 1;
+  }
+
+  // Find the longest pattern whose prefix the path starts with.
+  URIPattern const* pattern = nullptr;
+
+  for (URIPattern const& candidate : URI_PATTERNS)
+  {
+    if (candidate.prefix.size() <= segments.size() &&
+        std::equal(candidate.prefix.begin(), candidate.prefix.end(), segments.begin()) &&
+        (!pattern || candidate.prefix.size() > pattern->prefix.size()))
+      pattern = &candidate;
+  }
+
+  std::string result;
+  result.reserve(uri.size());
+
+  std::size_t parameters_begin = segments.size();
+  std::size_t parameters_end = segments.size();
+
+  if (pattern)
+  {
+    parameters_begin = pattern->prefix.size();
+
+    if (pattern->parameters != VARIABLE_PARAMETERS)
+      parameters_end = std::min(parameters_begin + pattern->parameters, segments.size());
+    else if (!pattern->action.empty() && segments.size() > parameters_begin + 1 && segments.back() == pattern->action)
+      parameters_end = segments.size() - 1;
+  }
+
+  for (std::size_t i = 0; i < segments.size(); ++i)
+  {
+    // A variable parameter (e.g. a file path) is replaced as a whole.
+    if (i >= parameters_begin && i < parameters_end)
+    {
+      if (pattern->parameters != VARIABLE_PARAMETERS || i == parameters_begin)
+        result += "/{}";
+    }
+    else
+    {
+      result += '/';
+      result += segments[i];
+    }
+  }
+
+  return result.empty() ? "/" : result;
+}
+}  // namespace abb::rws
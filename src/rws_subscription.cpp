@@ -3,9 +3,11 @@
 #include <abb_librws/parsing.h>
 
 #include <Poco/Net/HTTPRequest.h>
+#include <Poco/Version.h>
 
 #include <boost/exception/diagnostic_information.hpp>
 
+#include <algorithm>
 #include <iostream>
 
 namespace abb ::rws
@@ -66,9 +68,15 @@ const std::chrono::microseconds SubscriptionReceiver::DEFAULT_SUBSCRIPTION_TIMEO
 
 SubscriptionReceiver::SubscriptionReceiver(SubscriptionManager& subscription_manager,
                                            std::string const& subscription_group_id)
-  : subscription_manager_{ subscription_manager }
+  : message_buffer_{ INITIAL_BUFFER_SIZE }
+  , subscription_manager_{ subscription_manager }
   , webSocket_{ subscription_manager_.receiveSubscription(subscription_group_id) }
 {
+#if POCO_VERSION >= 0x010A0000
+  // Reject a frame larger than a message may be before its payload is allocated. The frame cannot be skipped, so
+  // receiving it fails with a Poco::Net::WebSocketException.
+  webSocket_.setMaxPayloadSize(static_cast<int>(MAX_MESSAGE_SIZE));
+#endif
 }
 
 SubscriptionReceiver::~SubscriptionReceiver()
@@ -77,40 +85,32 @@ SubscriptionReceiver::~SubscriptionReceiver()
 
 bool SubscriptionReceiver::waitForEvent(SubscriptionCallback& callback, std::chrono::microseconds timeout)
 {
-  WebSocketFrame frame;
-  if (webSocketReceiveFrame(frame, timeout))
+  if (webSocketReceiveMessage(timeout))
   {
-    Poco::AutoPtr<Poco::XML::Document> doc = parser_.parseString(frame.frame_content);
-    subscription_manager_.processEvent(doc, callback);
+    processMessage(callback);
     return true;
   }
 
   return false;
 }
 
-bool SubscriptionReceiver::webSocketReceiveFrame(WebSocketFrame& frame, std::chrono::microseconds timeout)
+bool SubscriptionReceiver::webSocketReceiveMessage(std::chrono::microseconds timeout)
 {
-  auto now = std::chrono::steady_clock::now();
-  auto deadline = std::chrono::steady_clock::now() + timeout;
-
-  // If the connection is still active...
-  int flags = 0;
-  std::string content;
-  int number_of_bytes_received = 0;
+  auto const deadline = std::chrono::steady_clock::now() + timeout;
 
-  // Wait for (non-ping) WebSocket frames.
-  do
+  // Wait for (non-control) WebSocket frames until the final fragment of a message.
+  while (true)
   {
-    now = std::chrono::steady_clock::now();
+    auto const now = std::chrono::steady_clock::now();
     if (now >= deadline)
       BOOST_THROW_EXCEPTION(TimeoutError{ "WebSocket frame receive timeout" });
 
     webSocket_.setReceiveTimeout(std::chrono::duration_cast<std::chrono::microseconds>(deadline - now).count());
-    flags = 0;
+    FrameResult result = FrameResult::PARTIAL;
 
     try
     {
-      number_of_bytes_received = webSocket_.receiveFrame(websocket_buffer_, sizeof(websocket_buffer_), flags);
+      result = webSocketReceiveFrame();
     }
     catch (Poco::TimeoutException const&)
     {
@@ -118,40 +118,171 @@ bool SubscriptionReceiver::webSocketReceiveFrame(WebSocketFrame& frame, std::chr
                             << boost::errinfo_nested_exception(boost::current_exception()));
     }
 
-    content = std::string(websocket_buffer_, number_of_bytes_received);
+    if (result != FrameResult::PARTIAL)
+      return result == FrameResult::MESSAGE;
+  }
+}
 
-    // Check for ping frame.
-    if ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_PING)
-    {
-      // Reply with a pong frame.
-      webSocket_.sendFrame(websocket_buffer_, number_of_bytes_received,
-                           WebSocket::FRAME_FLAG_FIN | WebSocket::FRAME_OP_PONG);
-    }
-  } while ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_PING);
+SubscriptionReceiver::FrameResult SubscriptionReceiver::webSocketReceiveFrame()
+{
+  // Keep the capacity of the previous messages.
+  if (!in_message_)
+    message_buffer_.resize(0);
+
+  // Grow geometrically while reassembling, so that the fragments received so far are not copied for every fragment.
+  std::size_t const offset = message_buffer_.size();
+  std::size_t const capacity = std::min(2 * offset, MAX_MESSAGE_SIZE);
+  if (message_buffer_.capacity() < capacity)
+    message_buffer_.setCapacity(capacity);
+
+  // Appends the frame's payload to the buffer.
+  int flags = 0;
+  int const number_of_bytes_received = webSocket_.receiveFrame(message_buffer_, flags);
+  int const opcode = flags & WebSocket::FRAME_OP_BITMASK;
+
+  if (opcode == WebSocket::FRAME_OP_PING)
+  {
+    // Reply with a pong frame, and remove the ping's payload from the message.
+    webSocket_.sendFrame(message_buffer_.begin() + offset, static_cast<int>(message_buffer_.size() - offset),
+                         WebSocket::FRAME_FLAG_FIN | WebSocket::FRAME_OP_PONG);
+    message_buffer_.resize(offset);
+    return FrameResult::PARTIAL;
+  }
+
+  if (opcode == WebSocket::FRAME_OP_PONG)
+  {
+    message_buffer_.resize(offset);
+    return FrameResult::PARTIAL;
+  }
 
   // Check for closing frame.
-  if ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_CLOSE)
+  if (opcode == WebSocket::FRAME_OP_CLOSE || (number_of_bytes_received == 0 && flags == 0))
   {
     // Do not pass content of a closing frame to end user,
     // according to "The WebSocket Protocol" RFC6455.
-    frame.frame_content.clear();
-    frame.flags = flags;
+    message_buffer_.resize(0);
+    in_message_ = false;
+    message_too_large_ = false;
+    return FrameResult::CLOSED;
+  }
 
-    return false;
+  if ((opcode == WebSocket::FRAME_OP_CONT) != in_message_)
+  {
+    message_buffer_.resize(0);
+    in_message_ = false;
+    message_too_large_ = false;
+    BOOST_THROW_EXCEPTION(ProtocolError{ "Unexpected WebSocket frame: " + mapWebSocketOpcode(flags) });
+  }
+
+  in_message_ = true;
+
+  // Discard the rest of a message that is too large, but keep reading it to stay in sync with the frames. Without
+  // a maximum payload size of the WebSocket, a single large frame has already been allocated, so release it.
+  if (message_too_large_ || message_buffer_.size() > MAX_MESSAGE_SIZE)
+  {
+    message_too_large_ = true;
+    message_buffer_.resize(0);
+    message_buffer_.setCapacity(INITIAL_BUFFER_SIZE, false);
+  }
+
+  if (!(flags & WebSocket::FRAME_FLAG_FIN))
+    return FrameResult::PARTIAL;
+
+  in_message_ = false;
+
+  if (message_too_large_)
+  {
+    message_too_large_ = false;
+    BOOST_THROW_EXCEPTION(ProtocolError{ "WebSocket message exceeds the maximum size of " +
+                                         std::to_string(MAX_MESSAGE_SIZE) + " bytes" });
   }
 
-  frame.flags = flags;
-  frame.frame_content = content;
+  return FrameResult::MESSAGE;
+}
 
-  return number_of_bytes_received != 0;
+void SubscriptionReceiver::processMessage(SubscriptionCallback& callback)
+{
+  Poco::AutoPtr<Poco::XML::Document> doc = parser_.parseMemory(message_buffer_.begin(), message_buffer_.size());
+  subscription_manager_.processEvent(doc, callback);
 }
 
 void SubscriptionReceiver::shutdown()
 {
-  // Shut down the socket. This should make webSocketReceiveFrame() return as soon as possible.
+  // Shut down the socket. This should make webSocketReceiveMessage() return as soon as possible.
   webSocket_.shutdown();
 }
 
+RAPIDSymbolValueEvent parseRAPIDSymbolValueEventURI(std::string const& uri)
+{
+  std::string const prefix = "/RAPID/";
+  std::string const path = uri.substr(0, uri.find(';'));
+  std::size_t const task = path.find(prefix);
+  std::size_t const module = task != std::string::npos ? path.find('/', task + prefix.length()) : task;
+  std::size_t const name = module != std::string::npos ? path.find('/', module + 1) : module;
+
+  if (name == std::string::npos)
+    BOOST_THROW_EXCEPTION(ProtocolError{ "Cannot parse RWS event message: invalid resource URI" }
+                          << UriErrorInfo{ uri });
+
+  RAPIDSymbolValueEvent event;
+  event.task = path.substr(task + prefix.length(), module - task - prefix.length());
+  event.module = path.substr(module + 1, name - module - 1);
+  event.name = path.substr(name + 1, path.find('/', name + 1) - name - 1);
+
+  return event;
+}
+
+void processEventMessage(Poco::AutoPtr<Poco::XML::Document> const& content,
+                         std::function<SubscriptionEvent(Poco::XML::Node const*)> const& parse_event,
+                         SubscriptionCallback& callback)
+{
+  // IMPORTANT: don't use AutoPtr<XML::Node> here! Otherwise you will get memory corruption.
+  Poco::XML::Node const* ul_node = content->getNodeByPath("html/body/div/ul");
+  if (!ul_node)
+    BOOST_THROW_EXCEPTION(ProtocolError{ "Cannot parse RWS event message: can't find XML path html/body/div/ul" });
+
+  std::vector<SubscriptionEvent> events;
+  std::size_t item_count = 0;
+  std::size_t skipped_count = 0;
+  boost::exception_ptr first_error;
+
+  for (Poco::XML::Node const* node = ul_node->firstChild(); node; node = node->nextSibling())
+  {
+    if (node->nodeType() != Poco::XML::Node::ELEMENT_NODE || node->nodeName() != "li")
+      continue;
+
+    ++item_count;
+
+    try
+    {
+      events.push_back(parse_event(node));
+    }
+    catch (std::exception const&)
+    {
+      // Skip the item, but still dispatch the other events of the message.
+      if (skipped_count++ == 0)
+        first_error = boost::current_exception();
+    }
+  }
+
+  if (item_count == 0)
+    BOOST_THROW_EXCEPTION(ProtocolError{ "Cannot parse RWS event message: can't find XML path html/body/div/ul/li" });
+
+  if (!events.empty())
+    callback.processEvents(events);
+
+  if (skipped_count > 0)
+    BOOST_THROW_EXCEPTION(ProtocolError{ "Cannot parse RWS event message: skipped " + std::to_string(skipped_count) +
+                                         " of " + std::to_string(item_count) + " items" }
+                          << boost::errinfo_nested_exception{ first_error });
+}
+
+void SubscriptionCallback::processEvents(std::vector<SubscriptionEvent> const& events)
+{
+  for (SubscriptionEvent const& event : events)
+    std::visit([this](auto const& e) { this->processEvent(e); }, event);
+}
+
 void SubscriptionCallback::processEvent(IOSignalStateEvent const& event)
 {
 }
@@ -167,4 +298,39 @@ void SubscriptionCallback::processEvent(ControllerStateEvent const& event)
 void SubscriptionCallback::processEvent(OperationModeEvent const& event)
 {
 }
+
+void SubscriptionCallback::processEvent(RAPIDSymbolValueEvent const& event)
+{
+}
+
+void RAPIDSymbolDecodingCallback::registerSymbol(RAPIDResource const& resource, RAPIDSymbolDataAbstract& data)
+{
+  symbols_.insert_or_assign(makeKey(resource.task, resource.module, resource.name), &data);
+}
+
+void RAPIDSymbolDecodingCallback::unregisterSymbol(RAPIDResource const& resource)
+{
+  symbols_.erase(makeKey(resource.task, resource.module, resource.name));
+}
+
+void RAPIDSymbolDecodingCallback::processEvent(RAPIDSymbolValueEvent const& event)
+{
+  auto const it = symbols_.find(makeKey(event.task, event.module, event.name));
+  if (it == symbols_.end() || event.value.empty())
+    return;
+
+  it->second->parseStringView(event.value);
+  processDecodedEvent(event, *it->second);
+}
+
+void RAPIDSymbolDecodingCallback::processDecodedEvent(RAPIDSymbolValueEvent const& event,
+                                                      RAPIDSymbolDataAbstract& data)
+{
+}
+
+std::string RAPIDSymbolDecodingCallback::makeKey(std::string const& task, std::string const& module,
+                                                 std::string const& name)
+{
+  return task + "/" + module + "/" + name;
+}
 }  // namespace abb::rws
\ No newline at end of file
@@ -0,0 +1,163 @@
+#include <abb_librws/rws_subscription_queue.h>
+
+#include <algorithm>
+#include <utility>
+#include <variant>
+
+namespace abb ::rws
+{
+/***********************************************************************************************************************
+ * Class definitions: SubscriptionEventQueue::Source
+ */
+
+SubscriptionEventQueue::Source::Source(SubscriptionEventQueue& queue, std::string id)
+  : queue_{ queue }, id_{ std::move(id) }
+{
+}
+
+void SubscriptionEventQueue::Source::processEvents(std::vector<SubscriptionEvent> const& events)
+{
+  for (SubscriptionEvent const& event : events)
+    queue_.push(event, id_);
+}
+
+/***********************************************************************************************************************
+ * Class definitions: SubscriptionEventQueue
+ */
+
+SubscriptionEventQueue::SubscriptionEventQueue(std::size_t capacity, SubscriptionOverflowPolicy policy)
+  : policy_{ policy }, slots_(std::max<std::size_t>(capacity, 1))
+{
+}
+
+void SubscriptionEventQueue::processEvents(std::vector<SubscriptionEvent> const& events)
+{
+  for (SubscriptionEvent const& event : events)
+    push(event);
+}
+
+bool SubscriptionEventQueue::push(SubscriptionEvent event, std::string const& source)
+{
+  std::string key = policy_ == SubscriptionOverflowPolicy::CONFLATE ? makeKey(source, event) : std::string{};
+
+  std::unique_lock<std::mutex> lock{ mutex_ };
+
+  if (policy_ == SubscriptionOverflowPolicy::CONFLATE && !closed_)
+  {
+    // Replace the queued event of the same resource in place.
+    auto const it = sequence_by_key_.find(key);
+    if (it != sequence_by_key_.end())
+    {
+      slots_[it->second % slots_.size()].event = std::move(event);
+      ++conflations_;
+      return true;
+    }
+  }
+
+  if (policy_ == SubscriptionOverflowPolicy::BLOCK)
+    not_full_.wait(lock, [this] { return closed_ || size_ < slots_.size(); });
+
+  if (closed_)
+  {
+    ++drops_;
+    return false;
+  }
+
+  if (size_ == slots_.size())
+  {
+    popFront();
+    ++drops_;
+  }
+
+  std::size_t const sequence = head_ + size_;
+  Entry& entry = slots_[sequence % slots_.size()];
+
+  if (policy_ == SubscriptionOverflowPolicy::CONFLATE)
+    sequence_by_key_[key] = sequence;
+
+  entry.event = std::move(event);
+  entry.key = std::move(key);
+  ++size_;
+  max_depth_ = std::max(max_depth_, size_);
+
+  lock.unlock();
+  not_empty_.notify_one();
+
+  return true;
+}
+
+std::size_t SubscriptionEventQueue::dispatch(SubscriptionCallback& callback, std::chrono::microseconds timeout)
+{
+  std::vector<SubscriptionEvent> events;
+
+  {
+    std::unique_lock<std::mutex> lock{ mutex_ };
+
+    if (!not_empty_.wait_for(lock, timeout, [this] { return closed_ || size_ > 0; }) || size_ == 0)
+      return 0;
+
+    events.reserve(size_);
+    while (size_ > 0)
+      events.push_back(std::move(popFront().event));
+  }
+
+  not_full_.notify_all();
+
+  // Call the callback without holding the lock, so that the producer can keep queuing events.
+  callback.processEvents(events);
+
+  return events.size();
+}
+
+void SubscriptionEventQueue::close()
+{
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+    closed_ = true;
+  }
+
+  not_empty_.notify_all();
+  not_full_.notify_all();
+}
+
+SubscriptionEventQueueStatistics SubscriptionEventQueue::getStatistics() const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  SubscriptionEventQueueStatistics statistics;
+  statistics.depth = size_;
+  statistics.max_depth = max_depth_;
+  statistics.drops = drops_;
+  statistics.conflations = conflations_;
+
+  return statistics;
+}
+
+std::string SubscriptionEventQueue::makeKey(std::string const& source, SubscriptionEvent const& event)
+{
+  // The length prefix keeps the source apart from the resource, whatever characters the source contains. The
+  // controller, execution and panel states have one resource each.
+  std::string key = std::to_string(source.size()) + ":" + source + std::to_string(event.index()) + ":";
+
+  if (auto const* io_signal = std::get_if<IOSignalStateEvent>(&event))
+    key += io_signal->signal;
+  else if (auto const* symbol = std::get_if<RAPIDSymbolValueEvent>(&event))
+    key += symbol->task + "/" + symbol->module + "/" + symbol->name;
+
+  return key;
+}
+
+SubscriptionEventQueue::Entry SubscriptionEventQueue::popFront()
+{
+  Entry& slot = slots_[head_ % slots_.size()];
+
+  if (policy_ == SubscriptionOverflowPolicy::CONFLATE)
+    sequence_by_key_.erase(slot.key);
+
+  Entry entry = std::move(slot);
+  ++head_;
+  --size_;
+
+  return entry;
+}
+}  // namespace abb::rws
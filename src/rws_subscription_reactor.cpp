@@ -0,0 +1,329 @@
+#include <abb_librws/rws_subscription_reactor.h>
+#include <abb_librws/rws_error.h>
+
+#include <Poco/NObserver.h>
+#include <Poco/Timespan.h>
+
+#include <iostream>
+#include <utility>
+
+namespace abb ::rws
+{
+using namespace Poco::Net;
+
+namespace
+{
+/**
+ * \brief Interval in which the reactor thread checks whether it has been stopped.
+ */
+Poco::Timespan const REACTOR_POLL_INTERVAL{ 0, 100000 };
+}  // namespace
+
+const std::chrono::microseconds SubscriptionReactor::DEFAULT_FRAME_TIMEOUT{ 5000000 };
+
+/***********************************************************************************************************************
+ * Class definitions: SubscriptionReactor
+ */
+
+SubscriptionReactor::SubscriptionReactor(std::size_t worker_count, std::chrono::microseconds frame_timeout)
+  : frame_timeout_{ frame_timeout }
+  , own_executor_{ std::make_unique<ThreadPoolExecutor>(worker_count) }
+  , executor_{ *own_executor_ }
+{
+  reactor_.setTimeout(REACTOR_POLL_INTERVAL);
+  thread_ = std::thread{ [this] { reactor_.run(); } };
+}
+
+SubscriptionReactor::SubscriptionReactor(Executor& executor, std::chrono::microseconds frame_timeout)
+  : frame_timeout_{ frame_timeout }, executor_{ executor }
+{
+  reactor_.setTimeout(REACTOR_POLL_INTERVAL);
+  thread_ = std::thread{ [this] { reactor_.run(); } };
+}
+
+SubscriptionReactor::~SubscriptionReactor()
+{
+  reactor_.stop();
+  thread_.join();
+
+  std::vector<std::shared_ptr<Subscription>> subscriptions;
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+    for (auto const& subscription : subscriptions_)
+      subscriptions.push_back(subscription.second);
+  }
+
+  for (auto const& subscription : subscriptions)
+  {
+    unregister(*subscription);
+    close(*subscription);
+  }
+
+  // The dispatching tasks refer to this object.
+  std::unique_lock<std::mutex> lock{ dispatching_mutex_ };
+  dispatching_done_.wait(lock, [this] { return dispatching_ == 0; });
+}
+
+std::size_t SubscriptionReactor::add(std::unique_ptr<SubscriptionReceiver> receiver, SubscriptionCallback& callback,
+                                     ErrorHandler error_handler)
+{
+  // Once a frame has started to arrive, the rest of it must not block the reactor thread for long.
+  receiver->webSocket_.setReceiveTimeout(frame_timeout_.count());
+
+  std::shared_ptr<Subscription> subscription;
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+
+    subscription = std::make_shared<Subscription>(next_id_++, std::move(receiver), callback, std::move(error_handler));
+    subscriptions_.emplace(subscription->id, subscription);
+    sockets_.emplace(subscription->receiver->webSocket_, subscription);
+  }
+
+  reactor_.addEventHandler(subscription->receiver->webSocket_,
+                           Poco::NObserver<SubscriptionReactor, ReadableNotification>{
+                               *this, &SubscriptionReactor::onReadable });
+  reactor_.addEventHandler(subscription->receiver->webSocket_,
+                           Poco::NObserver<SubscriptionReactor, ErrorNotification>{
+                               *this, &SubscriptionReactor::onError });
+
+  return subscription->id;
+}
+
+void SubscriptionReactor::remove(std::size_t id)
+{
+  std::shared_ptr<Subscription> subscription;
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+
+    auto const it = subscriptions_.find(id);
+    if (it == subscriptions_.end())
+      return;
+
+    subscription = it->second;
+  }
+
+  unregister(*subscription);
+  close(*subscription);
+}
+
+std::size_t SubscriptionReactor::size() const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  return subscriptions_.size();
+}
+
+void SubscriptionReactor::onReadable(Poco::AutoPtr<ReadableNotification> const& notification)
+{
+  if (auto const subscription = find(notification->socket()))
+    receive(subscription);
+}
+
+void SubscriptionReactor::onError(Poco::AutoPtr<ErrorNotification> const& notification)
+{
+  if (auto const subscription = find(notification->socket()))
+    fail(subscription, std::make_exception_ptr(CommunicationError{ "Subscription WebSocket connection failed" }));
+}
+
+void SubscriptionReactor::receive(std::shared_ptr<Subscription> const& subscription)
+{
+  SubscriptionReceiver& receiver = *subscription->receiver;
+  Subscription* const target = subscription.get();
+
+  try
+  {
+    // Frames may already have been read from the socket along with the notified one (e.g. by TLS), so receive all
+    // available frames before waiting again.
+    do
+    {
+      SubscriptionReceiver::FrameResult result = SubscriptionReceiver::FrameResult::PARTIAL;
+
+      try
+      {
+        result = receiver.webSocketReceiveFrame();
+      }
+      catch (RWSError const&)
+      {
+        // A malformed message, which has been skipped.
+        post(subscription, [target, error = std::current_exception()] { handleError(*target, error); });
+        continue;
+      }
+
+      if (result == SubscriptionReceiver::FrameResult::CLOSED)
+      {
+        fail(subscription, std::make_exception_ptr(CommunicationError{ "Subscription WebSocket connection closed" }));
+        return;
+      }
+
+      if (result == SubscriptionReceiver::FrameResult::MESSAGE)
+      {
+        EventCollector collector;
+        std::exception_ptr error;
+
+        try
+        {
+          receiver.processMessage(collector);
+        }
+        catch (...)
+        {
+          error = std::current_exception();
+        }
+
+        // Items that could not be decoded are reported after the other events of the message.
+        if (!collector.events.empty())
+          post(subscription,
+               [target, events = std::move(collector.events)] { target->callback.processEvents(events); });
+
+        if (error)
+          post(subscription, [target, error] { handleError(*target, error); });
+      }
+    } while (receiver.webSocket_.available() > 0);
+  }
+  catch (...)
+  {
+    fail(subscription, std::current_exception());
+  }
+}
+
+void SubscriptionReactor::fail(std::shared_ptr<Subscription> const& subscription, std::exception_ptr error)
+{
+  unregister(*subscription);
+
+  // Dispatch the error after the events received before it.
+  Subscription* const target = subscription.get();
+  post(subscription, [target, error] { handleError(*target, error); });
+}
+
+std::shared_ptr<SubscriptionReactor::Subscription> SubscriptionReactor::find(Socket const& socket) const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  auto const it = sockets_.find(socket);
+  return it != sockets_.end() ? it->second : nullptr;
+}
+
+void SubscriptionReactor::unregister(Subscription& subscription)
+{
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+
+    subscriptions_.erase(subscription.id);
+    sockets_.erase(subscription.receiver->webSocket_);
+  }
+
+  reactor_.removeEventHandler(subscription.receiver->webSocket_,
+                              Poco::NObserver<SubscriptionReactor, ReadableNotification>{
+                                  *this, &SubscriptionReactor::onReadable });
+  reactor_.removeEventHandler(subscription.receiver->webSocket_,
+                              Poco::NObserver<SubscriptionReactor, ErrorNotification>{
+                                  *this, &SubscriptionReactor::onError });
+}
+
+void SubscriptionReactor::close(Subscription& subscription)
+{
+  {
+    std::lock_guard<std::mutex> lock{ subscription.mutex };
+
+    subscription.removed = true;
+    subscription.tasks.clear();
+  }
+
+  try
+  {
+    subscription.receiver->shutdown();
+  }
+  catch (Poco::Exception const&)
+  {
+    // The connection may already be closed.
+  }
+}
+
+void SubscriptionReactor::post(std::shared_ptr<Subscription> const& subscription, std::function<void()> task)
+{
+  {
+    std::lock_guard<std::mutex> lock{ subscription->mutex };
+
+    if (subscription->removed)
+      return;
+
+    subscription->tasks.push_back(std::move(task));
+
+    if (subscription->scheduled)
+      return;
+
+    subscription->scheduled = true;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock{ dispatching_mutex_ };
+    ++dispatching_;
+  }
+
+  executor_.execute([this, subscription] {
+    dispatch(*subscription);
+
+    std::lock_guard<std::mutex> lock{ dispatching_mutex_ };
+    --dispatching_;
+    dispatching_done_.notify_all();
+  });
+}
+
+void SubscriptionReactor::dispatch(Subscription& subscription)
+{
+  // Run the queued callbacks one at a time, so that the events of the subscription are dispatched in order.
+  for (;;)
+  {
+    std::function<void()> task;
+
+    {
+      std::lock_guard<std::mutex> lock{ subscription.mutex };
+
+      if (subscription.removed || subscription.tasks.empty())
+      {
+        subscription.scheduled = false;
+        return;
+      }
+
+      task = std::move(subscription.tasks.front());
+      subscription.tasks.pop_front();
+    }
+
+    try
+    {
+      task();
+    }
+    catch (...)
+    {
+      handleError(subscription, std::current_exception());
+    }
+  }
+}
+
+void SubscriptionReactor::handleError(Subscription const& subscription, std::exception_ptr error) noexcept
+{
+  try
+  {
+    if (subscription.error_handler)
+      subscription.error_handler(error);
+    else
+      std::rethrow_exception(error);
+  }
+  catch (std::exception const& e)
+  {
+    std::cerr << "Error in subscription " << subscription.id << ": " << e.what() << std::endl;
+  }
+  catch (...)
+  {
+    std::cerr << "Unknown error in subscription " << subscription.id << std::endl;
+  }
+}
+
+/***********************************************************************************************************************
+ * Struct definitions: SubscriptionReactor::Subscription
+ */
+
+SubscriptionReactor::Subscription::Subscription(std::size_t id, std::unique_ptr<SubscriptionReceiver> receiver,
+                                                SubscriptionCallback& callback, ErrorHandler error_handler)
+  : id{ id }, receiver{ std::move(receiver) }, callback{ callback }, error_handler{ std::move(error_handler) }
+{
+}
+}  // namespace abb::rws
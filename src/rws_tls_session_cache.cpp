@@ -0,0 +1,73 @@
+#include <abb_librws/rws_tls_session_cache.h>
+
+#include <Poco/Net/SecureStreamSocket.h>
+#include <Poco/Net/SocketAddress.h>
+
+namespace abb ::rws
+{
+/***********************************************************************************************************************
+ * Class definitions: TLSSessionCache::ResumingSession
+ */
+
+/**
+ * \brief HTTPS session reporting its handshakes to the cache.
+ */
+class TLSSessionCache::ResumingSession : public Poco::Net::HTTPSClientSession
+{
+public:
+  ResumingSession(TLSSessionCache& cache, std::string const& host, Poco::UInt16 port)
+    : Poco::Net::HTTPSClientSession{ host, port, cache.context(), cache.latestSession() }, cache_{ cache }
+  {
+  }
+
+protected:
+  void connect(Poco::Net::SocketAddress const& address) override
+  {
+    // The base class offers its TLS session for resumption and performs the handshake.
+    Poco::Net::HTTPSClientSession::connect(address);
+
+    Poco::Net::SecureStreamSocket secure_socket{ socket() };
+    cache_.connected(secure_socket.currentSession(), secure_socket.sessionWasReused());
+  }
+
+private:
+  TLSSessionCache& cache_;
+};
+
+/***********************************************************************************************************************
+ * Class definitions: TLSSessionCache
+ */
+
+TLSSessionCache::TLSSessionCache(std::string const& cipher_list)
+  : context_{ new Poco::Net::Context{ Poco::Net::Context::CLIENT_USE, "", "", "", Poco::Net::Context::VERIFY_NONE, 9,
+                                      false, cipher_list } }
+{
+  context_->enableSessionCache(true);
+}
+
+std::unique_ptr<Poco::Net::HTTPSClientSession> TLSSessionCache::createSession(std::string const& host,
+                                                                              Poco::UInt16 port)
+{
+  return std::make_unique<ResumingSession>(*this, host, port);
+}
+
+void TLSSessionCache::connected(Poco::Net::Session::Ptr tls_session, bool resumed)
+{
+  if (resumed)
+    resumed_handshakes_.fetch_add(1, std::memory_order_relaxed);
+  else
+    full_handshakes_.fetch_add(1, std::memory_order_relaxed);
+
+  if (tls_session)
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+    latest_session_ = tls_session;
+  }
+}
+
+Poco::Net::Session::Ptr TLSSessionCache::latestSession() const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  return latest_session_;
+}
+}  // namespace abb::rws
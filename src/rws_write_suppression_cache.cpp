@@ -0,0 +1,115 @@
+#include <abb_librws/rws_write_suppression_cache.h>
+
+#include <utility>
+
+namespace abb ::rws
+{
+void WriteSuppressionCache::setEnabled(bool enabled)
+{
+  enabled_.store(enabled, std::memory_order_relaxed);
+
+  if (!enabled)
+    clear();
+}
+
+bool WriteSuppressionCache::suppress(RAPIDResource const& resource, std::string const& value)
+{
+  return isEnabled() && suppress(rapid_symbols_, makeKey(resource), value);
+}
+
+bool WriteSuppressionCache::suppress(IOSignalResource const& resource, std::string const& value)
+{
+  return isEnabled() && suppress(io_signals_, resource.name, value);
+}
+
+void WriteSuppressionCache::confirm(RAPIDResource const& resource, std::string const& value)
+{
+  if (isEnabled())
+  {
+    written_.fetch_add(1, std::memory_order_relaxed);
+    confirm(rapid_symbols_, makeKey(resource), value);
+  }
+}
+
+void WriteSuppressionCache::confirm(IOSignalResource const& resource, std::string const& value)
+{
+  if (isEnabled())
+  {
+    written_.fetch_add(1, std::memory_order_relaxed);
+    confirm(io_signals_, resource.name, value);
+  }
+}
+
+void WriteSuppressionCache::observe(RAPIDResource const& resource, std::string const& value)
+{
+  if (isEnabled())
+    confirm(rapid_symbols_, makeKey(resource), value);
+}
+
+void WriteSuppressionCache::observe(IOSignalResource const& resource, std::string const& value)
+{
+  if (isEnabled())
+    confirm(io_signals_, resource.name, value);
+}
+
+void WriteSuppressionCache::update(IOSignalStateEvent const& event)
+{
+  observe(IOSignalResource{ event.signal }, event.value);
+}
+
+void WriteSuppressionCache::update(RAPIDSymbolValueEvent const& event)
+{
+  if (!event.value.empty())
+    observe(RAPIDResource{ event.task, event.module, event.name }, event.value);
+}
+
+void WriteSuppressionCache::invalidate(RAPIDResource const& resource)
+{
+  invalidate(rapid_symbols_, makeKey(resource));
+}
+
+void WriteSuppressionCache::invalidate(IOSignalResource const& resource)
+{
+  invalidate(io_signals_, resource.name);
+}
+
+void WriteSuppressionCache::clear()
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  invalidations_.fetch_add(rapid_symbols_.size() + io_signals_.size(), std::memory_order_relaxed);
+  rapid_symbols_.clear();
+  io_signals_.clear();
+}
+
+bool WriteSuppressionCache::suppress(ValueMap const& values, std::string const& key, std::string const& value)
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  auto const it = values.find(key);
+  if (it == values.end() || it->second != value)
+    return false;
+
+  suppressed_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+void WriteSuppressionCache::confirm(ValueMap& values, std::string key, std::string const& value)
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  values.insert_or_assign(std::move(key), value);
+}
+
+void WriteSuppressionCache::invalidate(ValueMap& values, std::string const& key)
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+
+  if (values.erase(key) > 0)
+    invalidations_.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::string WriteSuppressionCache::makeKey(RAPIDResource const& resource)
+{
+  return resource.task + "/" + resource.module + "/" + resource.name;
+}
+}  // namespace abb::rws
@@ -10,24 +10,35 @@ static bool digitalSignalToBool(std::string const& value);
 
 IOSignalInfo getIOSignals(RWSClient& client)
 {
-  auto const doc = parseXml(client.httpGet(Resources::RW_IOSYSTEM_SIGNALS).content());
-
   IOSignalInfo signals;
-
-  for (auto&& node : xmlFindNodes(doc, { "class", "ios-signal-li" }))
-  {
-    std::string const name = xmlFindTextContent(node, { "class", "name" });
-    std::string const value = xmlFindTextContent(node, { "class", "lvalue" });
-    std::string const type = xmlFindTextContent(node, { "class", "type" });
-
-    if (!name.empty() && !value.empty())
-    {
-      if (type == "DI" || type == "DO")
-        signals[name] = digitalSignalToBool(value);
-      else if (type == "AI" || type == "AO")
-        signals[name] = std::stof(value);
-    }
-  }
+  std::string name;
+  std::string value;
+  std::string type;
+
+  client.extractContent(
+      client.httpGet(Resources::RW_IOSYSTEM_SIGNALS),
+      { { "class", "ios-signal-li" }, "class", { "name", "lvalue", "type" } },
+      [&](std::string const& key, std::string const& text) {
+        if (key == "name")
+          name = text;
+        else if (key == "lvalue")
+          value = text;
+        else
+          type = text;
+      },
+      [&](std::string const&) {
+        if (!name.empty() && !value.empty())
+        {
+          if (type == "DI" || type == "DO")
+            signals[name] = digitalSignalToBool(value);
+          else if (type == "AI" || type == "AO")
+            signals[name] = std::stof(value);
+        }
+
+        name.clear();
+        value.clear();
+        type.clear();
+      });
 
   return signals;
 }
@@ -69,7 +80,7 @@ std::string getIOSignal(RWSClient& client, const std::string& iosignal)
   try
   {
     std::string const uri = generateIOSignalPath(iosignal);
-    auto const rws_result = parseXml(client.httpGet(uri).content());
+    auto const rws_result = client.parseContent(client.httpGet(uri));
 
     return xmlFindTextContent(rws_result, XMLAttributes::CLASS_LVALUE);
   }
@@ -3,6 +3,8 @@
 #include <abb_librws/parsing.h>
 #include <abb_librws/system_constants.h>
 
+#include <map>
+
 namespace abb ::rws ::v1_0 ::rw ::rapid
 {
 /**
@@ -48,7 +50,7 @@ RAPIDExecutionInfo getRAPIDExecution(RWSClient& client)
   RAPIDExecutionInfo result;
 
   std::string const uri = Resources::RW_RAPID_EXECUTION;
-  RWSResult xml_content = parseXml(client.httpGet(uri).content());
+  RWSResult xml_content = client.parseContent(client.httpGet(uri));
 
   Poco::XML::Node const* li_node = xml_content->getNodeByPath("html/body/div/ul/li");
   if (!li_node)
@@ -104,7 +106,7 @@ void setRAPIDSymbolData(RWSClient& client, const RAPIDResource& resource, const
 std::string getRAPIDSymbolData(RWSClient& client, RAPIDResource const& resource)
 {
   std::string const uri = generateRAPIDDataPath(resource);
-  RWSResult xml_content = parseXml(client.httpGet(uri).content());
+  RWSResult xml_content = client.parseContent(client.httpGet(uri));
   std::string value = xmlFindTextContent(xml_content, XMLAttributes::CLASS_VALUE);
 
   if (value.empty())
@@ -124,7 +126,7 @@ void setRAPIDSymbolData(RWSClient& client, const RAPIDResource& resource, const
 static RWSResult getRAPIDSymbolProperties(RWSClient& client, RAPIDResource const& resource)
 {
   std::string const uri = generateRAPIDPropertiesPath(resource);
-  return parseXml(client.httpGet(uri).content());
+  return client.parseContent(client.httpGet(uri));
 }
 
 static std::string generateRAPIDDataPath(const RAPIDResource& resource)
@@ -142,16 +144,18 @@ std::vector<RAPIDModuleInfo> getRAPIDModulesInfo(RWSClient& client, const std::s
   std::vector<RAPIDModuleInfo> result;
 
   std::string const uri = Resources::RW_RAPID_MODULES + "?" + Queries::TASK + task;
-  RWSResult const rws_result = parseXml(client.httpGet(uri).content());
-  std::vector<Poco::XML::Node*> node_list = xmlFindNodes(rws_result, XMLAttributes::CLASS_RAP_MODULE_INFO_LI);
-
-  for (size_t i = 0; i < node_list.size(); ++i)
-  {
-    std::string name = xmlFindTextContent(node_list.at(i), XMLAttributes::CLASS_NAME);
-    std::string type = xmlFindTextContent(node_list.at(i), XMLAttributes::CLASS_TYPE);
-
-    result.push_back(RAPIDModuleInfo(name, type));
-  }
+  std::string name;
+  std::string type;
+
+  client.extractContent(
+      client.httpGet(uri),
+      { XMLAttributes::CLASS_RAP_MODULE_INFO_LI, Identifiers::CLASS, { Identifiers::NAME, Identifiers::TYPE } },
+      [&](std::string const& key, std::string const& text) { (key == Identifiers::NAME ? name : type) = text; },
+      [&](std::string const&) {
+        result.push_back(RAPIDModuleInfo(name, type));
+        name.clear();
+        type.clear();
+      });
 
   return result;
 }
@@ -160,39 +164,43 @@ std::vector<RAPIDTaskInfo> getRAPIDTasks(RWSClient& client)
 {
   std::vector<RAPIDTaskInfo> result;
 
-  RWSResult const rws_result = parseXml(client.httpGet(Resources::RW_RAPID_TASKS).content());
-  std::vector<Poco::XML::Node*> node_list = xmlFindNodes(rws_result, XMLAttributes::CLASS_RAP_TASK_LI);
-
-  for (size_t i = 0; i < node_list.size(); ++i)
-  {
-    std::string name = xmlFindTextContent(node_list.at(i), XMLAttributes::CLASS_NAME);
-    bool is_motion_task =
-        xmlFindTextContent(node_list.at(i), XMLAttributes::CLASS_MOTIONTASK) == SystemConstants::RAPID::RAPID_TRUE;
-    bool is_active = xmlFindTextContent(node_list.at(i), XMLAttributes::CLASS_ACTIVE) == "On";
-    std::string temp = xmlFindTextContent(node_list.at(i), XMLAttributes::CLASS_EXCSTATE);
-
-    // Assume task state is unknown, update based on contents of 'temp'.
-    RAPIDTaskExecutionState execution_state = RAPIDTaskExecutionState::UNKNOWN;
-
-    if (temp == "read")
-    {
-      execution_state = RAPIDTaskExecutionState::READY;
-    }
-    else if (temp == "stop")
-    {
-      execution_state = RAPIDTaskExecutionState::STOPPED;
-    }
-    else if (temp == "star")
-    {
-      execution_state = RAPIDTaskExecutionState::STARTED;
-    }
-    else if (temp == "unin")
-    {
-      execution_state = RAPIDTaskExecutionState::UNINITIALIZED;
-    }
-
-    result.push_back(RAPIDTaskInfo(name, is_motion_task, is_active, execution_state));
-  }
+  std::map<std::string, std::string> fields;
+
+  client.extractContent(
+      client.httpGet(Resources::RW_RAPID_TASKS),
+      { XMLAttributes::CLASS_RAP_TASK_LI,
+        Identifiers::CLASS,
+        { Identifiers::NAME, Identifiers::MOTIONTASK, Identifiers::ACTIVE, Identifiers::EXCSTATE } },
+      [&](std::string const& key, std::string const& text) { fields[key] = text; },
+      [&](std::string const&) {
+        std::string name = fields[Identifiers::NAME];
+        bool is_motion_task = fields[Identifiers::MOTIONTASK] == SystemConstants::RAPID::RAPID_TRUE;
+        bool is_active = fields[Identifiers::ACTIVE] == "On";
+        std::string temp = fields[Identifiers::EXCSTATE];
+        fields.clear();
+
+        // Assume task state is unknown, update based on contents of 'temp'.
+        RAPIDTaskExecutionState execution_state = RAPIDTaskExecutionState::UNKNOWN;
+
+        if (temp == "read")
+        {
+          execution_state = RAPIDTaskExecutionState::READY;
+        }
+        else if (temp == "stop")
+        {
+          execution_state = RAPIDTaskExecutionState::STOPPED;
+        }
+        else if (temp == "star")
+        {
+          execution_state = RAPIDTaskExecutionState::STARTED;
+        }
+        else if (temp == "unin")
+        {
+          execution_state = RAPIDTaskExecutionState::UNINITIALIZED;
+        }
+
+        result.push_back(RAPIDTaskInfo(name, is_motion_task, is_active, execution_state));
+      });
 
   return result;
 }
@@ -41,6 +41,7 @@
 
 #include <Poco/Net/HTTPRequest.h>
 
+#include <memory>
 #include <sstream>
 #include <stdexcept>
 
@@ -60,11 +61,20 @@ using namespace Poco::Net;
 
 RWSClient::RWSClient(ConnectionOptions const& connection_options)
   : connectionOptions_{ connection_options }
-  , session_{ connectionOptions_.ip_address, connectionOptions_.port }
-  , http_client_{ session_, connectionOptions_.username, connectionOptions_.password }
+  , http_client_{
+    [this] {
+      auto session = std::make_unique<Poco::Net::HTTPClientSession>(connectionOptions_.ip_address,
+                                                                    connectionOptions_.port);
+      session->setTimeout(connectionOptions_.connection_timeout.count(), connectionOptions_.send_timeout.count(),
+                          connectionOptions_.receive_timeout.count());
+      return session;
+    },
+    connectionOptions_.username, connectionOptions_.password, connectionOptions_.session_pool_size,
+    connectionOptions_.session_metrics
+  }
 {
-  session_.setTimeout(connectionOptions_.connection_timeout.count(), connectionOptions_.send_timeout.count(),
-                      connectionOptions_.receive_timeout.count());
+  http_client_.setLogMode(connectionOptions_.log_mode, connectionOptions_.log_content_limit);
+  http_client_.metrics().setEnabled(connectionOptions_.request_metrics);
 
   // Make a request to the server to check connection and initiate authentification.
   getRobotWareSystem();
@@ -95,6 +105,15 @@ RWSResult RWSClient::getConfigurationInstances(const std::string& topic, const s
   return parseContent(httpGet(uri));
 }
 
+void RWSClient::getConfigurationInstances(const std::string& topic, const std::string& type,
+                                          XMLFieldCallback const& on_attribute, XMLRecordCallback const& on_instance)
+{
+  std::string uri = generateConfigurationPath(topic, type) + Resources::INSTANCES;
+  extractContent(httpGet(uri),
+                 { XMLAttributes::CLASS_CFG_DT_INSTANCE_LI, Identifiers::TITLE, {}, XMLAttributes::CLASS_CFG_IA_T_LI },
+                 on_attribute, on_instance);
+}
+
 RWSResult RWSClient::getMechanicalUnitStaticInfo(const std::string& mechunit)
 {
   std::string uri = generateMechanicalUnitPath(mechunit) + "?resource=static";
@@ -211,7 +230,29 @@ void RWSClient::registerRemoteUser(const std::string& username, const std::strin
 
 RWSResult RWSClient::parseContent(const POCOResult& poco_result)
 {
-  return parser_.parseString(poco_result.content());
+  RequestMetrics& metrics = http_client_.metrics();
+
+  if (!metrics.enabled())
+    return parseXml(poco_result.content());
+
+  auto const start = RequestMetrics::Clock::now();
+  RWSResult result = parseXml(poco_result.content());
+  metrics.recordParse(poco_result.method(), poco_result.uri(), RequestMetrics::Clock::now() - start);
+
+  return result;
+}
+
+void RWSClient::extractContent(const POCOResult& poco_result, XMLExtractQuery const& query,
+                               XMLFieldCallback const& on_field, XMLRecordCallback const& on_record)
+{
+  RequestMetrics& metrics = http_client_.metrics();
+
+  if (!metrics.enabled())
+    return xmlExtract(poco_result.content(), query, on_field, on_record);
+
+  auto const start = RequestMetrics::Clock::now();
+  xmlExtract(poco_result.content(), query, on_field, on_record);
+  metrics.recordParse(poco_result.method(), poco_result.uri(), RequestMetrics::Clock::now() - start);
 }
 
 std::string RWSClient::generateConfigurationPath(const std::string& topic, const std::string& type)
@@ -379,11 +420,11 @@ std::string RWSClient::getResourceURI(OperationModeResource const&) const
 
 void RWSClient::processEvent(Poco::AutoPtr<Poco::XML::Document> doc, SubscriptionCallback& callback) const
 {
-  // IMPORTANT: don't use AutoPtr<XML::Node> here! Otherwise you will get memory corruption.
-  Poco::XML::Node const* li_node = doc->getNodeByPath("html/body/div/ul/li");
-  if (!li_node)
-    BOOST_THROW_EXCEPTION(ProtocolError{ "Cannot parse RWS event message: can't find XML path html/body/div/ul/li" });
+  processEventMessage(doc, &RWSClient::parseEvent, callback);
+}
 
+SubscriptionEvent RWSClient::parseEvent(Poco::XML::Node const* li_node)
+{
   auto const* a_node = li_node->getNodeByPath("a");
   if (!a_node)
     BOOST_THROW_EXCEPTION(ProtocolError{ "Cannot parse RWS event message: can't find XML path html/body/div/ul/li/a" });
@@ -404,25 +445,31 @@ void RWSClient::processEvent(Poco::AutoPtr<Poco::XML::Document> doc, Subscriptio
 
     event.signal = uri.substr(prefix.length(), uri.find(";") - prefix.length());
     event.value = xmlFindTextContent(li_node, XMLAttribute{ "class", "lvalue" });
-    callback.processEvent(event);
+    return event;
   }
   else if (class_attribute_value == "rap-ctrlexecstate-ev")
   {
     RAPIDExecutionStateEvent event;
     event.state = rw::makeRAPIDExecutionState(xmlFindTextContent(li_node, XMLAttribute{ "class", "ctrlexecstate" }));
-    callback.processEvent(event);
+    return event;
   }
   else if (class_attribute_value == "pnl-ctrlstate-ev")
   {
     ControllerStateEvent event;
     event.state = rw::makeControllerState(xmlFindTextContent(li_node, XMLAttribute{ "class", "ctrlstate" }));
-    callback.processEvent(event);
+    return event;
   }
   else if (class_attribute_value == "pnl-opmode-ev")
   {
     OperationModeEvent event;
     event.mode = rw::makeOperationMode(xmlFindTextContent(li_node, XMLAttribute{ "class", "opmode" }));
-    callback.processEvent(event);
+    return event;
+  }
+  else if (class_attribute_value == "rap-value-ev")
+  {
+    RAPIDSymbolValueEvent event = parseRAPIDSymbolValueEventURI(uri);
+    event.value = xmlFindTextContent(li_node, XMLAttribute{ "class", "value" });
+    return event;
   }
   else
     BOOST_THROW_EXCEPTION(
@@ -9,7 +9,7 @@ namespace abb ::rws ::v2_0 ::rw ::panel
 ControllerState getControllerState(RWSClient& client)
 {
   std::string uri = Resources::RW_PANEL_CTRLSTATE;
-  RWSResult xml_content = parseXml(client.httpGet(uri).content());
+  RWSResult xml_content = client.parseContent(client.httpGet(uri));
 
   Poco::XML::Node const* li_node = xml_content->getNodeByPath("html/body/div/ul/li");
   if (!li_node)
@@ -25,7 +25,7 @@ ControllerState getControllerState(RWSClient& client)
 OperationMode getOperationMode(RWSClient& client)
 {
   std::string uri = Resources::RW_PANEL_OPMODE;
-  RWSResult xml_content = parseXml(client.httpGet(uri).content());
+  RWSResult xml_content = client.parseContent(client.httpGet(uri));
 
   Poco::XML::Node const* li_node = xml_content->getNodeByPath("html/body/div/ul/li");
   if (!li_node)
@@ -51,7 +51,7 @@ void setControllerState(RWSClient& client, ControllerState state)
 unsigned getSpeedRatio(RWSClient& client)
 {
   std::string uri = "/rw/panel/speedratio";
-  RWSResult rws_result = parseXml(client.httpGet(uri).content());
+  RWSResult rws_result = client.parseContent(client.httpGet(uri));
 
   return std::stoul(xmlFindTextContent(rws_result, XMLAttribute(Identifiers::CLASS, "speedratio")));
 }
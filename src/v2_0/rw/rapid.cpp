@@ -4,6 +4,14 @@
 #include <abb_librws/parsing.h>
 #include <abb_librws/system_constants.h>
 
+#include <exception>
+#include <future>
+#include <map>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string_view>
+
 namespace abb ::rws ::v2_0 ::rw ::rapid
 {
 /**
@@ -17,6 +25,55 @@ namespace abb ::rws ::v2_0 ::rw ::rapid
  */
 static RWSResult getRAPIDSymbolProperties(RWSClient& client, RAPIDResource const& resource);
 
+/**
+ * \brief A method for retrieving the validated information of a RAPID symbol, from the client's symbol cache or else
+ * from the symbol properties (and then adding it to the cache).
+ *
+ * \param resource specifying the RAPID task, module and symbol names for the RAPID resource.
+ *
+ * \return RAPIDSymbolInfo containing the information.
+ *
+ * \throw \a RWSError if something goes wrong.
+ */
+static RAPIDSymbolInfo lookupRAPIDSymbol(RWSClient& client, RAPIDResource const& resource);
+
+/**
+ * \brief A method for retrieving the layout of a RAPID data type, from the client's symbol cache or else from the
+ * type and record component properties (and then adding it to the cache).
+ *
+ * \param type_url specifying the URL of the data type (e.g. "RAPID/T_ROB1/user/mytype"). May be empty for atomic types.
+ * \param data_type specifying the name of the data type.
+ *
+ * \return RAPIDSchema containing the layout.
+ *
+ * \throw \a RWSError if something goes wrong.
+ */
+static std::shared_ptr<RAPIDSchema const> lookupRAPIDType(RWSClient& client, std::string const& type_url,
+                                                          std::string const& data_type);
+
+/**
+ * \brief A method for retrieving the names and layouts of the components of a RAPID record type, in declaration order.
+ *
+ * \param type_url specifying the URL of the record type.
+ *
+ * \return std::vector containing the components.
+ *
+ * \throw \a RWSError if something goes wrong.
+ */
+static std::vector<std::pair<std::string, RAPIDSchema>> getRAPIDRecordComponents(RWSClient& client,
+                                                                                 std::string const& type_url);
+
+/**
+ * \brief A method for retrieving the value of a RAPID symbol in raw text format.
+ *
+ * \param data_path specifying the URI path of the symbol's data resource.
+ *
+ * \return String containing the data.
+ *
+ * \throw \a RWSError if something goes wrong.
+ */
+static std::string getRAPIDSymbolValue(RWSClient& client, std::string const& data_path);
+
 /**
  * \brief Method for generating a RAPID data resource URI path.
  *
@@ -26,6 +83,45 @@ static RWSResult getRAPIDSymbolProperties(RWSClient& client, RAPIDResource const
  */
 static std::string generateRAPIDDataPath(const RAPIDResource& resource);
 
+/**
+ * \brief Method for parsing the dimensions of a RAPID array, from the "dim" text of the symbol properties.
+ *
+ * \param dim containing the size of each dimension, separated by spaces.
+ *
+ * \return std::vector<std::size_t> containing the size of each dimension.
+ */
+static std::vector<std::size_t> parseRAPIDDimensions(std::string const& dim);
+
+/**
+ * \brief Method for generating the resource of a RAPID array element.
+ *
+ * \param resource specifying the RAPID task, module and symbol names for the RAPID array.
+ * \param index zero-based index of the element.
+ *
+ * \return RAPIDResource addressing the element.
+ */
+static RAPIDResource makeRAPIDArrayElementResource(const RAPIDResource& resource, std::size_t index);
+
+/**
+ * \brief Method for waiting for the transfers of RAPID array elements submitted to the client's executor.
+ *
+ * Every transfer is waited for, also after one has failed, since the transfers refer to the caller's data.
+ *
+ * \param transfers the results of the transfers.
+ *
+ * \throw the error of the first failed transfer, if any.
+ */
+static void waitForRAPIDArrayElements(std::vector<std::future<void>>& transfers);
+
+/**
+ * \brief Method for generating a RAPID data type properties resource URI path.
+ *
+ * \param type_url specifying the URL of the data type.
+ *
+ * \return std::string containing the path.
+ */
+static std::string generateRAPIDTypePropertiesPath(const std::string& type_url);
+
 /**
  * \brief Method for generating a RAPID properties resource URI path.
  *
@@ -49,7 +145,7 @@ RAPIDExecutionInfo getRAPIDExecution(RWSClient& client)
   RAPIDExecutionInfo result;
 
   std::string const uri = Resources::RW_RAPID_EXECUTION;
-  RWSResult xml_content = parseXml(client.httpGet(uri).content());
+  RWSResult xml_content = client.parseContent(client.httpGet(uri));
 
   Poco::XML::Node const* li_node = xml_content->getNodeByPath("html/body/div/ul/li");
   if (!li_node)
@@ -93,17 +189,26 @@ void resetRAPIDProgramPointer(RWSClient& client, Mastership const& mastership)
   std::string content_type = "application/x-www-form-urlencoded;v=2.0";
 
   client.httpPost(uri.str(), "", content_type);
+  client.rapidSymbolCache().clear();
 }
 
 void getRAPIDSymbolData(RWSClient& client, RAPIDResource const& resource, RAPIDSymbolDataAbstract& data)
 {
-  RWSResult const temp_result = getRAPIDSymbolProperties(client, resource);
-  std::string const data_type = xmlFindTextContent(temp_result, XMLAttributes::CLASS_DATTYP);
+  RAPIDSymbolInfo const info = lookupRAPIDSymbol(client, resource);
 
-  if (data.getType() == data_type)
-    data.parseString(getRAPIDSymbolData(client, resource));
-  else
+  if (data.getType() != info.data_type)
     BOOST_THROW_EXCEPTION(std::invalid_argument{ "Argument type does not match the RAPID variable type" });
+
+  try
+  {
+    data.parseString(getRAPIDSymbolValue(client, info.data_path));
+  }
+  catch (...)
+  {
+    // The symbol may have been removed or changed since it was cached.
+    client.rapidSymbolCache().erase(resource);
+    throw;
+  }
 }
 
 void setRAPIDSymbolData(RWSClient& client, const RAPIDResource& resource, const RAPIDSymbolDataAbstract& data,
@@ -112,16 +217,94 @@ void setRAPIDSymbolData(RWSClient& client, const RAPIDResource& resource, const
   setRAPIDSymbolData(client, resource, data.constructString(), initval, log, mastership);
 }
 
-std::string getRAPIDSymbolData(RWSClient& client, RAPIDResource const& resource)
+std::vector<std::size_t> getRAPIDSymbolDimensions(RWSClient& client, RAPIDResource const& resource)
 {
-  std::string const uri = generateRAPIDDataPath(resource);
-  RWSResult xml_content = parseXml(client.httpGet(uri).content());
-  std::string value = xmlFindTextContent(xml_content, XMLAttributes::CLASS_VALUE);
+  return lookupRAPIDSymbol(client, resource).dimensions;
+}
 
-  if (value.empty())
-    BOOST_THROW_EXCEPTION(std::logic_error{ "RAPID value string was empty" });
+std::shared_ptr<RAPIDSchema const> getRAPIDSymbolSchema(RWSClient& client, RAPIDResource const& resource)
+{
+  RAPIDSymbolInfo const info = lookupRAPIDSymbol(client, resource);
+  std::shared_ptr<RAPIDSchema const> type = lookupRAPIDType(client, info.type_url, info.data_type);
 
-  return value;
+  if (info.dimensions.empty())
+    return type;
+
+  return std::make_shared<RAPIDSchema const>(RAPIDSchema::array(*type, info.dimensions));
+}
+
+void getRAPIDSymbolData(RWSClient& client, RAPIDResource const& resource, RAPIDDynamicArrayAbstract& data,
+                        RAPIDArrayRange const& range)
+{
+  RAPIDSymbolInfo const info = lookupRAPIDSymbol(client, resource);
+  std::vector<std::size_t> const& dimensions = info.dimensions;
+
+  if (data.getType() != info.data_type || dimensions.size() != 1)
+    BOOST_THROW_EXCEPTION(
+        std::invalid_argument{ "Argument type does not match the RAPID variable type, or it is not a 1D array" });
+
+  if (range.first + range.count > dimensions[0])
+    BOOST_THROW_EXCEPTION(std::out_of_range{ "RAPID array range exceeds the size of the RAPID array" });
+
+  data.resize(dimensions[0]);
+
+  // One request for the whole array is cheaper than one request per element when the range covers most of it.
+  if (2 * range.count > dimensions[0])
+  {
+    std::string const value = getRAPIDSymbolValue(client, info.data_path);
+    std::vector<std::string_view> const substrings = splitDelimitedSubstrings(value, '[', ']', ',');
+
+    if (substrings.size() != dimensions[0])
+      BOOST_THROW_EXCEPTION(ProtocolError{ "Unexpected number of RAPID array elements" }
+                            << UriErrorInfo{ info.data_path });
+
+    for (std::size_t i = range.first; i < range.first + range.count; ++i)
+      data.element(i).parseStringView(substrings[i]);
+
+    return;
+  }
+
+  std::vector<std::future<void>> reads;
+  reads.reserve(range.count);
+
+  for (std::size_t i = range.first; i < range.first + range.count; ++i)
+  {
+    RAPIDResource const element_resource = makeRAPIDArrayElementResource(resource, i);
+    RAPIDSymbolDataAbstract& element = data.element(i);
+
+    reads.push_back(submit(client.executor(), [&client, element_resource, &element] {
+      element.parseString(getRAPIDSymbolData(client, element_resource));
+    }));
+  }
+
+  waitForRAPIDArrayElements(reads);
+}
+
+void setRAPIDSymbolData(RWSClient& client, const RAPIDResource& resource, const RAPIDDynamicArrayAbstract& data,
+                        RAPIDArrayRange const& range, bool initval, bool log, Mastership const& mastership)
+{
+  if (range.first + range.count > data.size())
+    BOOST_THROW_EXCEPTION(std::out_of_range{ "RAPID array range exceeds the size of the array" });
+
+  std::vector<std::future<void>> writes;
+  writes.reserve(range.count);
+
+  for (std::size_t i = range.first; i < range.first + range.count; ++i)
+  {
+    RAPIDResource const element_resource = makeRAPIDArrayElementResource(resource, i);
+    std::string const element_data = data.element(i).constructString();
+
+    writes.push_back(submit(client.executor(), [&client, element_resource, element_data, initval, log, mastership] {
+      setRAPIDSymbolData(client, element_resource, element_data, initval, log, mastership);
+    }));
+  }
+
+  waitForRAPIDArrayElements(writes);
+}
+
+std::string getRAPIDSymbolData(RWSClient& client, RAPIDResource const& resource)
+{
+  return getRAPIDSymbolValue(client, generateRAPIDDataPath(resource));
 }
 
 void setRAPIDSymbolData(RWSClient& client, const RAPIDResource& resource, const std::string& data, bool initval,
@@ -139,78 +322,216 @@ void setRAPIDSymbolData(RWSClient& client, const RAPIDResource& resource, const
 static RWSResult getRAPIDSymbolProperties(RWSClient& client, RAPIDResource const& resource)
 {
   std::string const uri = generateRAPIDPropertiesPath(resource);
-  return parseXml(client.httpGet(uri).content());
+  return client.parseContent(client.httpGet(uri));
 }
 
-static std::string generateRAPIDDataPath(const RAPIDResource& resource)
+static RAPIDSymbolInfo lookupRAPIDSymbol(RWSClient& client, RAPIDResource const& resource)
 {
-  return Resources::RW_RAPID_SYMBOL_DATA_RAPID + "/" + resource.task + "/" + resource.module + "/" + resource.name +
-         "/data";
+  if (std::optional<RAPIDSymbolInfo> info = client.rapidSymbolCache().find(resource))
+    return std::move(*info);
+
+  static XMLTextContentQuery const query{ XMLAttributes::CLASS_DATTYP, XMLAttributes::CLASS_DIM,
+                                          XMLAttributes::CLASS_TYPURL };
+  std::vector<std::string> const properties = query.find(getRAPIDSymbolProperties(client, resource));
+
+  RAPIDSymbolInfo info{ properties[0], parseRAPIDDimensions(properties[1]), generateRAPIDDataPath(resource),
+                        properties[2] };
+  client.rapidSymbolCache().insert(resource, info);
+
+  return info;
 }
 
-static std::string generateRAPIDPropertiesPath(const RAPIDResource& resource)
+static std::shared_ptr<RAPIDSchema const> lookupRAPIDType(RWSClient& client, std::string const& type_url,
+                                                          std::string const& data_type)
 {
-  return Resources::RW_RAPID_SYMBOL_PROPERTIES_RAPID + "/" + resource.task + "/" + resource.module + "/" +
-         resource.name + "/properties";
+  std::string const& key = type_url.empty() ? data_type : type_url;
+
+  if (std::shared_ptr<RAPIDSchema const> schema = client.rapidSymbolCache().findSchema(key))
+    return schema;
+
+  // The built-in atomic types are known without retrieving their properties.
+  RAPIDSchema schema = RAPIDSchema::atomic(data_type);
+
+  if (schema.node(0).atomic == RAPIDAtomicKind::TEXT && !type_url.empty())
+  {
+    static XMLTextContentQuery const query{ XMLAttributes::CLASS_SYMTYP, XMLAttributes::CLASS_LINKTYP };
+    std::vector<std::string> const properties =
+        query.find(client.parseContent(client.httpGet(generateRAPIDTypePropertiesPath(type_url))));
+
+    if (properties[0] == "rec")
+      schema = RAPIDSchema::record(data_type, getRAPIDRecordComponents(client, type_url));
+    else if (properties[0] == "ali")
+      schema = RAPIDSchema::atomic(data_type, RAPIDSchema::atomic(properties[1]).node(0).atomic);
+  }
+
+  auto const result = std::make_shared<RAPIDSchema const>(std::move(schema));
+  client.rapidSymbolCache().insertSchema(key, result);
+
+  return result;
 }
 
-std::vector<RAPIDModuleInfo> getRAPIDModulesInfo(RWSClient& client, const std::string& task)
+static std::vector<std::pair<std::string, RAPIDSchema>> getRAPIDRecordComponents(RWSClient& client,
+                                                                                 std::string const& type_url)
 {
-  std::vector<RAPIDModuleInfo> result;
+  std::string const content = "view=block&blockurl=" + type_url + "&symtyp=rcp&recursive=false";
+  std::string const content_type = "application/x-www-form-urlencoded;v=2.0";
 
-  std::string const uri = "/rw/rapid/tasks/" + task + "/modules";
-  RWSResult const rws_result = parseXml(client.httpGet(uri).content());
-  std::vector<Poco::XML::Node*> node_list = xmlFindNodes(rws_result, XMLAttributes::CLASS_RAP_MODULE_INFO_LI);
+  std::vector<std::map<std::string, std::string>> components;
+  std::map<std::string, std::string> fields;
 
-  for (size_t i = 0; i < node_list.size(); ++i)
-  {
-    std::string name = xmlFindTextContent(node_list.at(i), XMLAttributes::CLASS_NAME);
-    std::string type = xmlFindTextContent(node_list.at(i), XMLAttributes::CLASS_TYPE);
+  client.extractContent(
+      client.httpPost(Resources::RW_RAPID_SYMBOLS_SEARCH, content, content_type),
+      { XMLAttributes::CLASS_RAP_SYMPROPRECCOMP_LI,
+        Identifiers::CLASS,
+        { Identifiers::NAME, Identifiers::DATTYP, Identifiers::TYPURL } },
+      [&](std::string const& key, std::string const& text) { fields[key] = text; },
+      [&](std::string const&) {
+        components.push_back(std::move(fields));
+        fields.clear();
+      });
 
-    result.push_back(RAPIDModuleInfo(name, type));
+  std::vector<std::pair<std::string, RAPIDSchema>> result;
+  result.reserve(components.size());
+
+  for (auto& component : components)
+  {
+    std::shared_ptr<RAPIDSchema const> const schema =
+        lookupRAPIDType(client, component[Identifiers::TYPURL], component[Identifiers::DATTYP]);
+    result.emplace_back(std::move(component[Identifiers::NAME]), *schema);
   }
 
   return result;
 }
 
-std::vector<RAPIDTaskInfo> getRAPIDTasks(RWSClient& client)
+static std::string getRAPIDSymbolValue(RWSClient& client, std::string const& data_path)
 {
-  std::vector<RAPIDTaskInfo> result;
+  RWSResult xml_content = client.parseContent(client.httpGet(data_path));
+  std::string value = xmlFindTextContent(xml_content, XMLAttributes::CLASS_VALUE);
 
-  RWSResult const rws_result = parseXml(client.httpGet(Resources::RW_RAPID_TASKS).content());
-  std::vector<Poco::XML::Node*> node_list = xmlFindNodes(rws_result, XMLAttributes::CLASS_RAP_TASK_LI);
+  if (value.empty())
+    BOOST_THROW_EXCEPTION(std::logic_error{ "RAPID value string was empty" });
 
-  for (size_t i = 0; i < node_list.size(); ++i)
-  {
-    std::string name = xmlFindTextContent(node_list.at(i), XMLAttributes::CLASS_NAME);
-    bool is_motion_task =
-        xmlFindTextContent(node_list.at(i), XMLAttributes::CLASS_MOTIONTASK) == SystemConstants::RAPID::RAPID_TRUE;
-    bool is_active = xmlFindTextContent(node_list.at(i), XMLAttributes::CLASS_ACTIVE) == "On";
-    std::string temp = xmlFindTextContent(node_list.at(i), XMLAttributes::CLASS_EXCSTATE);
+  return value;
+}
 
-    // Assume task state is unknown, update based on contents of 'temp'.
-    RAPIDTaskExecutionState execution_state = RAPIDTaskExecutionState::UNKNOWN;
+static std::string generateRAPIDDataPath(const RAPIDResource& resource)
+{
+  return Resources::RW_RAPID_SYMBOL_DATA_RAPID + "/" + resource.task + "/" + resource.module + "/" + resource.name +
+         "/data";
+}
 
-    if (temp == "read")
-    {
-      execution_state = RAPIDTaskExecutionState::READY;
-    }
-    else if (temp == "stop")
-    {
-      execution_state = RAPIDTaskExecutionState::STOPPED;
-    }
-    else if (temp == "star")
+static std::vector<std::size_t> parseRAPIDDimensions(std::string const& dim)
+{
+  std::vector<std::size_t> dimensions;
+
+  std::istringstream ss{ dim };
+  for (std::size_t size; ss >> size;)
+    dimensions.push_back(size);
+
+  return dimensions;
+}
+
+static RAPIDResource makeRAPIDArrayElementResource(const RAPIDResource& resource, std::size_t index)
+{
+  // RAPID array elements are addressed as "name{index}" (URL encoded), with one-based indices.
+  return RAPIDResource{ resource.task, resource.module, resource.name + "%7B" + std::to_string(index + 1) + "%7D" };
+}
+
+static void waitForRAPIDArrayElements(std::vector<std::future<void>>& transfers)
+{
+  std::exception_ptr error;
+
+  for (auto& transfer : transfers)
+  {
+    try
     {
-      execution_state = RAPIDTaskExecutionState::STARTED;
+      transfer.get();
     }
-    else if (temp == "unin")
+    catch (...)
     {
-      execution_state = RAPIDTaskExecutionState::UNINITIALIZED;
+      if (!error)
+        error = std::current_exception();
     }
-
-    result.push_back(RAPIDTaskInfo(name, is_motion_task, is_active, execution_state));
   }
 
+  if (error)
+    std::rethrow_exception(error);
+}
+
+static std::string generateRAPIDPropertiesPath(const RAPIDResource& resource)
+{
+  return Resources::RW_RAPID_SYMBOL_PROPERTIES_RAPID + "/" + resource.task + "/" + resource.module + "/" +
+         resource.name + "/properties";
+}
+
+static std::string generateRAPIDTypePropertiesPath(const std::string& type_url)
+{
+  return Services::RW + "/rapid/symbol/" + type_url + "/properties";
+}
+
+std::vector<RAPIDModuleInfo> getRAPIDModulesInfo(RWSClient& client, const std::string& task)
+{
+  std::vector<RAPIDModuleInfo> result;
+
+  std::string const uri = "/rw/rapid/tasks/" + task + "/modules";
+  std::string name;
+  std::string type;
+
+  client.extractContent(
+      client.httpGet(uri),
+      { XMLAttributes::CLASS_RAP_MODULE_INFO_LI, Identifiers::CLASS, { Identifiers::NAME, Identifiers::TYPE } },
+      [&](std::string const& key, std::string const& text) { (key == Identifiers::NAME ? name : type) = text; },
+      [&](std::string const&) {
+        result.push_back(RAPIDModuleInfo(name, type));
+        name.clear();
+        type.clear();
+      });
+
+  return result;
+}
+
+std::vector<RAPIDTaskInfo> getRAPIDTasks(RWSClient& client)
+{
+  std::vector<RAPIDTaskInfo> result;
+
+  std::map<std::string, std::string> fields;
+
+  client.extractContent(
+      client.httpGet(Resources::RW_RAPID_TASKS),
+      { XMLAttributes::CLASS_RAP_TASK_LI,
+        Identifiers::CLASS,
+        { Identifiers::NAME, Identifiers::MOTIONTASK, Identifiers::ACTIVE, Identifiers::EXCSTATE } },
+      [&](std::string const& key, std::string const& text) { fields[key] = text; },
+      [&](std::string const&) {
+        std::string name = fields[Identifiers::NAME];
+        bool is_motion_task = fields[Identifiers::MOTIONTASK] == SystemConstants::RAPID::RAPID_TRUE;
+        bool is_active = fields[Identifiers::ACTIVE] == "On";
+        std::string temp = fields[Identifiers::EXCSTATE];
+        fields.clear();
+
+        // Assume task state is unknown, update based on contents of 'temp'.
+        RAPIDTaskExecutionState execution_state = RAPIDTaskExecutionState::UNKNOWN;
+
+        if (temp == "read")
+        {
+          execution_state = RAPIDTaskExecutionState::READY;
+        }
+        else if (temp == "stop")
+        {
+          execution_state = RAPIDTaskExecutionState::STOPPED;
+        }
+        else if (temp == "star")
+        {
+          execution_state = RAPIDTaskExecutionState::STARTED;
+        }
+        else if (temp == "unin")
+        {
+          execution_state = RAPIDTaskExecutionState::UNINITIALIZED;
+        }
+
+        result.push_back(RAPIDTaskInfo(name, is_motion_task, is_active, execution_state));
+      });
+
   return result;
 }
 
@@ -226,6 +547,7 @@ void loadModuleIntoTask(RWSClient& client, const std::string& task, const FileRe
   std::string content_type = "application/x-www-form-urlencoded;v=2.0";
 
   client.httpPost(uri.str(), content, content_type);
+  client.rapidSymbolCache().clear();
 }
 
 void unloadModuleFromTask(RWSClient& client, const std::string& task, const std::string& module_name,
@@ -237,6 +559,7 @@ void unloadModuleFromTask(RWSClient& client, const std::string& task, const std:
   std::string content_type = "application/x-www-form-urlencoded;v=2.0";
 
   client.httpPost(uri.str(), content, content_type);
+  client.rapidSymbolCache().clear();
 }
 
 static std::string generateRAPIDTasksPath(const std::string& task)
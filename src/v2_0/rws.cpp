@@ -20,9 +20,11 @@ const std::string Identifiers::CTRL_TYPE                      = "ctrl-type";
 const std::string Identifiers::CTRLEXECSTATE                  = "ctrlexecstate";
 const std::string Identifiers::CTRLSTATE                      = "ctrlstate";
 const std::string Identifiers::DATTYP                         = "dattyp";
+const std::string Identifiers::DIM                            = "dim";
 const std::string Identifiers::EXCSTATE                       = "excstate";
 const std::string Identifiers::IOS_SIGNAL                     = "ios-signal";
 const std::string Identifiers::HOME_DIRECTORY                 = "$home";
+const std::string Identifiers::LINKTYP                        = "linktyp";
 const std::string Identifiers::LVALUE                         = "lvalue";
 const std::string Identifiers::MECHANICAL_UNIT                = "mechanical_unit";
 const std::string Identifiers::MECHANICAL_UNIT_GROUP          = "mechanical_unit_group";
@@ -34,6 +36,7 @@ const std::string Identifiers::NAME                           = "name";
 const std::string Identifiers::OPMODE                         = "opmode";
 const std::string Identifiers::PRESENT_OPTIONS                = "present_options";
 const std::string Identifiers::RAP_MODULE_INFO_LI             = "rap-module-info-li";
+const std::string Identifiers::RAP_SYMPROPRECCOMP_LI          = "rap-sympropreccomp-li";
 const std::string Identifiers::RAP_TASK_LI                    = "rap-task-li";
 const std::string Identifiers::ROBOT                          = "robot";
 const std::string Identifiers::RW_VERSION_NAME                = "rwversionname";
@@ -42,8 +45,10 @@ const std::string Identifiers::STATE                          = "state";
 const std::string Identifiers::SYS                            = "sys";
 const std::string Identifiers::SYS_OPTION_LI                  = "sys-option";
 const std::string Identifiers::SYS_SYSTEM_LI                  = "sys-system";
+const std::string Identifiers::SYMTYP                         = "symtyp";
 const std::string Identifiers::TITLE                          = "title";
 const std::string Identifiers::TYPE                           = "type";
+const std::string Identifiers::TYPURL                         = "typurl";
 const std::string Identifiers::VALUE                          = "value";
 const std::string Identifiers::CLASS                          = "class";
 const std::string Identifiers::OPTION                         = "option";
@@ -76,6 +81,7 @@ const std::string Resources::RW_RAPID_EXECUTION               = Services::RW + "
 const std::string Resources::RW_RAPID_MODULES                 = Services::RW + "/rapid/modules";
 const std::string Resources::RW_RAPID_SYMBOL_DATA_RAPID       = Services::RW + "/rapid/symbol/RAPID";
 const std::string Resources::RW_RAPID_SYMBOL_PROPERTIES_RAPID = Services::RW + "/rapid/symbol/RAPID";  // TODO merge with symbol data
+const std::string Resources::RW_RAPID_SYMBOLS_SEARCH          = Services::RW + "/rapid/symbols/search";
 const std::string Resources::RW_RAPID_TASKS                   = Services::RW + "/rapid/tasks";
 const std::string Resources::RW_SYSTEM                        = Services::RW + "/system";
 // clang-format on
@@ -87,19 +93,24 @@ const XMLAttribute XMLAttributes::CLASS_CTRL_TYPE(Identifiers::CLASS, Identifier
 const XMLAttribute XMLAttributes::CLASS_CTRLEXECSTATE(Identifiers::CLASS, Identifiers::CTRLEXECSTATE);
 const XMLAttribute XMLAttributes::CLASS_CTRLSTATE(Identifiers::CLASS, Identifiers::CTRLSTATE);
 const XMLAttribute XMLAttributes::CLASS_DATTYP(Identifiers::CLASS, Identifiers::DATTYP);
+const XMLAttribute XMLAttributes::CLASS_DIM(Identifiers::CLASS, Identifiers::DIM);
 const XMLAttribute XMLAttributes::CLASS_EXCSTATE(Identifiers::CLASS, Identifiers::EXCSTATE);
 const XMLAttribute XMLAttributes::CLASS_IOS_SIGNAL(Identifiers::CLASS, Identifiers::IOS_SIGNAL);
+const XMLAttribute XMLAttributes::CLASS_LINKTYP(Identifiers::CLASS, Identifiers::LINKTYP);
 const XMLAttribute XMLAttributes::CLASS_LVALUE(Identifiers::CLASS, Identifiers::LVALUE);
 const XMLAttribute XMLAttributes::CLASS_MOTIONTASK(Identifiers::CLASS, Identifiers::MOTIONTASK);
 const XMLAttribute XMLAttributes::CLASS_NAME(Identifiers::CLASS, Identifiers::NAME);
 const XMLAttribute XMLAttributes::CLASS_OPMODE(Identifiers::CLASS, Identifiers::OPMODE);
 const XMLAttribute XMLAttributes::CLASS_RAP_MODULE_INFO_LI(Identifiers::CLASS, Identifiers::RAP_MODULE_INFO_LI);
+const XMLAttribute XMLAttributes::CLASS_RAP_SYMPROPRECCOMP_LI(Identifiers::CLASS, Identifiers::RAP_SYMPROPRECCOMP_LI);
 const XMLAttribute XMLAttributes::CLASS_RAP_TASK_LI(Identifiers::CLASS, Identifiers::RAP_TASK_LI);
 const XMLAttribute XMLAttributes::CLASS_RW_VERSION_NAME(Identifiers::CLASS, Identifiers::RW_VERSION_NAME);
 const XMLAttribute XMLAttributes::CLASS_STATE(Identifiers::CLASS, Identifiers::STATE);
 const XMLAttribute XMLAttributes::CLASS_SYS_OPTION_LI(Identifiers::CLASS, Identifiers::SYS_OPTION_LI);
 const XMLAttribute XMLAttributes::CLASS_SYS_SYSTEM_LI(Identifiers::CLASS, Identifiers::SYS_SYSTEM_LI);
+const XMLAttribute XMLAttributes::CLASS_SYMTYP(Identifiers::CLASS, Identifiers::SYMTYP);
 const XMLAttribute XMLAttributes::CLASS_TYPE(Identifiers::CLASS, Identifiers::TYPE);
+const XMLAttribute XMLAttributes::CLASS_TYPURL(Identifiers::CLASS, Identifiers::TYPURL);
 const XMLAttribute XMLAttributes::CLASS_VALUE(Identifiers::CLASS, Identifiers::VALUE);
 const XMLAttribute XMLAttributes::CLASS_OPTION(Identifiers::CLASS, Identifiers::OPTION);
 
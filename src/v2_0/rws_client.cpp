@@ -41,6 +41,7 @@
 
 #include <Poco/Net/HTTPRequest.h>
 
+#include <memory>
 #include <sstream>
 #include <stdexcept>
 
@@ -63,15 +64,24 @@ using namespace Poco::Net;
  * Primary methods
  */
 
-RWSClient::RWSClient(ConnectionOptions const& connection_options)
+RWSClient::RWSClient(ConnectionOptions const& connection_options, std::shared_ptr<Executor> executor)
   : connectionOptions_{ connection_options }
-  , context_{ new Poco::Net::Context{ Poco::Net::Context::CLIENT_USE, "", "", "", Poco::Net::Context::VERIFY_NONE, 9,
-                                      false, "ALL:!ADH:!LOW:!EXP:!MD5:@STRENGTH" } }
-  , session_{ connectionOptions_.ip_address, connectionOptions_.port, context_ }
-  , http_client_{ session_, connectionOptions_.username, connectionOptions_.password }
+  , tls_sessions_{ connectionOptions_.cipher_list }
+  , http_client_{
+    [this]() -> std::unique_ptr<Poco::Net::HTTPClientSession> {
+      auto session = tls_sessions_.createSession(connectionOptions_.ip_address, connectionOptions_.port);
+      session->setTimeout(connectionOptions_.connection_timeout.count(), connectionOptions_.send_timeout.count(),
+                          connectionOptions_.receive_timeout.count());
+      return session;
+    },
+    connectionOptions_.username, connectionOptions_.password, connectionOptions_.session_pool_size,
+    connectionOptions_.session_metrics
+  }
+  , executor_{ executor ? std::move(executor) :
+                          std::make_shared<ThreadPoolExecutor>(connectionOptions_.session_pool_size) }
 {
-  session_.setTimeout(connectionOptions_.connection_timeout.count(), connectionOptions_.send_timeout.count(),
-                      connectionOptions_.receive_timeout.count());
+  http_client_.setLogMode(connectionOptions_.log_mode, connectionOptions_.log_content_limit);
+  http_client_.metrics().setEnabled(connectionOptions_.request_metrics);
 
   // // Make a request to the server to check connection and initiate authentification.
   // try
@@ -90,6 +100,9 @@ RWSClient::RWSClient(ConnectionOptions const& connection_options)
 
 RWSClient::~RWSClient()
 {
+  // The asynchronous requests refer to this object, also when they are run by a shared executor.
+  executor_.wait();
+
   try
   {
     logout();
@@ -113,6 +126,15 @@ RWSClient::RWSResult RWSClient::getConfigurationInstances(const std::string& top
   return parseContent(httpGet(uri));
 }
 
+void RWSClient::getConfigurationInstances(const std::string& topic, const std::string& type,
+                                          XMLFieldCallback const& on_attribute, XMLRecordCallback const& on_instance)
+{
+  std::string uri = generateConfigurationPath(topic, type) + Resources::INSTANCES;
+  extractContent(httpGet(uri),
+                 { XMLAttributes::CLASS_CFG_DT_INSTANCE_LI, Identifiers::TITLE, {}, XMLAttributes::CLASS_CFG_IA_T_LI },
+                 on_attribute, on_instance);
+}
+
 RWSClient::RWSResult RWSClient::getIOSignals()
 {
   std::string const& uri = Resources::RW_IOSYSTEM_SIGNALS;
@@ -276,7 +298,29 @@ void RWSClient::registerRemoteUser(const std::string& username, const std::strin
 
 RWSClient::RWSResult RWSClient::parseContent(const POCOResult& poco_result)
 {
-  return parser_.parseString(poco_result.content());
+  RequestMetrics& metrics = http_client_.metrics();
+
+  if (!metrics.enabled())
+    return parseXml(poco_result.content());
+
+  auto const start = RequestMetrics::Clock::now();
+  RWSResult result = parseXml(poco_result.content());
+  metrics.recordParse(poco_result.method(), poco_result.uri(), RequestMetrics::Clock::now() - start);
+
+  return result;
+}
+
+void RWSClient::extractContent(const POCOResult& poco_result, XMLExtractQuery const& query,
+                               XMLFieldCallback const& on_field, XMLRecordCallback const& on_record)
+{
+  RequestMetrics& metrics = http_client_.metrics();
+
+  if (!metrics.enabled())
+    return xmlExtract(poco_result.content(), query, on_field, on_record);
+
+  auto const start = RequestMetrics::Clock::now();
+  xmlExtract(poco_result.content(), query, on_field, on_record);
+  metrics.recordParse(poco_result.method(), poco_result.uri(), RequestMetrics::Clock::now() - start);
 }
 
 std::string RWSClient::generateConfigurationPath(const std::string& topic, const std::string& type)
@@ -366,6 +410,43 @@ POCOResult RWSClient::httpDelete(const std::string& uri)
   return result;
 }
 
+std::future<POCOResult> RWSClient::httpGetAsync(const std::string& uri)
+{
+  return submit(executor_, [this, uri] { return httpGet(uri); });
+}
+
+void RWSClient::httpGetAsync(const std::string& uri, Completion<POCOResult> completion)
+{
+  submit(executor_, [this, uri] { return httpGet(uri); }, std::move(completion));
+}
+
+std::future<POCOResult> RWSClient::httpPostAsync(const std::string& uri, const std::string& content,
+                                                 const std::string& content_type)
+{
+  return submit(executor_, [this, uri, content, content_type] { return httpPost(uri, content, content_type); });
+}
+
+std::future<POCOResult> RWSClient::httpPutAsync(const std::string& uri, const std::string& content,
+                                                const std::string& content_type)
+{
+  return submit(executor_, [this, uri, content, content_type] { return httpPut(uri, content, content_type); });
+}
+
+std::future<POCOResult> RWSClient::httpDeleteAsync(const std::string& uri)
+{
+  return submit(executor_, [this, uri] { return httpDelete(uri); });
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getIOSignalAsync(const std::string& iosignal)
+{
+  return submit(executor_, [this, iosignal] { return getIOSignal(iosignal); });
+}
+
+void RWSClient::getIOSignalAsync(const std::string& iosignal, Completion<RWSResult> completion)
+{
+  submit(executor_, [this, iosignal] { return getIOSignal(iosignal); }, std::move(completion));
+}
+
 std::string RWSClient::openSubscription(std::vector<std::pair<std::string, SubscriptionPriority>> const& resources)
 {
   // Generate content for a subscription HTTP post request.
@@ -420,9 +501,9 @@ void RWSClient::closeSubscription(std::string const& subscription_group_id)
 
 Poco::Net::WebSocket RWSClient::receiveSubscription(std::string const& subscription_group_id)
 {
-  return http_client_.webSocketConnect(
-      "/poll/" + subscription_group_id, "rws_subscription",
-      Poco::Net::HTTPSClientSession{ connectionOptions_.ip_address, connectionOptions_.port, context_ });
+  // Connect over a session sharing the SSL context, so that the TLS session of the HTTP connections is resumed.
+  auto session = tls_sessions_.createSession(connectionOptions_.ip_address, connectionOptions_.port);
+  return http_client_.webSocketConnect("/poll/" + subscription_group_id, "rws_subscription", std::move(*session));
 }
 
 std::string RWSClient::getResourceURI(IOSignalResource const& io_signal) const
@@ -466,11 +547,11 @@ std::string RWSClient::getResourceURI(OperationModeResource const&) const
 
 void RWSClient::processEvent(Poco::AutoPtr<Poco::XML::Document> doc, SubscriptionCallback& callback) const
 {
-  // IMPORTANT: don't use AutoPtr<XML::Node> here! Otherwise you will get memory corruption.
-  Poco::XML::Node const* li_node = doc->getNodeByPath("html/body/div/ul/li");
-  if (!li_node)
-    BOOST_THROW_EXCEPTION(ProtocolError{ "Cannot parse RWS event message: can't find XML path html/body/div/ul/li" });
+  processEventMessage(doc, &RWSClient::parseEvent, callback);
+}
 
+SubscriptionEvent RWSClient::parseEvent(Poco::XML::Node const* li_node)
+{
   auto const* a_node = li_node->getNodeByPath("a");
   if (!a_node)
     BOOST_THROW_EXCEPTION(ProtocolError{ "Cannot parse RWS event message: can't find XML path html/body/div/ul/li/a" });
@@ -491,7 +572,7 @@ void RWSClient::processEvent(Poco::AutoPtr<Poco::XML::Document> doc, Subscriptio
 
     event.signal = uri.substr(prefix.length(), uri.find(";") - prefix.length());
     event.value = xmlFindTextContent(li_node, XMLAttribute{ "class", "lvalue" });
-    callback.processEvent(event);
+    return event;
   }
   else if (class_attribute_value == "rap-ctrlexecstate-ev")
   {
@@ -500,7 +581,25 @@ void RWSClient::processEvent(Poco::AutoPtr<Poco::XML::Document> doc, Subscriptio
     std::string const state_string = xmlFindTextContent(li_node, XMLAttribute{ "class", "ctrlexecstate" });
     event.state = rw::makeRAPIDExecutionState(state_string);
 
-    callback.processEvent(event);
+    return event;
+  }
+  else if (class_attribute_value == "pnl-ctrlstate-ev")
+  {
+    ControllerStateEvent event;
+    event.state = rw::makeControllerState(xmlFindTextContent(li_node, XMLAttribute{ "class", "ctrlstate" }));
+    return event;
+  }
+  else if (class_attribute_value == "pnl-opmode-ev")
+  {
+    OperationModeEvent event;
+    event.mode = rw::makeOperationMode(xmlFindTextContent(li_node, XMLAttribute{ "class", "opmode" }));
+    return event;
+  }
+  else if (class_attribute_value == "rap-value-ev")
+  {
+    RAPIDSymbolValueEvent event = parseRAPIDSymbolValueEventURI(uri);
+    event.value = xmlFindTextContent(li_node, XMLAttribute{ "class", "value" });
+    return event;
   }
   else
     BOOST_THROW_EXCEPTION(
@@ -78,45 +78,36 @@ RWSInterface::RWSInterface(RWSClient& client) : rws_client_{ client }
 std::vector<cfg::moc::Arm> RWSInterface::getCFGArms()
 {
   std::vector<cfg::moc::Arm> result;
-
-  RWSResult rws_result = rws_client_.getConfigurationInstances(Identifiers::MOC, Identifiers::ARM);
-
-  std::vector<Poco::XML::Node*> instances;
-  instances = xmlFindNodes(rws_result, XMLAttributes::CLASS_CFG_DT_INSTANCE_LI);
-
-  for (size_t i = 0; i < instances.size(); ++i)
-  {
-    std::vector<Poco::XML::Node*> attributes = xmlFindNodes(instances[i], XMLAttributes::CLASS_CFG_IA_T_LI);
-
-    cfg::moc::Arm arm;
-
-    for (size_t j = 0; j < attributes.size(); ++j)
-    {
-      Poco::XML::Node* attribute = attributes[j];
-      if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, Identifiers::NAME))
-      {
-        arm.name = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-        if (arm.name.empty())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "lower_joint_bound"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> arm.lower_joint_bound;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "upper_joint_bound"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> arm.upper_joint_bound;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-    }
-
-    result.push_back(arm);
-  }
+  cfg::moc::Arm arm;
+
+  rws_client_.getConfigurationInstances(
+      Identifiers::MOC, Identifiers::ARM,
+      [&](std::string const& attribute, std::string const& value) {
+        if (attribute == Identifiers::NAME)
+        {
+          arm.name = value;
+          if (arm.name.empty())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+        else if (attribute == "lower_joint_bound")
+        {
+          std::stringstream ss(value);
+          ss >> arm.lower_joint_bound;
+          if (ss.fail())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+        else if (attribute == "upper_joint_bound")
+        {
+          std::stringstream ss(value);
+          ss >> arm.upper_joint_bound;
+          if (ss.fail())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+      },
+      [&](std::string const&) {
+        result.push_back(arm);
+        arm = cfg::moc::Arm();
+      });
 
   return result;
 }
@@ -124,57 +115,48 @@ std::vector<cfg::moc::Arm> RWSInterface::getCFGArms()
 std::vector<cfg::moc::Joint> RWSInterface::getCFGJoints()
 {
   std::vector<cfg::moc::Joint> result;
-
-  RWSResult rws_result = rws_client_.getConfigurationInstances("MOC", "JOINT");
-
-  std::vector<Poco::XML::Node*> instances;
-  instances = xmlFindNodes(rws_result, XMLAttributes::CLASS_CFG_DT_INSTANCE_LI);
-
-  for (size_t i = 0; i < instances.size(); ++i)
-  {
-    std::vector<Poco::XML::Node*> attributes = xmlFindNodes(instances[i], XMLAttributes::CLASS_CFG_IA_T_LI);
-
-    cfg::moc::Joint joint;
-
-    for (size_t j = 0; j < attributes.size(); ++j)
-    {
-      Poco::XML::Node* attribute = attributes[j];
-      if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, Identifiers::NAME))
-      {
-        joint.name = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-        if (joint.name.empty())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "logical_axis"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> joint.logical_axis;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "kinematic_axis_number"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> joint.kinematic_axis_number;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_arm"))
-      {
-        joint.use_arm = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-        if (joint.use_arm.empty())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_transmission"))
-      {
-        joint.use_transmission = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-        if (joint.use_transmission.empty())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-    }
-
-    result.push_back(joint);
-  }
+  cfg::moc::Joint joint;
+
+  rws_client_.getConfigurationInstances(
+      "MOC", "JOINT",
+      [&](std::string const& attribute, std::string const& value) {
+        if (attribute == Identifiers::NAME)
+        {
+          joint.name = value;
+          if (joint.name.empty())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+        else if (attribute == "logical_axis")
+        {
+          std::stringstream ss(value);
+          ss >> joint.logical_axis;
+          if (ss.fail())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+        else if (attribute == "kinematic_axis_number")
+        {
+          std::stringstream ss(value);
+          ss >> joint.kinematic_axis_number;
+          if (ss.fail())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+        else if (attribute == "use_arm")
+        {
+          joint.use_arm = value;
+          if (joint.use_arm.empty())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+        else if (attribute == "use_transmission")
+        {
+          joint.use_transmission = value;
+          if (joint.use_transmission.empty())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+      },
+      [&](std::string const&) {
+        result.push_back(joint);
+        joint = cfg::moc::Joint();
+      });
 
   return result;
 }
@@ -182,46 +164,33 @@ std::vector<cfg::moc::Joint> RWSInterface::getCFGJoints()
 std::vector<cfg::moc::MechanicalUnit> RWSInterface::getCFGMechanicalUnits()
 {
   std::vector<cfg::moc::MechanicalUnit> result;
-
-  RWSResult rws_result = rws_client_.getConfigurationInstances(Identifiers::MOC, Identifiers::MECHANICAL_UNIT);
-
-  std::vector<Poco::XML::Node*> instances;
-  instances = xmlFindNodes(rws_result, XMLAttributes::CLASS_CFG_DT_INSTANCE_LI);
-
-  for (size_t i = 0; i < instances.size(); ++i)
-  {
-    std::vector<Poco::XML::Node*> attributes = xmlFindNodes(instances[i], XMLAttributes::CLASS_CFG_IA_T_LI);
-
-    cfg::moc::MechanicalUnit mechanical_unit;
-
-    for (size_t j = 0; j < attributes.size(); ++j)
-    {
-      Poco::XML::Node* attribute = attributes[j];
-      if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, Identifiers::NAME))
-      {
-        mechanical_unit.name = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-        if (mechanical_unit.name.empty())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_robot"))
-      {
-        // Note: The 'use_robot' attribute can be empty, since not all units have a robot (i.e. skip validation).
-        mechanical_unit.use_robot = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_single_0") ||
-               xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_single_1") ||
-               xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_single_2") ||
-               xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_single_3") ||
-               xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_single_4") ||
-               xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_single_5"))
-      {
-        // Note: The 'use_single_N' attribute can be empty, since not all units have singles (i.e. skip validation).
-        mechanical_unit.use_singles.push_back(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-      }
-    }
-
-    result.push_back(mechanical_unit);
-  }
+  cfg::moc::MechanicalUnit mechanical_unit;
+
+  rws_client_.getConfigurationInstances(
+      Identifiers::MOC, Identifiers::MECHANICAL_UNIT,
+      [&](std::string const& attribute, std::string const& value) {
+        if (attribute == Identifiers::NAME)
+        {
+          mechanical_unit.name = value;
+          if (mechanical_unit.name.empty())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+        else if (attribute == "use_robot")
+        {
+          // Note: The 'use_robot' attribute can be empty, since not all units have a robot (i.e. skip validation).
+          mechanical_unit.use_robot = value;
+        }
+        else if (attribute == "use_single_0" || attribute == "use_single_1" || attribute == "use_single_2" ||
+                 attribute == "use_single_3" || attribute == "use_single_4" || attribute == "use_single_5")
+        {
+          // Note: The 'use_single_N' attribute can be empty, since not all units have singles (i.e. skip validation).
+          mechanical_unit.use_singles.push_back(value);
+        }
+      },
+      [&](std::string const&) {
+        result.push_back(mechanical_unit);
+        mechanical_unit = cfg::moc::MechanicalUnit();
+      });
 
   return result;
 }
@@ -229,46 +198,35 @@ std::vector<cfg::moc::MechanicalUnit> RWSInterface::getCFGMechanicalUnits()
 std::vector<cfg::sys::MechanicalUnitGroup> RWSInterface::getCFGMechanicalUnitGroups()
 {
   std::vector<cfg::sys::MechanicalUnitGroup> result;
-
-  RWSResult rws_result = rws_client_.getConfigurationInstances(Identifiers::SYS, Identifiers::MECHANICAL_UNIT_GROUP);
-
-  std::vector<Poco::XML::Node*> instances;
-  instances = xmlFindNodes(rws_result, XMLAttributes::CLASS_CFG_DT_INSTANCE_LI);
-
-  for (size_t i = 0; i < instances.size(); ++i)
-  {
-    std::vector<Poco::XML::Node*> attributes = xmlFindNodes(instances[i], XMLAttributes::CLASS_CFG_IA_T_LI);
-
-    cfg::sys::MechanicalUnitGroup mechanical_unit_group;
-
-    for (size_t j = 0; j < attributes.size(); ++j)
-    {
-      Poco::XML::Node* attribute = attributes[j];
-      if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "Name"))
-      {
-        mechanical_unit_group.name = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-        if (mechanical_unit_group.name.empty())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "Robot"))
-      {
-        // Note: The 'Robot' attribute can be empty, since not all groups have a robot (i.e. skip validation).
-        mechanical_unit_group.robot = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "MechanicalUnit_1") ||
-               xmlNodeHasAttribute(attribute, Identifiers::TITLE, "MechanicalUnit_2") ||
-               xmlNodeHasAttribute(attribute, Identifiers::TITLE, "MechanicalUnit_3") ||
-               xmlNodeHasAttribute(attribute, Identifiers::TITLE, "MechanicalUnit_4") ||
-               xmlNodeHasAttribute(attribute, Identifiers::TITLE, "MechanicalUnit_5") ||
-               xmlNodeHasAttribute(attribute, Identifiers::TITLE, "MechanicalUnit_6"))
-      {
-        // Note: The 'MechanicalUnit_N' attribute can be empty, since not all groups have units (i.e. skip validation).
-        mechanical_unit_group.mechanical_units.push_back(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-      }
-    }
-
-    result.push_back(mechanical_unit_group);
-  }
+  cfg::sys::MechanicalUnitGroup mechanical_unit_group;
+
+  rws_client_.getConfigurationInstances(
+      Identifiers::SYS, Identifiers::MECHANICAL_UNIT_GROUP,
+      [&](std::string const& attribute, std::string const& value) {
+        if (attribute == "Name")
+        {
+          mechanical_unit_group.name = value;
+          if (mechanical_unit_group.name.empty())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+        else if (attribute == "Robot")
+        {
+          // Note: The 'Robot' attribute can be empty, since not all groups have a robot (i.e. skip validation).
+          mechanical_unit_group.robot = value;
+        }
+        else if (attribute == "MechanicalUnit_1" || attribute == "MechanicalUnit_2" ||
+                 attribute == "MechanicalUnit_3" || attribute == "MechanicalUnit_4" ||
+                 attribute == "MechanicalUnit_5" || attribute == "MechanicalUnit_6")
+        {
+          // Note: The 'MechanicalUnit_N' attribute can be empty, since not all groups have units
+          //       (i.e. skip validation).
+          mechanical_unit_group.mechanical_units.push_back(value);
+        }
+      },
+      [&](std::string const&) {
+        result.push_back(mechanical_unit_group);
+        mechanical_unit_group = cfg::sys::MechanicalUnitGroup();
+      });
 
   return result;
 }
@@ -276,143 +234,123 @@ std::vector<cfg::sys::MechanicalUnitGroup> RWSInterface::getCFGMechanicalUnitGro
 std::vector<cfg::sys::PresentOption> RWSInterface::getCFGPresentOptions()
 {
   std::vector<cfg::sys::PresentOption> result;
+  cfg::sys::PresentOption present_option;
+
+  rws_client_.getConfigurationInstances(
+      Identifiers::SYS, Identifiers::PRESENT_OPTIONS,
+      [&](std::string const& attribute, std::string const& value) {
+        if (attribute == "name")
+        {
+          present_option.name = value;
+          if (present_option.name.empty())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+        else if (attribute == "desc")
+        {
+          present_option.description = value;
+          if (present_option.description.empty())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+      },
+      [&](std::string const&) {
+        result.push_back(present_option);
+        present_option = cfg::sys::PresentOption();
+      });
 
-  RWSResult rws_result = rws_client_.getConfigurationInstances(Identifiers::SYS, Identifiers::PRESENT_OPTIONS);
+  return result;
+}
 
-  std::vector<Poco::XML::Node*> instances;
-  instances = xmlFindNodes(rws_result, XMLAttributes::CLASS_CFG_DT_INSTANCE_LI);
+/**
+ * \brief Parses a base frame attribute of a robot or single configuration instance.
+ *
+ * \param attribute name of the configuration attribute.
+ * \param value of the configuration attribute.
+ * \param base_frame to update. Positions are converted from [m] to [mm].
+ *
+ * \return true if \a attribute is a base frame attribute.
+ *
+ * \throw \a std::runtime_error if the value cannot be parsed.
+ */
+static bool parseCFGBaseFrame(std::string const& attribute, std::string const& value, Pose& base_frame)
+{
+  float* field = nullptr;
+  float scale = 1.0f;
 
-  for (size_t i = 0; i < instances.size(); ++i)
+  if (attribute == "base_frame_pos_x")
   {
-    std::vector<Poco::XML::Node*> attributes = xmlFindNodes(instances[i], XMLAttributes::CLASS_CFG_IA_T_LI);
-
-    cfg::sys::PresentOption present_option;
-
-    for (size_t j = 0; j < attributes.size(); ++j)
-    {
-      Poco::XML::Node* attribute = attributes[j];
-      if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "name"))
-      {
-        present_option.name = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-        if (present_option.name.empty())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "desc"))
-      {
-        present_option.description = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-        if (present_option.description.empty())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-    }
-
-    result.push_back(present_option);
+    field = &base_frame.pos.x.value;
+    scale = 1e3f;
   }
-
-  return result;
+  else if (attribute == "base_frame_pos_y")
+  {
+    field = &base_frame.pos.y.value;
+    scale = 1e3f;
+  }
+  else if (attribute == "base_frame_pos_z")
+  {
+    field = &base_frame.pos.z.value;
+    scale = 1e3f;
+  }
+  else if (attribute == "base_frame_orient_u0")
+    field = &base_frame.rot.q1.value;
+  else if (attribute == "base_frame_orient_u1")
+    field = &base_frame.rot.q2.value;
+  else if (attribute == "base_frame_orient_u2")
+    field = &base_frame.rot.q3.value;
+  else if (attribute == "base_frame_orient_u3")
+    field = &base_frame.rot.q4.value;
+  else
+    return false;
+
+  std::stringstream ss(value);
+  ss >> *field;
+  if (ss.fail())
+    throw std::runtime_error(EXCEPTION_PARSE_CFG);
+  *field *= scale;
+
+  return true;
 }
 
 std::vector<cfg::moc::Robot> RWSInterface::getCFGRobots()
 {
   std::vector<cfg::moc::Robot> result;
-
-  RWSResult rws_result = rws_client_.getConfigurationInstances(Identifiers::MOC, Identifiers::ROBOT);
-
-  std::vector<Poco::XML::Node*> instances;
-  instances = xmlFindNodes(rws_result, XMLAttributes::CLASS_CFG_DT_INSTANCE_LI);
-
-  for (size_t i = 0; i < instances.size(); ++i)
-  {
-    std::vector<Poco::XML::Node*> attributes = xmlFindNodes(instances[i], XMLAttributes::CLASS_CFG_IA_T_LI);
-
-    cfg::moc::Robot robot;
-
-    for (size_t j = 0; j < attributes.size(); ++j)
-    {
-      Poco::XML::Node* attribute = attributes[j];
-      if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, Identifiers::NAME))
-      {
-        robot.name = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-        if (robot.name.empty())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_robot_type"))
-      {
-        robot.use_robot_type = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-        if (robot.use_robot_type.empty())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_joint_0") ||
-               xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_joint_1") ||
-               xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_joint_2") ||
-               xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_joint_3") ||
-               xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_joint_4") ||
-               xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_joint_5"))
-      {
-        // Note: The 'use_joint_N' attribute can be empty, since not all robots have 6 joints (i.e. skip validation).
-        robot.use_joints.push_back(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "base_frame_pos_x"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> robot.base_frame.pos.x.value;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-        robot.base_frame.pos.x.value *= 1e3;
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "base_frame_pos_y"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> robot.base_frame.pos.y.value;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-        robot.base_frame.pos.y.value *= 1e3;
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "base_frame_pos_z"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> robot.base_frame.pos.z.value;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-        robot.base_frame.pos.z.value *= 1e3;
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "base_frame_orient_u0"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> robot.base_frame.rot.q1.value;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "base_frame_orient_u1"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> robot.base_frame.rot.q2.value;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "base_frame_orient_u2"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> robot.base_frame.rot.q3.value;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "base_frame_orient_u3"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> robot.base_frame.rot.q4.value;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "base_frame_coordinated"))
-      {
-        // Note: The 'base_frame_coordinated' attribute can be empty (i.e. skip validation).
-        //       It is only used if this robot's base frame is moved by another robot or single.
-        robot.base_frame_moved_by = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-      }
-    }
-
-    result.push_back(robot);
-  }
+  cfg::moc::Robot robot;
+
+  rws_client_.getConfigurationInstances(
+      Identifiers::MOC, Identifiers::ROBOT,
+      [&](std::string const& attribute, std::string const& value) {
+        if (parseCFGBaseFrame(attribute, value, robot.base_frame))
+          return;
+
+        if (attribute == Identifiers::NAME)
+        {
+          robot.name = value;
+          if (robot.name.empty())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+        else if (attribute == "use_robot_type")
+        {
+          robot.use_robot_type = value;
+          if (robot.use_robot_type.empty())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+        else if (attribute == "use_joint_0" || attribute == "use_joint_1" || attribute == "use_joint_2" ||
+                 attribute == "use_joint_3" || attribute == "use_joint_4" || attribute == "use_joint_5")
+        {
+          // Note: The 'use_joint_N' attribute can be empty, since not all robots have 6 joints (i.e. skip validation).
+          robot.use_joints.push_back(value);
+        }
+        else if (attribute == "base_frame_coordinated")
+        {
+          // Note: The 'base_frame_coordinated' attribute can be empty (i.e. skip validation).
+          //       It is only used if this robot's base frame is moved by another robot or single.
+          robot.base_frame_moved_by = value;
+        }
+      },
+      [&](std::string const&) {
+        result.push_back(robot);
+        robot = cfg::moc::Robot();
+      });
 
   return result;
 }
@@ -420,101 +358,43 @@ std::vector<cfg::moc::Robot> RWSInterface::getCFGRobots()
 std::vector<cfg::moc::Single> RWSInterface::getCFGSingles()
 {
   std::vector<cfg::moc::Single> result;
-
-  RWSResult rws_result = rws_client_.getConfigurationInstances(Identifiers::MOC, Identifiers::SINGLE);
-
-  std::vector<Poco::XML::Node*> instances;
-  instances = xmlFindNodes(rws_result, XMLAttributes::CLASS_CFG_DT_INSTANCE_LI);
-
-  for (size_t i = 0; i < instances.size(); ++i)
-  {
-    std::vector<Poco::XML::Node*> attributes = xmlFindNodes(instances[i], XMLAttributes::CLASS_CFG_IA_T_LI);
-
-    cfg::moc::Single single;
-
-    for (size_t j = 0; j < attributes.size(); ++j)
-    {
-      Poco::XML::Node* attribute = attributes[j];
-      if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, Identifiers::NAME))
-      {
-        single.name = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-        if (single.name.empty())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_single_type"))
-      {
-        single.use_single_type = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-        if (single.use_single_type.empty())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "use_joint"))
-      {
-        single.use_joint = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-        if (single.use_joint.empty())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "base_frame_pos_x"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> single.base_frame.pos.x.value;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-        single.base_frame.pos.x.value *= 1e3;
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "base_frame_pos_y"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> single.base_frame.pos.y.value;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-        single.base_frame.pos.y.value *= 1e3;
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "base_frame_pos_z"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> single.base_frame.pos.z.value;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-        single.base_frame.pos.z.value *= 1e3;
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "base_frame_orient_u0"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> single.base_frame.rot.q1.value;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "base_frame_orient_u1"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> single.base_frame.rot.q2.value;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "base_frame_orient_u2"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> single.base_frame.rot.q3.value;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "base_frame_orient_u3"))
-      {
-        std::stringstream ss(xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE));
-        ss >> single.base_frame.rot.q4.value;
-        if (ss.fail())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-      }
-      else if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "base_frame_coordinated"))
-      {
-        // Note: The 'base_frame_coordinated' attribute can be empty (i.e. skip validation).
-        //       It is only used if this single's base frame is moved by another robot or single.
-        single.base_frame_coordinated = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-      }
-    }
-
-    result.push_back(single);
-  }
+  cfg::moc::Single single;
+
+  rws_client_.getConfigurationInstances(
+      Identifiers::MOC, Identifiers::SINGLE,
+      [&](std::string const& attribute, std::string const& value) {
+        if (parseCFGBaseFrame(attribute, value, single.base_frame))
+          return;
+
+        if (attribute == Identifiers::NAME)
+        {
+          single.name = value;
+          if (single.name.empty())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+        else if (attribute == "use_single_type")
+        {
+          single.use_single_type = value;
+          if (single.use_single_type.empty())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+        else if (attribute == "use_joint")
+        {
+          single.use_joint = value;
+          if (single.use_joint.empty())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+        }
+        else if (attribute == "base_frame_coordinated")
+        {
+          // Note: The 'base_frame_coordinated' attribute can be empty (i.e. skip validation).
+          //       It is only used if this single's base frame is moved by another robot or single.
+          single.base_frame_coordinated = value;
+        }
+      },
+      [&](std::string const&) {
+        result.push_back(single);
+        single = cfg::moc::Single();
+      });
 
   return result;
 }
@@ -522,36 +402,26 @@ std::vector<cfg::moc::Single> RWSInterface::getCFGSingles()
 std::vector<cfg::moc::Transmission> RWSInterface::getCFGTransmission()
 {
   std::vector<cfg::moc::Transmission> result;
-
-  RWSResult rws_result = rws_client_.getConfigurationInstances("MOC", "TRANSMISSION");
-
-  std::vector<Poco::XML::Node*> instances;
-  instances = xmlFindNodes(rws_result, XMLAttributes::CLASS_CFG_DT_INSTANCE_LI);
-
-  for (size_t i = 0; i < instances.size(); ++i)
-  {
-    std::vector<Poco::XML::Node*> attributes = xmlFindNodes(instances[i], XMLAttributes::CLASS_CFG_IA_T_LI);
-
-    cfg::moc::Transmission transmission;
-
-    transmission.name = xmlNodeGetAttributeValue(instances[i], Identifiers::TITLE);
-    if (transmission.name.empty())
-      throw std::runtime_error(EXCEPTION_PARSE_CFG);
-
-    for (size_t j = 0; j < attributes.size(); ++j)
-    {
-      Poco::XML::Node* attribute = attributes[j];
-      if (xmlNodeHasAttribute(attribute, Identifiers::TITLE, "rotating_move"))
-      {
-        std::string temp = xmlFindTextContent(attribute, XMLAttributes::CLASS_VALUE);
-        if (temp.empty())
-          throw std::runtime_error(EXCEPTION_PARSE_CFG);
-        transmission.rotating_move = (temp == "true");
-      }
-    }
-
-    result.push_back(transmission);
-  }
+  cfg::moc::Transmission transmission;
+
+  rws_client_.getConfigurationInstances(
+      "MOC", "TRANSMISSION",
+      [&](std::string const& attribute, std::string const& value) {
+        if (attribute == "rotating_move")
+        {
+          if (value.empty())
+            throw std::runtime_error(EXCEPTION_PARSE_CFG);
+          transmission.rotating_move = (value == "true");
+        }
+      },
+      [&](std::string const& instance) {
+        transmission.name = instance;
+        if (transmission.name.empty())
+          throw std::runtime_error(EXCEPTION_PARSE_CFG);
+
+        result.push_back(transmission);
+        transmission = cfg::moc::Transmission();
+      });
 
   return result;
 }
@@ -559,17 +429,18 @@ std::vector<cfg::moc::Transmission> RWSInterface::getCFGTransmission()
 std::vector<RobotWareOptionInfo> RWSInterface::getPresentRobotWareOptions()
 {
   std::vector<RobotWareOptionInfo> result;
+  std::vector<std::string> values;
 
-  RWSResult rws_result = rws_client_.getConfigurationInstances(Identifiers::SYS, Identifiers::PRESENT_OPTIONS);
+  rws_client_.getConfigurationInstances(
+      Identifiers::SYS, Identifiers::PRESENT_OPTIONS,
+      [&](std::string const&, std::string const& value) { values.push_back(value); },
+      [&](std::string const&) {});
 
-  std::vector<Poco::XML::Node*> node_list = xmlFindNodes(rws_result, XMLAttributes::CLASS_CFG_IA_T_LI);
-
-  for (size_t i = 0; i < node_list.size(); i += 2)
+  for (size_t i = 0; i < values.size(); i += 2)
   {
-    if (i + 1 < node_list.size())
+    if (i + 1 < values.size())
     {
-      result.push_back(RobotWareOptionInfo(xmlFindTextContent(node_list.at(i), XMLAttributes::CLASS_VALUE),
-                                           xmlFindTextContent(node_list.at(i + 1), XMLAttributes::CLASS_VALUE)));
+      result.push_back(RobotWareOptionInfo(values.at(i), values.at(i + 1)));
     }
   }
 
@@ -579,18 +450,28 @@ std::vector<RobotWareOptionInfo> RWSInterface::getPresentRobotWareOptions()
 std::string RWSInterface::getIOSignal(const std::string& iosignal)
 {
   RWSResult rws_result = rws_client_.getIOSignal(iosignal);
-  return xmlFindTextContent(rws_result, XMLAttributes::CLASS_LVALUE);
+  std::string value = xmlFindTextContent(rws_result, XMLAttributes::CLASS_LVALUE);
+  write_suppression_cache_.observe(IOSignalResource{ iosignal }, value);
+
+  return value;
 }
 
 MechanicalUnitStaticInfo RWSInterface::getMechanicalUnitStaticInfo(const std::string& mechunit)
 {
   RWSResult rws_result = rws_client_.getMechanicalUnitStaticInfo(mechunit);
 
+  static XMLTextContentQuery const query{
+    XMLAttribute("class", "task-name"), XMLAttribute("class", "is-integrated-unit"),
+    XMLAttribute("class", "has-integrated-unit"), XMLAttribute("class", "type"),
+    XMLAttribute("class", "axes"), XMLAttribute("class", "axes-total")
+  };
+  std::vector<std::string> const text = query.find(rws_result);
+
   MechanicalUnitStaticInfo static_info;
-  static_info.task_name = xmlFindTextContent(rws_result, XMLAttribute("class", "task-name"));
-  static_info.is_integrated_unit = xmlFindTextContent(rws_result, XMLAttribute("class", "is-integrated-unit"));
-  static_info.has_integrated_unit = xmlFindTextContent(rws_result, XMLAttribute("class", "has-integrated-unit"));
-  std::string type = xmlFindTextContent(rws_result, XMLAttribute("class", "type"));
+  static_info.task_name = text[0];
+  static_info.is_integrated_unit = text[1];
+  static_info.has_integrated_unit = text[2];
+  std::string type = text[3];
 
   // Assume mechanical unit type is undefined, update based on contents of 'type'.
   static_info.type = MechanicalUnitType::UNDEFINED;
@@ -612,10 +493,10 @@ MechanicalUnitStaticInfo RWSInterface::getMechanicalUnitStaticInfo(const std::st
     static_info.type = MechanicalUnitType::SINGLE;
   }
 
-  std::stringstream axes(xmlFindTextContent(rws_result, XMLAttribute("class", "axes")));
+  std::stringstream axes(text[4]);
   axes >> static_info.axes;
 
-  std::stringstream axes_total(xmlFindTextContent(rws_result, XMLAttribute("class", "axes-total")));
+  std::stringstream axes_total(text[5]);
   axes_total >> static_info.axes_total;
 
   // Basic verification.
@@ -635,15 +516,23 @@ MechanicalUnitDynamicInfo RWSInterface::getMechanicalUnitDynamicInfo(const std::
 
   RWSResult rws_result = rws_client_.getMechanicalUnitDynamicInfo(mechunit);
 
+  static XMLTextContentQuery const query{
+    XMLAttribute("class", "tool-name"), XMLAttribute("class", "wobj-name"),
+    XMLAttribute("class", "payload-name"), XMLAttribute("class", "total-payload-name"),
+    XMLAttribute("class", "status"), XMLAttribute("class", "jog-mode"),
+    XMLAttribute("class", "mode"), XMLAttribute("class", "coord-system")
+  };
+  std::vector<std::string> const text = query.find(rws_result);
+
   MechanicalUnitDynamicInfo dynamic_info;
-  dynamic_info.tool_name = xmlFindTextContent(rws_result, XMLAttribute("class", "tool-name"));
-  dynamic_info.wobj_name = xmlFindTextContent(rws_result, XMLAttribute("class", "wobj-name"));
-  dynamic_info.payload_name = xmlFindTextContent(rws_result, XMLAttribute("class", "payload-name"));
-  dynamic_info.total_payload_name = xmlFindTextContent(rws_result, XMLAttribute("class", "total-payload-name"));
-  dynamic_info.status = xmlFindTextContent(rws_result, XMLAttribute("class", "status"));
-  dynamic_info.jog_mode = xmlFindTextContent(rws_result, XMLAttribute("class", "jog-mode"));
-  std::string mode = xmlFindTextContent(rws_result, XMLAttribute("class", "mode"));
-  std::string coord_system = xmlFindTextContent(rws_result, XMLAttribute("class", "coord-system"));
+  dynamic_info.tool_name = text[0];
+  dynamic_info.wobj_name = text[1];
+  dynamic_info.payload_name = text[2];
+  dynamic_info.total_payload_name = text[3];
+  dynamic_info.status = text[4];
+  dynamic_info.jog_mode = text[5];
+  std::string mode = text[6];
+  std::string coord_system = text[7];
 
   // Assume mechanical unit mode is unknown, update based on contents of 'mode'.
   dynamic_info.mode = MechanicalUnitMode::UNKNOWN_MODE;
@@ -687,20 +576,20 @@ MechanicalUnitDynamicInfo RWSInterface::getMechanicalUnitDynamicInfo(const std::
 JointTarget RWSInterface::getMechanicalUnitJointTarget(const std::string& mechunit)
 {
   RWSResult rws_result = rws_client_.getMechanicalUnitJointTarget(mechunit);
+
+  static XMLTextContentQuery const query{
+    XMLAttribute("class", "rax_1"), XMLAttribute("class", "rax_2"), XMLAttribute("class", "rax_3"),
+    XMLAttribute("class", "rax_4"), XMLAttribute("class", "rax_5"), XMLAttribute("class", "rax_6"),
+    XMLAttribute("class", "eax_a"), XMLAttribute("class", "eax_b"), XMLAttribute("class", "eax_c"),
+    XMLAttribute("class", "eax_d"), XMLAttribute("class", "eax_e"), XMLAttribute("class", "eax_f")
+  };
+  std::vector<std::string> const text = query.find(rws_result);
+
   std::stringstream ss;
 
-  ss << "[[" << xmlFindTextContent(rws_result, XMLAttribute("class", "rax_1")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "rax_2")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "rax_3")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "rax_4")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "rax_5")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "rax_6")) << "], ["
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "eax_a")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "eax_b")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "eax_c")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "eax_d")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "eax_e")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "eax_f")) << "]]";
+  ss << "[[" << text[0] << "," << text[1] << "," << text[2] << "," << text[3] << "," << text[4] << "," << text[5]
+     << "], [" << text[6] << "," << text[7] << "," << text[8] << "," << text[9] << "," << text[10] << "," << text[11]
+     << "]]";
 
   JointTarget jointtarget;
   jointtarget.parseString(ss.str());
@@ -708,30 +597,51 @@ JointTarget RWSInterface::getMechanicalUnitJointTarget(const std::string& mechun
   return jointtarget;
 }
 
+std::future<JointTarget> RWSInterface::getMechanicalUnitJointTargetAsync(const std::string& mechunit)
+{
+  return submit(rws_client_.executor(), [this, mechunit] { return getMechanicalUnitJointTarget(mechunit); });
+}
+
+std::future<RobTarget> RWSInterface::getMechanicalUnitRobTargetAsync(const std::string& mechunit,
+                                                                     Coordinate coordinate, const std::string& tool,
+                                                                     const std::string& wobj)
+{
+  return submit(rws_client_.executor(), [this, mechunit, coordinate, tool, wobj] {
+    return getMechanicalUnitRobTarget(mechunit, coordinate, tool, wobj);
+  });
+}
+
+void RWSInterface::getMechanicalUnitRobTargetAsync(const std::string& mechunit, Coordinate coordinate,
+                                                   const std::string& tool, const std::string& wobj,
+                                                   Completion<RobTarget> completion)
+{
+  submit(
+      rws_client_.executor(),
+      [this, mechunit, coordinate, tool, wobj] { return getMechanicalUnitRobTarget(mechunit, coordinate, tool, wobj); },
+      std::move(completion));
+}
+
 RobTarget RWSInterface::getMechanicalUnitRobTarget(const std::string& mechunit, Coordinate coordinate,
                                                    const std::string& tool, const std::string& wobj)
 {
   RWSResult rws_result = rws_client_.getMechanicalUnitRobTarget(mechunit, coordinate, tool, wobj);
 
+  static XMLTextContentQuery const query{
+    XMLAttribute("class", "x"),     XMLAttribute("class", "y"),     XMLAttribute("class", "z"),
+    XMLAttribute("class", "q1"),    XMLAttribute("class", "q2"),    XMLAttribute("class", "q3"),
+    XMLAttribute("class", "q4"),    XMLAttribute("class", "cf1"),   XMLAttribute("class", "cf4"),
+    XMLAttribute("class", "cf6"),   XMLAttribute("class", "cfx"),   XMLAttribute("class", "eax_a"),
+    XMLAttribute("class", "eax_b"), XMLAttribute("class", "eax_c"), XMLAttribute("class", "eax_d"),
+    XMLAttribute("class", "eax_e"), XMLAttribute("class", "eax_f")
+  };
+  std::vector<std::string> const text = query.find(rws_result);
+
   std::stringstream ss;
 
-  ss << "[[" << xmlFindTextContent(rws_result, XMLAttribute("class", "x")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "y")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "z")) << "], ["
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "q1")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "q2")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "q3")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "q4")) << "], ["
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "cf1")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "cf4")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "cf6")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "cfx")) << "], ["
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "eax_a")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "eax_b")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "eax_c")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "eax_d")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "eax_e")) << ","
-     << xmlFindTextContent(rws_result, XMLAttribute("class", "eax_f")) << "]]";
+  ss << "[[" << text[0] << "," << text[1] << "," << text[2] << "], [" << text[3] << "," << text[4] << "," << text[5]
+     << "," << text[6] << "], [" << text[7] << "," << text[8] << "," << text[9] << "," << text[10] << "], ["
+     << text[11] << "," << text[12] << "," << text[13] << "," << text[14] << "," << text[15] << "," << text[16]
+     << "]]";
 
   RobTarget robtarget;
   robtarget.parseString(ss.str());
@@ -742,12 +652,18 @@ RobTarget RWSInterface::getMechanicalUnitRobTarget(const std::string& mechunit,
 void RWSInterface::setRAPIDSymbolData(const std::string& task, const std::string& module, const std::string& name,
                                       const std::string& data)
 {
-  rw::rapid::setRAPIDSymbolData(rws_client_, RAPIDResource(task, module, name), data);
+  writeRAPIDSymbolData(RAPIDResource(task, module, name), data);
 }
 
 void RWSInterface::setRAPIDSymbolData(RAPIDResource const& resource, const RAPIDSymbolDataAbstract& data)
 {
-  rw::rapid::setRAPIDSymbolData(rws_client_, resource, data);
+  writeRAPIDSymbolData(resource, data.constructString());
+}
+
+void RWSInterface::writeRAPIDSymbolData(RAPIDResource const& resource, const std::string& data)
+{
+  write_suppression_cache_.write(resource, data,
+                                 [&] { rw::rapid::setRAPIDSymbolData(rws_client_, resource, data); });
 }
 
 void RWSInterface::startRAPIDExecution()
@@ -763,6 +679,7 @@ void RWSInterface::stopRAPIDExecution(StopMode stopmode, UseTsp usetsp)
 void RWSInterface::resetRAPIDProgramPointer()
 {
   rw::rapid::resetRAPIDProgramPointer(rws_client_);
+  write_suppression_cache_.clear();
 }
 
 void RWSInterface::setMotorsOn()
@@ -803,10 +720,13 @@ SystemInfo RWSInterface::getSystemInfo()
 
   std::vector<Poco::XML::Node*> node_list = xmlFindNodes(rws_result, XMLAttributes::CLASS_SYS_SYSTEM_LI);
 
+  static XMLTextContentQuery const system_query{ XMLAttributes::CLASS_NAME, XMLAttributes::CLASS_RW_VERSION_NAME };
+
   for (size_t i = 0; i < node_list.size(); ++i)
   {
-    result.system_name = xmlFindTextContent(node_list.at(i), XMLAttributes::CLASS_NAME);
-    result.robot_ware_version = xmlFindTextContent(node_list.at(i), XMLAttributes::CLASS_RW_VERSION_NAME);
+    std::vector<std::string> const text = system_query.find(node_list.at(i));
+    result.system_name = text[0];
+    result.robot_ware_version = text[1];
   }
 
   // throw std::runtime_error(result.robot_ware_version);
@@ -839,18 +759,71 @@ bool RWSInterface::isRAPIDRunning()
 
 void RWSInterface::setIOSignal(const std::string& iosignal, const std::string& value)
 {
-  rws_client_.setIOSignal(iosignal, value);
+  write_suppression_cache_.write(IOSignalResource{ iosignal }, value,
+                                 [&] { rws_client_.setIOSignal(iosignal, value); });
 }
 
 std::string RWSInterface::getRAPIDSymbolData(const std::string& task, const std::string& module,
                                              const std::string& name)
 {
-  return rw::rapid::getRAPIDSymbolData(rws_client_, RAPIDResource(task, module, name));
+  RAPIDResource const resource(task, module, name);
+  std::string data = rw::rapid::getRAPIDSymbolData(rws_client_, resource);
+  write_suppression_cache_.observe(resource, data);
+
+  return data;
 }
 
 void RWSInterface::getRAPIDSymbolData(RAPIDResource const& resource, RAPIDSymbolDataAbstract& data)
 {
   rw::rapid::getRAPIDSymbolData(rws_client_, resource, data);
+
+  if (write_suppression_cache_.isEnabled())
+    write_suppression_cache_.observe(resource, data.constructString());
+}
+
+std::future<std::string> RWSInterface::getRAPIDSymbolDataAsync(RAPIDResource const& resource)
+{
+  // Read through the synchronous methods, which also record the value read in the write suppression cache.
+  return submit(rws_client_.executor(),
+                [this, resource] { return getRAPIDSymbolData(resource.task, resource.module, resource.name); });
+}
+
+std::future<void> RWSInterface::getRAPIDSymbolDataAsync(RAPIDResource const& resource, RAPIDSymbolDataAbstract& data)
+{
+  return submit(rws_client_.executor(), [this, resource, &data] { getRAPIDSymbolData(resource, data); });
+}
+
+void RWSInterface::getRAPIDSymbolDataAsync(RAPIDResource const& resource, RAPIDSymbolDataAbstract& data,
+                                           Completion<void> completion)
+{
+  submit(rws_client_.executor(), [this, resource, &data] { getRAPIDSymbolData(resource, data); },
+         std::move(completion));
+}
+
+std::vector<std::exception_ptr>
+RWSInterface::getRAPIDSymbolData(std::vector<std::pair<RAPIDResource, RAPIDSymbolDataAbstract*>> const& symbols)
+{
+  std::vector<std::future<void>> reads;
+  reads.reserve(symbols.size());
+
+  for (auto const& [resource, data] : symbols)
+    reads.push_back(getRAPIDSymbolDataAsync(resource, *data));
+
+  // Every read must complete before returning, since the reads refer to the callers' data.
+  std::vector<std::exception_ptr> errors(reads.size());
+  for (std::size_t i = 0; i < reads.size(); ++i)
+  {
+    try
+    {
+      reads[i].get();
+    }
+    catch (...)
+    {
+      errors[i] = std::current_exception();
+    }
+  }
+
+  return errors;
 }
 
 std::string RWSInterface::getFile(const FileResource& resource)
@@ -919,23 +892,35 @@ std::uint32_t RWSInterface::getGroupSignal(std::string const& signal_name)
 
 rw::io::IOSignalInfo RWSInterface::getIOSignals()
 {
-  auto const doc = rws_client_.getIOSignals();
   rw::io::IOSignalInfo signals;
-
-  for (auto&& node : xmlFindNodes(doc, { "class", "ios-signal-li" }))
-  {
-    std::string const name = xmlFindTextContent(node, { "class", "name" });
-    std::string const value = xmlFindTextContent(node, { "class", "lvalue" });
-    std::string const type = xmlFindTextContent(node, { "class", "type" });
-
-    if (!name.empty() && !value.empty())
-    {
-      if (type == "DI" || type == "DO")
-        signals[name] = digitalSignalToBool(value);
-      else if (type == "AI" || type == "AO")
-        signals[name] = std::stof(value);
-    }
-  }
+  std::string name;
+  std::string value;
+  std::string type;
+
+  rws_client_.extractContent(
+      rws_client_.httpGet(Resources::RW_IOSYSTEM_SIGNALS),
+      { { "class", "ios-signal-li" }, "class", { "name", "lvalue", "type" } },
+      [&](std::string const& key, std::string const& text) {
+        if (key == "name")
+          name = text;
+        else if (key == "lvalue")
+          value = text;
+        else
+          type = text;
+      },
+      [&](std::string const&) {
+        if (!name.empty() && !value.empty())
+        {
+          if (type == "DI" || type == "DO")
+            signals[name] = digitalSignalToBool(value);
+          else if (type == "AI" || type == "AO")
+            signals[name] = std::stof(value);
+        }
+
+        name.clear();
+        value.clear();
+        type.clear();
+      });
 
   return signals;
 }
@@ -0,0 +1,861 @@
+#include <gtest/gtest.h>
+
+#include <abb_librws/mock/mock_controller.h>
+#include <abb_librws/rws_error.h>
+#include <abb_librws/rws_poco_client.h>
+#include <abb_librws/rws_subscription_queue.h>
+#include <abb_librws/rws_subscription_reactor.h>
+#include <abb_librws/v1_0/rws_client.h>
+#include <abb_librws/v1_0/rws_interface.h>
+#include <abb_librws/v1_0/rw/io.h>
+#include <abb_librws/v2_0/rws_client.h>
+#include <abb_librws/v2_0/rws_interface.h>
+#include <abb_librws/v2_0/rw/panel.h>
+#include <abb_librws/v2_0/rw/rapid.h>
+
+#include <Poco/Net/HTTPClientSession.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace abb ::rws ::mock
+{
+namespace
+{
+MockControllerOptions secureOptions()
+{
+  MockControllerOptions options;
+  options.version = RWSVersion::V2_0;
+  options.certificate_file = ABB_LIBRWS_TEST_DATA_DIR "/mock_controller_cert.pem";
+  options.private_key_file = ABB_LIBRWS_TEST_DATA_DIR "/mock_controller_key.pem";
+
+  return options;
+}
+
+MockControllerOptions version1Options()
+{
+  MockControllerOptions options;
+  options.version = RWSVersion::V1_0;
+
+  return options;
+}
+
+struct RecordingCallback : SubscriptionCallback
+{
+  void processEvents(std::vector<SubscriptionEvent> const& events) override
+  {
+    batch_sizes.push_back(events.size());
+    SubscriptionCallback::processEvents(events);
+  }
+
+  void processEvent(IOSignalStateEvent const& event) override
+  {
+    io_signal_events.push_back(event);
+  }
+
+  void processEvent(RAPIDExecutionStateEvent const& event) override
+  {
+    execution_state_events.push_back(event);
+  }
+
+  void processEvent(ControllerStateEvent const& event) override
+  {
+    controller_state_events.push_back(event);
+  }
+
+  void processEvent(OperationModeEvent const& event) override
+  {
+    operation_mode_events.push_back(event);
+  }
+
+  void processEvent(RAPIDSymbolValueEvent const& event) override
+  {
+    rapid_symbol_events.push_back(event);
+  }
+
+  std::vector<std::size_t> batch_sizes;
+  std::vector<IOSignalStateEvent> io_signal_events;
+  std::vector<RAPIDExecutionStateEvent> execution_state_events;
+  std::vector<ControllerStateEvent> controller_state_events;
+  std::vector<OperationModeEvent> operation_mode_events;
+  std::vector<RAPIDSymbolValueEvent> rapid_symbol_events;
+};
+
+/**
+ * \brief Records IO signal events dispatched on several threads.
+ */
+struct ConcurrentRecordingCallback : SubscriptionCallback
+{
+  void processEvent(IOSignalStateEvent const& event) override
+  {
+    std::lock_guard<std::mutex> lock{ mutex };
+
+    io_signal_values[event.signal].push_back(event.value);
+    ++count;
+    event_received.notify_all();
+  }
+
+  bool waitForEvents(std::size_t expected_count)
+  {
+    std::unique_lock<std::mutex> lock{ mutex };
+    return event_received.wait_for(lock, std::chrono::seconds{ 10 }, [&] { return count >= expected_count; });
+  }
+
+  std::mutex mutex;
+  std::condition_variable event_received;
+  std::map<std::string, std::vector<std::string>> io_signal_values;
+  std::size_t count = 0;
+};
+
+/**
+ * \brief Changes an IO signal in a burst faster than the mock sends events, and checks that every change is received,
+ * in order, although several changes are coalesced into each WebSocket message.
+ */
+template <typename Client>
+void testIOSignalEventBurst(MockControllerOptions const& options)
+{
+  std::size_t const EVENT_COUNT = 1000;
+
+  MockController controller{ options };
+  controller.setIOSignal("AO_1", "-1", "AO");
+
+  Client client{ controller.connectionOptions() };
+  SubscriptionGroup group{ client, { { IOSignalResource{ "AO_1" }, SubscriptionPriority::HIGH } } };
+
+  // The changes are queued before the WebSocket is connected, so that the mock has to coalesce them.
+  for (std::size_t i = 0; i < EVENT_COUNT; ++i)
+    controller.setIOSignal("AO_1", std::to_string(i), "AO");
+
+  SubscriptionReceiver receiver = group.receive();
+  RecordingCallback callback;
+
+  while (callback.io_signal_events.size() < EVENT_COUNT)
+    ASSERT_TRUE(receiver.waitForEvent(callback, std::chrono::seconds{ 5 }));
+
+  ASSERT_EQ(callback.io_signal_events.size(), EVENT_COUNT);
+  for (std::size_t i = 0; i < EVENT_COUNT; ++i)
+  {
+    EXPECT_EQ(callback.io_signal_events[i].signal, "AO_1");
+    EXPECT_EQ(callback.io_signal_events[i].value, std::to_string(i));
+  }
+
+  MockController::Statistics const statistics = controller.getStatistics();
+  EXPECT_EQ(statistics.dropped_events, 0u);
+  EXPECT_EQ(statistics.events, EVENT_COUNT);
+  EXPECT_EQ(callback.batch_sizes.size(), statistics.frames);
+  EXPECT_LT(statistics.frames, EVENT_COUNT);
+}
+}  // namespace
+
+TEST(MockControllerTest, testIOSignalRoundTripV1)
+{
+  MockController controller{ version1Options() };
+  controller.setIOSignal("DO_1", "0");
+
+  v1_0::RWSClient client{ controller.connectionOptions() };
+  EXPECT_EQ(v1_0::rw::io::getIOSignal(client, "DO_1"), "0");
+
+  v1_0::rw::io::setIOSignal(client, "DO_1", "1");
+  EXPECT_EQ(controller.getIOSignal("DO_1"), "1");
+  EXPECT_TRUE(v1_0::rw::io::getDigitalSignal(client, "DO_1"));
+}
+
+TEST(MockControllerTest, testRAPIDSymbolRoundTripV1)
+{
+  MockController controller{ version1Options() };
+  RAPIDResource const resource{ "T_ROB1", "user", "reg1" };
+  controller.setRAPIDSymbol(resource, RAPIDNum{ 1.5f });
+
+  v1_0::RWSClient client{ controller.connectionOptions() };
+  v1_0::RWSInterface interface{ client };
+
+  RAPIDNum value;
+  interface.getRAPIDSymbolData(resource, value);
+  EXPECT_EQ(value.value, 1.5f);
+
+  interface.setRAPIDSymbolData(resource, RAPIDNum{ 2.0f });
+  EXPECT_EQ(controller.getRAPIDSymbol(resource), RAPIDNum{ 2.0f }.constructString());
+}
+
+TEST(MockControllerTest, testIOSignalSubscriptionV1)
+{
+  MockController controller{ version1Options() };
+  controller.setIOSignal("DO_1", "0");
+
+  v1_0::RWSClient client{ controller.connectionOptions() };
+  SubscriptionGroup group{ client, { { IOSignalResource{ "DO_1" }, SubscriptionPriority::MEDIUM } } };
+  SubscriptionReceiver receiver = group.receive();
+  EXPECT_EQ(controller.subscriptionCount(), 1u);
+
+  controller.setIOSignal("DO_1", "1");
+
+  RecordingCallback callback;
+  ASSERT_TRUE(receiver.waitForEvent(callback, std::chrono::seconds{ 5 }));
+  ASSERT_EQ(callback.io_signal_events.size(), 1u);
+  EXPECT_EQ(callback.io_signal_events[0].signal, "DO_1");
+  EXPECT_EQ(callback.io_signal_events[0].value, "1");
+
+  group.close();
+  EXPECT_EQ(controller.subscriptionCount(), 0u);
+}
+
+TEST(MockControllerTest, testIOSignalEventBurstV1)
+{
+  MockControllerOptions options = version1Options();
+  options.max_events_per_frame = 16;
+
+  testIOSignalEventBurst<v1_0::RWSClient>(options);
+}
+
+TEST(MockControllerTest, testIOSignalEventBurstV2)
+{
+  MockControllerOptions options = secureOptions();
+  options.max_events_per_frame = 16;
+
+  testIOSignalEventBurst<v2_0::RWSClient>(options);
+}
+
+TEST(MockControllerTest, testFragmentedEventMessages)
+{
+  // Messages of about 12 kB, split into 256 byte frames with interleaved pings.
+  MockControllerOptions options = secureOptions();
+  options.max_events_per_frame = 64;
+  options.max_frame_size = 256;
+
+  testIOSignalEventBurst<v2_0::RWSClient>(options);
+}
+
+TEST(MockControllerTest, testUnknownEventItemInBatch)
+{
+  MockControllerOptions options = secureOptions();
+  options.max_events_per_frame = 8;
+
+  MockController controller{ options };
+  controller.setIOSignal("DO_1", "1");
+
+  v2_0::RWSClient client{ controller.connectionOptions() };
+  SubscriptionGroup group{ client, { { IOSignalResource{ "DO_1" }, SubscriptionPriority::MEDIUM } } };
+  SubscriptionReceiver receiver = group.receive();
+
+  // The valid events of the message are dispatched before the unknown item is reported.
+  controller.injectEventItem("<li class=\"elog-message-ev\"><a href=\"/rw/elog/0/1\"/></li>");
+
+  RecordingCallback callback;
+  EXPECT_THROW(receiver.waitForEvent(callback, std::chrono::seconds{ 5 }), ProtocolError);
+  EXPECT_EQ(callback.batch_sizes, std::vector<std::size_t>{ 2 });
+  ASSERT_EQ(callback.io_signal_events.size(), 2u);
+  EXPECT_EQ(callback.io_signal_events[1].value, "1");
+
+  // The subscription keeps working.
+  controller.setIOSignal("DO_1", "0");
+  ASSERT_TRUE(receiver.waitForEvent(callback, std::chrono::seconds{ 5 }));
+  EXPECT_EQ(callback.io_signal_events.back().value, "0");
+}
+
+TEST(MockControllerTest, testRAPIDSymbolValueSubscriptionV1)
+{
+  MockController controller{ version1Options() };
+  RAPIDResource const resource{ "T_ROB1", "user", "current_action" };
+  controller.setRAPIDSymbol(resource, "\"idle\"", "string");
+
+  v1_0::RWSClient client{ controller.connectionOptions() };
+  SubscriptionGroup group{ client, { { resource, SubscriptionPriority::MEDIUM } } };
+  SubscriptionReceiver receiver = group.receive();
+
+  controller.setRAPIDSymbol(resource, "\"pick\"", "string");
+
+  RecordingCallback callback;
+  ASSERT_TRUE(receiver.waitForEvent(callback, std::chrono::seconds{ 5 }));
+  ASSERT_EQ(callback.rapid_symbol_events.size(), 1u);
+  EXPECT_EQ(callback.rapid_symbol_events[0].task, "T_ROB1");
+  EXPECT_EQ(callback.rapid_symbol_events[0].module, "user");
+  EXPECT_EQ(callback.rapid_symbol_events[0].name, "current_action");
+  EXPECT_EQ(callback.rapid_symbol_events[0].value, "\"pick\"");
+}
+
+TEST(MockControllerTest, testRAPIDSymbolValueDecoding)
+{
+  struct DecodedCallback : RAPIDSymbolDecodingCallback
+  {
+    void processDecodedEvent(RAPIDSymbolValueEvent const& event, RAPIDSymbolDataAbstract& data) override
+    {
+      decoded.push_back(event.name + "=" + data.constructString());
+    }
+
+    std::vector<std::string> decoded;
+  };
+
+  MockController controller{ secureOptions() };
+  RAPIDResource const state_resource{ "T_ROB1", "user", "current_state" };
+  RAPIDResource const action_resource{ "T_ROB1", "user", "current_action" };
+  controller.setRAPIDSymbol(state_resource, RAPIDNum{ 0.f });
+  controller.setRAPIDSymbol(action_resource, RAPIDString{ "idle" });
+
+  v2_0::RWSClient client{ controller.connectionOptions() };
+  SubscriptionGroup group{ client, { { state_resource, SubscriptionPriority::MEDIUM },
+                                     { action_resource, SubscriptionPriority::MEDIUM } } };
+  SubscriptionReceiver receiver = group.receive();
+
+  RAPIDNum current_state;
+  DecodedCallback callback;
+  callback.registerSymbol(state_resource, current_state);
+
+  controller.setRAPIDSymbol(state_resource, RAPIDNum{ 0.375f });
+  ASSERT_TRUE(receiver.waitForEvent(callback, std::chrono::seconds{ 5 }));
+  EXPECT_FLOAT_EQ(current_state.value, 0.375f);
+
+  // Events of unregistered symbols are not decoded.
+  controller.setRAPIDSymbol(action_resource, RAPIDString{ "pick" });
+  ASSERT_TRUE(receiver.waitForEvent(callback, std::chrono::seconds{ 5 }));
+
+  ASSERT_EQ(callback.decoded.size(), 1u);
+  EXPECT_EQ(callback.decoded[0], "current_state=" + RAPIDNum{ 0.375f }.constructString());
+}
+
+TEST(MockControllerTest, testSubscriptionReactor)
+{
+  std::size_t const CHANGE_COUNT = 100;
+
+  MockControllerOptions fragmenting_options = secureOptions();
+  fragmenting_options.max_events_per_frame = 8;
+  fragmenting_options.max_frame_size = 128;
+
+  MockController controller_1{ version1Options() };
+  MockController controller_2{ fragmenting_options };
+  std::vector<std::string> const signals_1{ "AO_1", "AO_2", "AO_3" };
+  std::vector<std::string> const signals_2{ "AO_4", "AO_5", "AO_6" };
+
+  v1_0::RWSClient client_1{ controller_1.connectionOptions() };
+  v2_0::RWSClient client_2{ controller_2.connectionOptions() };
+  std::vector<SubscriptionGroup> groups;
+  groups.reserve(signals_1.size() + signals_2.size());
+
+  for (std::string const& signal : signals_1)
+  {
+    controller_1.setIOSignal(signal, "-1", "AO");
+    groups.emplace_back(client_1, SubscriptionResources{ { IOSignalResource{ signal }, SubscriptionPriority::HIGH } });
+  }
+
+  for (std::string const& signal : signals_2)
+  {
+    controller_2.setIOSignal(signal, "-1", "AO");
+    groups.emplace_back(client_2, SubscriptionResources{ { IOSignalResource{ signal }, SubscriptionPriority::HIGH } });
+  }
+
+  ConcurrentRecordingCallback callback;
+  std::promise<std::exception_ptr> closed;
+  SubscriptionReactor reactor{ 2 };
+  std::vector<std::size_t> ids;
+
+  // The receivers are created in place, since they cannot be moved.
+  auto const receive = [&](std::size_t i) {
+    SubscriptionManager& client = i < signals_1.size() ? static_cast<SubscriptionManager&>(client_1) : client_2;
+    return std::make_unique<SubscriptionReceiver>(client, groups[i].id());
+  };
+
+  ids.push_back(reactor.add(receive(0), callback, [&closed](std::exception_ptr error) { closed.set_value(error); }));
+  for (std::size_t i = 1; i < groups.size(); ++i)
+    ids.push_back(reactor.add(receive(i), callback));
+
+  EXPECT_EQ(reactor.size(), groups.size());
+
+  for (std::size_t i = 0; i < CHANGE_COUNT; ++i)
+  {
+    for (std::string const& signal : signals_1)
+      controller_1.setIOSignal(signal, std::to_string(i), "AO");
+
+    for (std::string const& signal : signals_2)
+      controller_2.setIOSignal(signal, std::to_string(i), "AO");
+  }
+
+  ASSERT_TRUE(callback.waitForEvents(CHANGE_COUNT * groups.size()));
+
+  {
+    std::lock_guard<std::mutex> lock{ callback.mutex };
+    ASSERT_EQ(callback.io_signal_values.size(), groups.size());
+
+    // The events of each subscription are dispatched in order.
+    for (auto const& [signal, values] : callback.io_signal_values)
+    {
+      ASSERT_EQ(values.size(), CHANGE_COUNT) << signal;
+      for (std::size_t i = 0; i < CHANGE_COUNT; ++i)
+        EXPECT_EQ(values[i], std::to_string(i)) << signal;
+    }
+  }
+
+  // Closing a subscription on the controller closes its WebSocket connection.
+  auto closed_future = closed.get_future();
+  groups[0].close();
+  ASSERT_EQ(closed_future.wait_for(std::chrono::seconds{ 5 }), std::future_status::ready);
+  EXPECT_THROW(std::rethrow_exception(closed_future.get()), CommunicationError);
+  EXPECT_EQ(reactor.size(), groups.size() - 1);
+
+  reactor.remove(ids[1]);
+  EXPECT_EQ(reactor.size(), groups.size() - 2);
+}
+
+TEST(MockControllerTest, testSubscriptionEventQueueConflation)
+{
+  std::size_t const CHANGE_COUNT = 500;
+
+  MockControllerOptions options = version1Options();
+  options.max_events_per_frame = 16;
+
+  MockController controller{ options };
+  controller.setIOSignal("AO_1", "-1", "AO");
+  controller.setIOSignal("AO_2", "-1", "AO");
+
+  v1_0::RWSClient client{ controller.connectionOptions() };
+  SubscriptionGroup group{ client,
+                           { { IOSignalResource{ "AO_1" }, SubscriptionPriority::HIGH },
+                             { IOSignalResource{ "AO_2" }, SubscriptionPriority::HIGH } } };
+  SubscriptionReceiver receiver = group.receive();
+
+  for (std::size_t i = 0; i < CHANGE_COUNT; ++i)
+  {
+    controller.setIOSignal("AO_1", std::to_string(i), "AO");
+    controller.setIOSignal("AO_2", std::to_string(i), "AO");
+  }
+
+  // The consumer is stalled while all changes are received, so only the latest state of each signal is kept.
+  SubscriptionEventQueue queue{ 16, SubscriptionOverflowPolicy::CONFLATE };
+  while (queue.getStatistics().conflations < 2 * (CHANGE_COUNT - 1))
+    ASSERT_TRUE(receiver.waitForEvent(queue, std::chrono::seconds{ 5 }));
+
+  SubscriptionEventQueueStatistics const statistics = queue.getStatistics();
+  EXPECT_EQ(statistics.depth, 2u);
+  EXPECT_EQ(statistics.max_depth, 2u);
+  EXPECT_EQ(statistics.drops, 0u);
+
+  RecordingCallback callback;
+  EXPECT_EQ(queue.dispatch(callback, std::chrono::seconds{ 1 }), 2u);
+  ASSERT_EQ(callback.io_signal_events.size(), 2u);
+  EXPECT_EQ(callback.io_signal_events[0].signal, "AO_1");
+  EXPECT_EQ(callback.io_signal_events[0].value, std::to_string(CHANGE_COUNT - 1));
+  EXPECT_EQ(callback.io_signal_events[1].signal, "AO_2");
+  EXPECT_EQ(callback.io_signal_events[1].value, std::to_string(CHANGE_COUNT - 1));
+}
+
+TEST(MockControllerTest, testPanelAndExecutionOverHTTPS)
+{
+  MockController controller{ secureOptions() };
+  controller.setControllerState(rw::ControllerState::motorOn);
+
+  v2_0::RWSClient client{ controller.connectionOptions() };
+  EXPECT_EQ(v2_0::rw::panel::getControllerState(client), rw::ControllerState::motorOn);
+  EXPECT_EQ(v2_0::rw::panel::getOperationMode(client), rw::OperationMode::automatic);
+
+  SubscriptionGroup group{ client, { { RAPIDExecutionStateResource{}, SubscriptionPriority::MEDIUM } } };
+  SubscriptionReceiver receiver = group.receive();
+
+  v2_0::rw::rapid::startRAPIDExecution(client);
+  EXPECT_EQ(controller.getRAPIDExecutionState(), rw::RAPIDExecutionState::running);
+  EXPECT_EQ(v2_0::rw::rapid::getRAPIDExecution(client).ctrlexecstate, rw::RAPIDExecutionState::running);
+
+  RecordingCallback callback;
+  ASSERT_TRUE(receiver.waitForEvent(callback, std::chrono::seconds{ 5 }));
+  ASSERT_EQ(callback.execution_state_events.size(), 1u);
+  EXPECT_EQ(callback.execution_state_events[0].state, rw::RAPIDExecutionState::running);
+}
+
+TEST(MockControllerTest, testPanelSubscriptionOverHTTPS)
+{
+  MockController controller{ secureOptions() };
+  controller.setControllerState(rw::ControllerState::motorOff);
+
+  v2_0::RWSClient client{ controller.connectionOptions() };
+  SubscriptionGroup group{ client, { { ControllerStateResource{}, SubscriptionPriority::MEDIUM },
+                                     { OperationModeResource{}, SubscriptionPriority::MEDIUM } } };
+  SubscriptionReceiver receiver = group.receive();
+
+  v2_0::rw::panel::setControllerState(client, rw::ControllerState::motorOn);
+  controller.setOperationMode(rw::OperationMode::manR);
+
+  RecordingCallback callback;
+  while (callback.controller_state_events.size() + callback.operation_mode_events.size() < 2)
+    ASSERT_TRUE(receiver.waitForEvent(callback, std::chrono::seconds{ 5 }));
+
+  ASSERT_EQ(callback.controller_state_events.size(), 1u);
+  EXPECT_EQ(callback.controller_state_events[0].state, rw::ControllerState::motorOn);
+  ASSERT_EQ(callback.operation_mode_events.size(), 1u);
+  EXPECT_EQ(callback.operation_mode_events[0].mode, rw::OperationMode::manR);
+}
+
+TEST(MockControllerTest, testRAPIDSymbolCache)
+{
+  MockController controller{ secureOptions() };
+  RAPIDResource const resource{ "T_ROB1", "user", "reg1" };
+  controller.setRAPIDSymbol(resource, RAPIDNum{ 1.5f });
+
+  v2_0::RWSClient client{ controller.connectionOptions() };
+  RAPIDNum value;
+  v2_0::rw::rapid::getRAPIDSymbolData(client, resource, value);
+
+  // Steady-state typed reads only request the data.
+  std::size_t const requests = controller.getStatistics().requests;
+  v2_0::rw::rapid::getRAPIDSymbolData(client, resource, value);
+  EXPECT_EQ(controller.getStatistics().requests, requests + 1);
+  EXPECT_EQ(value.value, 1.5f);
+  EXPECT_EQ(client.rapidSymbolCache().getStatistics().hits, 1u);
+
+  RAPIDBool wrong_type;
+  EXPECT_THROW(v2_0::rw::rapid::getRAPIDSymbolData(client, resource, wrong_type), std::invalid_argument);
+
+  v2_0::rw::rapid::resetRAPIDProgramPointer(client);
+  EXPECT_FALSE(client.rapidSymbolCache().find(resource));
+  EXPECT_EQ(client.rapidSymbolCache().getStatistics().invalidations, 1u);
+}
+
+TEST(MockControllerTest, testRAPIDRecordSchemaDiscovery)
+{
+  MockController controller{ secureOptions() };
+  controller.setRAPIDRecordType({ "T_ROB1", "user", "offset" }, { { "dist", "num" }, { "active", "bool" } });
+  controller.setRAPIDRecordType({ "T_ROB1", "user", "partdata" },
+                                { { "name", "string" }, { "offset", "offset" }, { "count", "num" } });
+
+  RAPIDResource const part1{ "T_ROB1", "user", "part1" };
+  RAPIDResource const part2{ "T_ROB1", "user", "part2" };
+  controller.setRAPIDSymbol(part1, "[\"bracket\",[0.5,TRUE],3]", "partdata");
+  controller.setRAPIDSymbol(part2, "[\"plate\",[0.25,FALSE],4]", "partdata");
+
+  v2_0::RWSClient client{ controller.connectionOptions() };
+  auto const schema = v2_0::rw::rapid::getRAPIDSymbolSchema(client, part1);
+  EXPECT_EQ(schema->getType(), "partdata");
+  EXPECT_EQ(schema->slotCount(), 4u);
+
+  // The layout of the type is discovered only once.
+  std::size_t const requests = controller.getStatistics().requests;
+  EXPECT_EQ(v2_0::rw::rapid::getRAPIDSymbolSchema(client, part2), schema);
+  EXPECT_EQ(controller.getStatistics().requests, requests + 1);
+
+  RAPIDValue value{ schema };
+  v2_0::rw::rapid::getRAPIDSymbolData(client, part1, value);
+  EXPECT_EQ(std::get<std::string>(value.at("name")), "bracket");
+  EXPECT_EQ(std::get<float>(value.at("offset.dist")), 0.5f);
+  EXPECT_TRUE(std::get<bool>(value.at("offset.active")));
+
+  std::get<bool>(value.at("offset.active")) = false;
+  v2_0::rw::rapid::setRAPIDSymbolData(client, part1, value);
+  EXPECT_EQ(controller.getRAPIDSymbol(part1), "[\"bracket\",[0.5,FALSE],3.0000000]");
+}
+
+TEST(MockControllerTest, testRAPIDSymbolBatchRead)
+{
+  MockController controller{ secureOptions() };
+  RAPIDResource const reg1{ "T_ROB1", "user", "reg1" };
+  RAPIDResource const flag{ "T_ROB2", "user", "flag" };
+  RAPIDResource const missing{ "T_ROB1", "user", "missing" };
+  controller.setRAPIDSymbol(reg1, RAPIDNum{ 1.5f });
+  controller.setRAPIDSymbol(flag, RAPIDBool{ true });
+
+  ConnectionOptions options = controller.connectionOptions();
+  options.session_pool_size = 4;
+  v2_0::RWSClient client{ options };
+  v2_0::RWSInterface interface{ client };
+
+  RAPIDNum value;
+  RAPIDBool flag_value;
+  RAPIDNum missing_value;
+  RAPIDNum wrong_type;
+  auto const errors = interface.getRAPIDSymbolData(
+      { { reg1, &value }, { missing, &missing_value }, { flag, &flag_value }, { flag, &wrong_type } });
+
+  // The failing reads do not abort the batch.
+  ASSERT_EQ(errors.size(), 4u);
+  EXPECT_FALSE(errors[0]);
+  EXPECT_EQ(value.value, 1.5f);
+  EXPECT_TRUE(errors[1]);
+  EXPECT_FALSE(errors[2]);
+  EXPECT_TRUE(flag_value.value);
+  ASSERT_TRUE(errors[3]);
+  EXPECT_THROW(std::rethrow_exception(errors[3]), std::invalid_argument);
+}
+
+TEST(MockControllerTest, testClientWaitsForAsyncRequestsOnSharedExecutor)
+{
+  std::size_t const REQUEST_COUNT = 10;
+
+  MockController controller{ secureOptions() };
+  controller.setIOSignal("DO_1", "1");
+
+  auto const executor = std::make_shared<ThreadPoolExecutor>(1);
+  std::atomic<std::size_t> completed{ 0 };
+
+  {
+    v2_0::RWSClient client{ controller.connectionOptions(), executor };
+
+    for (std::size_t i = 0; i < REQUEST_COUNT; ++i)
+    {
+      client.getIOSignalAsync("DO_1", [&completed](std::future<v2_0::RWSClient::RWSResult> result) {
+        result.get();
+        ++completed;
+      });
+    }
+  }
+
+  // The executor outlives the client, which has waited for its queued requests instead of leaving them dangling.
+  EXPECT_EQ(completed, REQUEST_COUNT);
+}
+
+TEST(MockControllerTest, testWriteSuppression)
+{
+  MockController controller{ secureOptions() };
+  RAPIDResource const resource{ "T_ROB1", "user", "reg1" };
+  controller.setRAPIDSymbol(resource, RAPIDNum{ 0.f });
+  controller.setIOSignal("DO_1", "0");
+
+  v2_0::RWSClient client{ controller.connectionOptions() };
+  v2_0::RWSInterface interface{ client };
+  interface.writeSuppressionCache().setEnabled(true);
+
+  interface.setRAPIDSymbolData(resource, RAPIDNum{ 0.5f });
+  interface.setDigitalSignal("DO_1", true);
+
+  // Rewriting the confirmed values does not reach the controller.
+  std::size_t const requests = controller.getStatistics().requests;
+  interface.setRAPIDSymbolData(resource, RAPIDNum{ 0.5f });
+  interface.setDigitalSignal("DO_1", true);
+  EXPECT_EQ(controller.getStatistics().requests, requests);
+  EXPECT_EQ(controller.getIOSignal("DO_1"), "1");
+
+  // Changes made by others are only seen after invalidation.
+  controller.setRAPIDSymbol(resource, RAPIDNum{ 0.f });
+  interface.writeSuppressionCache().invalidate(resource);
+  interface.setRAPIDSymbolData(resource, RAPIDNum{ 0.5f });
+  EXPECT_EQ(controller.getRAPIDSymbol(resource), RAPIDNum{ 0.5f }.constructString());
+
+  auto const statistics = interface.writeSuppressionCache().getStatistics();
+  EXPECT_EQ(statistics.suppressed, 2u);
+  EXPECT_EQ(statistics.written, 3u);
+  EXPECT_EQ(statistics.invalidations, 1u);
+}
+
+TEST(MockControllerTest, testWriteSuppressionObservesBatchReads)
+{
+  MockController controller{ secureOptions() };
+  RAPIDResource const resource{ "T_ROB1", "user", "reg1" };
+  RAPIDResource const other_resource{ "T_ROB1", "user", "reg2" };
+  controller.setRAPIDSymbol(resource, RAPIDNum{ 0.f });
+  controller.setRAPIDSymbol(other_resource, RAPIDNum{ 0.f });
+
+  v2_0::RWSClient client{ controller.connectionOptions() };
+  v2_0::RWSInterface interface{ client };
+  interface.writeSuppressionCache().setEnabled(true);
+
+  interface.setRAPIDSymbolData(resource, RAPIDNum{ 0.5f });
+  interface.setRAPIDSymbolData(other_resource, RAPIDNum{ 0.5f });
+
+  // A batch or asynchronous read-back of values changed by others lets the corrective writes through.
+  controller.setRAPIDSymbol(resource, RAPIDNum{ 0.f });
+  controller.setRAPIDSymbol(other_resource, RAPIDNum{ 0.f });
+
+  RAPIDNum value;
+  for (auto const& error : interface.getRAPIDSymbolData({ { resource, &value } }))
+    EXPECT_FALSE(error);
+  EXPECT_EQ(interface.getRAPIDSymbolDataAsync(other_resource).get(), RAPIDNum{ 0.f }.constructString());
+
+  interface.setRAPIDSymbolData(resource, RAPIDNum{ 0.5f });
+  interface.setRAPIDSymbolData(other_resource, RAPIDNum{ 0.5f });
+  EXPECT_EQ(controller.getRAPIDSymbol(resource), RAPIDNum{ 0.5f }.constructString());
+  EXPECT_EQ(controller.getRAPIDSymbol(other_resource), RAPIDNum{ 0.5f }.constructString());
+  EXPECT_EQ(interface.writeSuppressionCache().getStatistics().suppressed, 0u);
+}
+
+TEST(MockControllerTest, testWriteSuppressionV1)
+{
+  MockController controller{ version1Options() };
+  controller.setIOSignal("DO_1", "0");
+  controller.setIOSignal("AO_1", "0", "AO");
+
+  v1_0::RWSClient client{ controller.connectionOptions() };
+  v1_0::RWSInterface interface{ client };
+  interface.writeSuppressionCache().setEnabled(true);
+
+  interface.setDigitalSignal("DO_1", true);
+  interface.setAnalogSignal("AO_1", 1.5f);
+
+  // Rewriting the confirmed values does not reach the controller.
+  std::size_t const requests = controller.getStatistics().requests;
+  interface.setDigitalSignal("DO_1", true);
+  interface.setAnalogSignal("AO_1", 1.5f);
+  EXPECT_EQ(controller.getStatistics().requests, requests);
+
+  // Reading a value changed by others replaces the confirmed value, so that rewriting the previous value is not
+  // suppressed, e.g. when retrying a toggle of the signal.
+  controller.setIOSignal("DO_1", "0");
+  EXPECT_FALSE(interface.getDigitalSignal("DO_1"));
+  interface.setDigitalSignal("DO_1", true);
+  EXPECT_EQ(controller.getIOSignal("DO_1"), "1");
+
+  auto const statistics = interface.writeSuppressionCache().getStatistics();
+  EXPECT_EQ(statistics.suppressed, 2u);
+  EXPECT_EQ(statistics.written, 3u);
+}
+
+TEST(MockControllerTest, testRAPIDArrayRangeOverHTTPS)
+{
+  MockController controller{ secureOptions() };
+  RAPIDResource const resource{ "T_ROB1", "user", "values" };
+  controller.setRAPIDArraySymbol(resource, RAPIDArray<RAPIDNum, 5>{ 0.f, 1.f, 2.f, 3.f, 4.f });
+
+  v2_0::RWSClient client{ controller.connectionOptions() };
+  EXPECT_EQ(v2_0::rw::rapid::getRAPIDSymbolDimensions(client, resource), std::vector<std::size_t>{ 5 });
+
+  RAPIDDynamicArray<RAPIDNum> values;
+  v2_0::rw::rapid::getRAPIDSymbolData(client, resource, values, RAPIDArrayRange{ 1, 2 });
+  ASSERT_EQ(values.size(), 5u);
+  EXPECT_EQ(values.at(0).value, 0.f);
+  EXPECT_EQ(values.at(1).value, 1.f);
+  EXPECT_EQ(values.at(2).value, 2.f);
+  EXPECT_EQ(values.at(3).value, 0.f);
+
+  values.at(3).value = 30.f;
+  std::size_t const requests = controller.getStatistics().requests;
+  v2_0::rw::rapid::setRAPIDSymbolData(client, resource, values, RAPIDArrayRange{ 3, 1 });
+  EXPECT_EQ(controller.getStatistics().requests, requests + 1);
+  EXPECT_EQ(controller.getRAPIDSymbol(resource), "[0,1,2.0000000,30.0000000,4.0000000]");
+
+  EXPECT_THROW(v2_0::rw::rapid::getRAPIDSymbolData(client, resource, values, RAPIDArrayRange{ 4, 2 }),
+               std::out_of_range);
+}
+
+TEST(MockControllerTest, testRAPIDArrayRangeWholeArrayRead)
+{
+  MockController controller{ secureOptions() };
+  RAPIDResource const resource{ "T_ROB1", "user", "values" };
+  controller.setRAPIDArraySymbol(resource, RAPIDArray<RAPIDNum, 5>{ 0.f, 1.f, 2.f, 3.f, 4.f });
+
+  v2_0::RWSClient client{ controller.connectionOptions() };
+  EXPECT_EQ(v2_0::rw::rapid::getRAPIDSymbolDimensions(client, resource), std::vector<std::size_t>{ 5 });
+
+  // A range covering most of the array is read in one request, and the elements outside of it are left unchanged.
+  RAPIDDynamicArray<RAPIDNum> values{ 5 };
+  values.at(4).value = 40.f;
+  std::size_t const requests = controller.getStatistics().requests;
+  v2_0::rw::rapid::getRAPIDSymbolData(client, resource, values, RAPIDArrayRange{ 0, 4 });
+  EXPECT_EQ(controller.getStatistics().requests, requests + 1);
+  EXPECT_EQ(values.at(0).value, 0.f);
+  EXPECT_EQ(values.at(3).value, 3.f);
+  EXPECT_EQ(values.at(4).value, 40.f);
+
+  // The writes of a range overlap, and each element is written.
+  for (std::size_t i = 0; i < values.size(); ++i)
+    values.at(i).value = 10.f * i;
+  v2_0::rw::rapid::setRAPIDSymbolData(client, resource, values, RAPIDArrayRange{ 1, 4 });
+  v2_0::rw::rapid::getRAPIDSymbolData(client, resource, values, RAPIDArrayRange{ 0, 5 });
+  EXPECT_EQ(values.at(0).value, 0.f);
+  EXPECT_EQ(values.at(1).value, 10.f);
+  EXPECT_EQ(values.at(4).value, 40.f);
+}
+
+TEST(MockControllerTest, testFileService)
+{
+  MockController controller{ secureOptions() };
+  v2_0::RWSClient client{ controller.connectionOptions() };
+  FileResource const file{ "module.mod" };
+
+  client.uploadFile(file, "MODULE module\nENDMODULE");
+  EXPECT_EQ(controller.getFile("$home/module.mod"), "MODULE module\nENDMODULE");
+  EXPECT_EQ(client.getFile(file), "MODULE module\nENDMODULE");
+
+  client.deleteFile(file);
+  EXPECT_FALSE(controller.getFile("$home/module.mod"));
+}
+
+TEST(MockControllerTest, testServiceUnavailableInjection)
+{
+  MockControllerOptions options = secureOptions();
+  options.service_unavailable_probability = 1.0;
+
+  MockController controller{ options };
+  v2_0::RWSClient client{ controller.connectionOptions() };
+
+  EXPECT_THROW(client.getRobotWareSystem(), ProtocolError);
+  EXPECT_GE(controller.getStatistics().service_unavailable, 1u);
+
+  controller.setServiceUnavailableProbability(0.0);
+  EXPECT_NO_THROW(client.getRobotWareSystem());
+}
+
+TEST(MockControllerTest, testConcurrentRequestsUseSessionPool)
+{
+  MockControllerOptions const options;
+  MockController controller{ options };
+  POCOClient client{ [&controller] { return std::make_unique<Poco::Net::HTTPClientSession>("127.0.0.1",
+                                                                                           controller.port()); },
+                     options.username, options.password, 2, true };
+  client.httpGet(v2_0::Resources::RW_SYSTEM);
+
+  // Concurrent requests get a session each, up to the pool size.
+  controller.setLatency(std::chrono::milliseconds{ 100 });
+  std::vector<std::future<POCOResult>> results;
+  for (int i = 0; i < 4; ++i)
+    results.push_back(std::async(std::launch::async, [&client] { return client.httpGet(v2_0::Resources::RW_SYSTEM); }));
+
+  for (auto& result : results)
+    EXPECT_EQ(result.get().httpStatus(), Poco::Net::HTTPResponse::HTTP_OK);
+
+  auto const statistics = client.getSessionStatistics();
+  ASSERT_EQ(statistics.size(), 2u);
+  EXPECT_EQ(statistics[0].requests + statistics[1].requests, 5u);
+  EXPECT_GE(statistics[1].requests, 1u);
+}
+
+TEST(MockControllerTest, testPreemptiveDigestAuthentication)
+{
+  MockControllerOptions options;
+  options.digest_authentication = true;
+
+  MockController controller{ options };
+  POCOClient client{ [&controller] { return std::make_unique<Poco::Net::HTTPClientSession>("127.0.0.1",
+                                                                                           controller.port()); },
+                     options.username, options.password };
+
+  // The client drops its session cookie after a communication error, here a timed out request.
+  auto const reset_cookies = [&] {
+    client.setTimeout(std::chrono::microseconds{ std::chrono::milliseconds{ 100 } }.count());
+    controller.setLatency(std::chrono::milliseconds{ 300 });
+    EXPECT_THROW(client.httpGet(v2_0::Resources::RW_SYSTEM), CommunicationError);
+
+    controller.setLatency(std::chrono::microseconds{ 0 });
+    client.setTimeout(std::chrono::microseconds{ std::chrono::seconds{ 10 } }.count());
+  };
+
+  // The first request is challenged.
+  EXPECT_EQ(client.httpGet(v2_0::Resources::RW_SYSTEM).httpStatus(), Poco::Net::HTTPResponse::HTTP_OK);
+  EXPECT_EQ(controller.getStatistics().unauthorized, 1u);
+
+  // After a cookie reset, the accepted credentials are sent right away.
+  reset_cookies();
+  EXPECT_EQ(client.httpGet(v2_0::Resources::RW_SYSTEM).httpStatus(), Poco::Net::HTTPResponse::HTTP_OK);
+  EXPECT_EQ(controller.getStatistics().unauthorized, 1u);
+  EXPECT_EQ(client.metrics().getCounters().reauthentications, 1u);
+
+  // A stale nonce falls back to the server's challenge.
+  controller.expireNonces();
+  reset_cookies();
+  EXPECT_EQ(client.httpGet(v2_0::Resources::RW_SYSTEM).httpStatus(), Poco::Net::HTTPResponse::HTTP_OK);
+  EXPECT_EQ(controller.getStatistics().unauthorized, 2u);
+  EXPECT_EQ(client.metrics().getCounters().reauthentications, 2u);
+}
+
+TEST(MockControllerTest, testLatency)
+{
+  MockController controller{ secureOptions() };
+  v2_0::RWSClient client{ controller.connectionOptions() };
+  client.getRobotWareSystem();
+
+  controller.setLatency(std::chrono::milliseconds{ 50 });
+
+  auto const start = std::chrono::steady_clock::now();
+  client.getRobotWareSystem();
+
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds{ 50 });
+}
+}  // namespace abb::rws::mock
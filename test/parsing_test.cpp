@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <abb_librws/parsing.h>
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace abb ::rws
+{
+namespace
+{
+std::string const SIGNALS =
+    "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+    "<html xmlns=\"http://www.w3.org/1999/xhtml\"><body><div class=\"state\"><ul>"
+    "<li class=\"ios-signal-li\" title=\"DO_1\"><a href=\"/rw/iosystem/signals/DO_1\" rel=\"self\"></a>"
+    "<span class=\"name\">DO_1</span><span class=\"type\">DO</span><span class=\"lvalue\">1</span></li>"
+    "<li class=\"ios-signal-li\" title=\"AI_1\"><a href=\"/rw/iosystem/signals/AI_1\" rel=\"self\"></a>"
+    "<span class=\"name\">AI_1</span><span class=\"type\">AI</span><span class=\"lvalue\"> 0.5 </span></li>"
+    "</ul></div></body></html>";
+
+std::string const INSTANCES =
+    "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+    "<html xmlns=\"http://www.w3.org/1999/xhtml\"><body><div class=\"state\"><ul>"
+    "<li class=\"cfg-dt-instance-li\" title=\"rob1_1\"><a href=\"/rw/cfg/moc/arm/instances/rob1_1\"></a><ul>"
+    "<li class=\"cfg-ia-t-li\" title=\"name\"><span class=\"value\">rob1_1</span></li>"
+    "<li class=\"cfg-ia-t-li\" title=\"upper_joint_bound\"><span class=\"value\">3.14</span></li>"
+    "</ul></li>"
+    "</ul></div></body></html>";
+}  // namespace
+
+TEST(XMLExtractTest, testExtractRequestedFieldsInDocumentOrder)
+{
+  std::vector<std::pair<std::string, std::string>> fields;
+  std::vector<std::string> records;
+
+  xmlExtract(
+      SIGNALS, { { "class", "ios-signal-li" }, "class", { "name", "lvalue" } },
+      [&](std::string const& key, std::string const& text) { fields.emplace_back(key, text); },
+      [&](std::string const& key) { records.push_back(key); });
+
+  std::vector<std::pair<std::string, std::string>> const expected_fields{
+    { "name", "DO_1" }, { "lvalue", "1" }, { "name", "AI_1" }, { "lvalue", "0.5" }
+  };
+  EXPECT_EQ(fields, expected_fields);
+  EXPECT_EQ(records, (std::vector<std::string>{ "ios-signal-li", "ios-signal-li" }));
+}
+
+TEST(XMLExtractTest, testExtractFieldsWithFieldAttribute)
+{
+  std::vector<std::pair<std::string, std::string>> fields;
+  std::vector<std::string> records;
+
+  xmlExtract(
+      INSTANCES, { { "class", "cfg-dt-instance-li" }, "title", {}, { "class", "cfg-ia-t-li" } },
+      [&](std::string const& key, std::string const& text) { fields.emplace_back(key, text); },
+      [&](std::string const& key) { records.push_back(key); });
+
+  std::vector<std::pair<std::string, std::string>> const expected_fields{ { "name", "rob1_1" },
+                                                                          { "upper_joint_bound", "3.14" } };
+  EXPECT_EQ(fields, expected_fields);
+  EXPECT_EQ(records, std::vector<std::string>{ "rob1_1" });
+}
+
+TEST(XMLTextContentQueryTest, testFindAllAttributesInOneTraversal)
+{
+  auto const document = parseXml(SIGNALS);
+  XMLTextContentQuery const query{ XMLAttribute{ "class", "lvalue" }, XMLAttribute{ "class", "name" },
+                                   XMLAttribute{ "class", "missing" }, XMLAttribute{ "class", "name" } };
+
+  std::vector<std::string> const expected{ "1", "DO_1", "", "DO_1" };
+  EXPECT_EQ(query.find(document), expected);
+}
+
+TEST(XMLTextContentQueryTest, testFindBelowNode)
+{
+  auto const document = parseXml(SIGNALS);
+  auto const nodes = xmlFindNodes(document, XMLAttribute{ "class", "ios-signal-li" });
+  ASSERT_EQ(nodes.size(), 2u);
+
+  XMLTextContentQuery const query{ XMLAttribute{ "class", "name" }, XMLAttribute{ "class", "type" } };
+
+  EXPECT_EQ(query.find(nodes[1]), (std::vector<std::string>{ "AI_1", "AI" }));
+}
+
+TEST(DelimitedSubstringsTest, testSplitNestedAndQuotedValues)
+{
+  std::string const value = "[[1,2],\"a,[b\", 3 ,[[4],[5,6]]]";
+
+  std::vector<std::string_view> const expected{ "[1,2]", "\"a,[b\"", "3", "[[4],[5,6]]" };
+  EXPECT_EQ(splitDelimitedSubstrings(value, '[', ']', ','), expected);
+  EXPECT_EQ(extractDelimitedSubstrings(value, '[', ']', ','),
+            (std::vector<std::string>{ "[1,2]", "\"a,[b\"", "3", "[[4],[5,6]]" }));
+}
+
+TEST(DelimitedSubstringsTest, testSplitEscapedQuotesAndEmptyInput)
+{
+  std::vector<std::string_view> const expected{ "\"say \"\"hi,\"\"\"", "TRUE" };
+  EXPECT_EQ(splitDelimitedSubstrings("[\"say \"\"hi,\"\"\",TRUE]", '[', ']', ','), expected);
+  EXPECT_TRUE(splitDelimitedSubstrings("[]", '[', ']', ',').empty());
+  EXPECT_EQ(countCharInString("[[1],[2]]", '['), 3u);
+}
+}  // namespace abb::rws
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <abb_librws/rws_poco_session_pool.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+
+namespace abb ::rws
+{
+namespace
+{
+/**
+ * \brief A pool of sessions to an unused port. The sessions never connect, since the tests send no requests.
+ */
+struct CountingSessionPool
+{
+  explicit CountingSessionPool(std::size_t size)
+    : pool{ [this] {
+               ++created;
+               return std::make_unique<Poco::Net::HTTPClientSession>("127.0.0.1", 1);
+             },
+            size, true }
+  {
+  }
+
+  std::size_t created = 0;
+  POCOSessionPool pool;
+};
+}  // namespace
+
+TEST(POCOSessionPoolTest, testLazyCreation)
+{
+  CountingSessionPool sessions{ 2 };
+  EXPECT_EQ(sessions.created, 0u);
+
+  // A session is only created when no idle one is available, up to the pool size.
+  {
+    auto const lease = sessions.pool.acquire();
+    EXPECT_EQ(sessions.created, 1u);
+  }
+
+  {
+    auto const lease = sessions.pool.acquire();
+    EXPECT_EQ(sessions.created, 1u);
+
+    auto const second_lease = sessions.pool.acquire();
+    EXPECT_EQ(sessions.created, 2u);
+    EXPECT_NE(&lease.session(), &second_lease.session());
+  }
+
+  auto const first_lease = sessions.pool.acquire();
+  auto const second_lease = sessions.pool.acquire();
+  EXPECT_EQ(sessions.created, 2u);
+  EXPECT_EQ(sessions.pool.getStatistics().size(), 2u);
+}
+
+TEST(POCOSessionPoolTest, testLeaseExclusivity)
+{
+  CountingSessionPool sessions{ 1 };
+  auto lease = std::make_unique<POCOSessionPool::Lease>(sessions.pool.acquire());
+  Poco::Net::HTTPClientSession* const session = &lease->session();
+
+  // The only session is leased, so another caller waits until it is returned.
+  auto blocked_acquire = std::async(std::launch::async, [&] { return &sessions.pool.acquire().session(); });
+  EXPECT_EQ(blocked_acquire.wait_for(std::chrono::milliseconds{ 50 }), std::future_status::timeout);
+
+  lease.reset();
+  EXPECT_EQ(blocked_acquire.get(), session);
+  EXPECT_EQ(sessions.created, 1u);
+
+  auto const statistics = sessions.pool.getStatistics();
+  ASSERT_EQ(statistics.size(), 1u);
+  EXPECT_EQ(statistics[0].requests, 2u);
+  EXPECT_GE(statistics[0].wait_time, std::chrono::milliseconds{ 50 });
+}
+
+TEST(POCOSessionPoolTest, testMostRecentlyUsedReuse)
+{
+  CountingSessionPool sessions{ 2 };
+  auto first_lease = std::make_unique<POCOSessionPool::Lease>(sessions.pool.acquire());
+  auto second_lease = std::make_unique<POCOSessionPool::Lease>(sessions.pool.acquire());
+  Poco::Net::HTTPClientSession* const first = &first_lease->session();
+  Poco::Net::HTTPClientSession* const second = &second_lease->session();
+
+  // The session returned last is reused first, since its connection is the most likely to be still open.
+  first_lease.reset();
+  second_lease.reset();
+  EXPECT_EQ(&sessions.pool.acquire().session(), second);
+
+  auto const lease = sessions.pool.acquire();
+  EXPECT_EQ(&lease.session(), second);
+  EXPECT_EQ(&sessions.pool.acquire().session(), first);
+}
+
+TEST(POCOSessionPoolTest, testTimeoutPropagation)
+{
+  CountingSessionPool sessions{ 2 };
+  Poco::Timespan const timeout{ 2, 0 };
+
+  auto lease = std::make_unique<POCOSessionPool::Lease>(sessions.pool.acquire());
+  Poco::Net::HTTPClientSession* const leased = &lease->session();
+  {
+    auto const idle_lease = sessions.pool.acquire();
+  }
+
+  // Idle sessions are updated right away, leased ones when they are acquired again.
+  sessions.pool.setTimeout(timeout);
+  EXPECT_NE(leased->getTimeout(), timeout);
+
+  lease.reset();
+  {
+    auto const first_lease = sessions.pool.acquire();
+    auto const second_lease = sessions.pool.acquire();
+    EXPECT_EQ(first_lease.session().getTimeout(), timeout);
+    EXPECT_EQ(second_lease.session().getTimeout(), timeout);
+  }
+
+  // Sessions created later use the timeout as well.
+  CountingSessionPool later_sessions{ 1 };
+  later_sessions.pool.setTimeout(timeout);
+  EXPECT_EQ(later_sessions.pool.acquire().session().getTimeout(), timeout);
+
+  // Applying the timeout resets each session once.
+  auto const statistics = sessions.pool.getStatistics();
+  ASSERT_EQ(statistics.size(), 2u);
+  EXPECT_EQ(statistics[0].resets, 1u);
+  EXPECT_EQ(statistics[1].resets, 1u);
+}
+}  // namespace abb::rws
@@ -2,6 +2,8 @@
 
 #include "rws_rapid_test.h"
 
+#include <abb_librws/rws_rapid_value.h>
+
 namespace abb ::rws
 {
 TEST(RAPIDArrayTest, testConstructStringOneDimensionArray)
@@ -80,6 +82,17 @@ TEST(RAPIDArrayTest, testParseStringNestedArray)
   EXPECT_EQ(test_nested_array.constructString(), rapid_message);
 }
 
+TEST(RAPIDArrayTest, testParseStringQuotedSeparators)
+{
+  RAPIDArray<RAPIDString, 3> test_array;
+
+  test_array.parseString("[\"a,b\",\"[c]\",\"\"]");
+
+  EXPECT_EQ(test_array.at(0).value, "a,b");
+  EXPECT_EQ(test_array.at(1).value, "[c]");
+  EXPECT_EQ(test_array.at(2).value, "");
+}
+
 TEST(RAPIDArrayTest, testGetType)
 {
   RAPIDArray<MockRAPIDAtomic, 1> test_array;
@@ -88,6 +101,131 @@ TEST(RAPIDArrayTest, testGetType)
   RAPIDArray<RAPIDArray<MockRAPIDAtomic, 1>, 1> test_nested_array;
   EXPECT_EQ(test_nested_array.getType(), MockRAPIDAtomic().getType());
 }
+
+TEST(RAPIDDynamicArrayTest, testParseStringResizes)
+{
+  RAPIDDynamicArray<RAPIDNum> test_array{ 2 };
+  EXPECT_EQ(test_array.constructString(), "[0,0]");
+
+  test_array.parseString("[1,2,3.5]");
+
+  ASSERT_EQ(test_array.size(), 3u);
+  EXPECT_EQ(test_array.at(2).value, 3.5f);
+  EXPECT_EQ(test_array.getType(), "num");
+  EXPECT_EQ(test_array.constructString(), "[1,2.0000000,3.5000000]");
+}
+
+TEST(RAPIDRecordTest, testParseAndConstructString)
+{
+  std::string const value = "[TRUE,[[0,0,220.5],[1,0,0,0]],[1.5,[0,0,60],[1,0,0,0],0,0,0]]";
+  ToolData tool;
+
+  tool.parseString(value);
+
+  EXPECT_TRUE(tool.robhold.value);
+  EXPECT_EQ(tool.tframe.pos.z.value, 220.5f);
+  EXPECT_EQ(tool.tload.cog.z.value, 60.f);
+  EXPECT_EQ(tool.getType(), "tooldata");
+  EXPECT_EQ(tool.constructString(),
+            "[TRUE,[[0,0,220.5000000],[1,0,0,0]],[1.5000000,[0,0,60.0000000],[1,0,0,0],0,0,0]]");
+}
+
+TEST(RAPIDRecordTest, testCopyIsIndependent)
+{
+  RobTarget target;
+  target.parseString("[[1,2,3],[1,0,0,0],[0,0,0,0],[9E+09,9E+09,9E+09,9E+09,9E+09,9E+09]]");
+
+  RobTarget copy = target;
+  copy.parseString("[[4,5,6],[1,0,0,0],[0,0,0,0],[9E+09,9E+09,9E+09,9E+09,9E+09,9E+09]]");
+
+  EXPECT_EQ(target.pos.x.value, 1.f);
+  EXPECT_EQ(copy.pos.x.value, 4.f);
+}
+
+TEST(RAPIDRecordTest, testParseStringIgnoresComponentCountMismatch)
+{
+  Pos pos;
+  pos.parseString("[1,2,3]");
+  pos.parseString("[4,5]");
+
+  EXPECT_EQ(pos.constructString(), "[1,2.0000000,3.0000000]");
+}
+
+TEST(RAPIDNumTest, testConstructString)
+{
+  EXPECT_EQ(RAPIDNum{ 364.352f }.constructString(), "364.3519897");
+  EXPECT_EQ(RAPIDNum{ -1.2e-6f }.constructString(), "-1.2e-06");
+  EXPECT_EQ(RAPIDNum{ 1.f }.constructString(), "1");
+  EXPECT_EQ(RAPIDNum{ 9e9f }.constructString(), "8999999488.0000000");
+  EXPECT_EQ(RAPIDDnum{ 0.5 }.constructString(), "0.5");
+  EXPECT_EQ(RAPIDDnum{ 594.001 }.constructString(), "594.000999999999976");
+}
+
+TEST(RAPIDNumTest, testConstructStringIntoBuffer)
+{
+  char buffer[RAPIDNum::MAX_STRING_SIZE];
+  RAPIDNum const value{ -3.4e38f };
+
+  char* const end = value.constructString(buffer, buffer + RAPIDNum::MAX_STRING_SIZE);
+  EXPECT_EQ(std::string(buffer, end), value.constructString());
+  EXPECT_THROW(value.constructString(buffer, buffer + 8), std::length_error);
+}
+
+TEST(RAPIDNumTest, testParseString)
+{
+  RAPIDNum num;
+  num.parseString(" +9E+09");
+  EXPECT_EQ(num.value, 9e9f);
+
+  num.parseString("-1.2E-06");
+  EXPECT_EQ(num.value, -1.2e-6f);
+
+  num.parseString("abc");
+  EXPECT_EQ(num.value, 0.f);
+
+  RAPIDDnum dnum;
+  dnum.parseString("594.000999999999976");
+  EXPECT_EQ(dnum.value, 594.001);
+}
+
+TEST(RAPIDValueTest, testParseAndConstructString)
+{
+  RAPIDSchema const pos = RAPIDSchema::record(
+      "pos",
+      { { "x", RAPIDSchema::atomic("num") }, { "y", RAPIDSchema::atomic("num") }, { "z", RAPIDSchema::atomic("num") } });
+  RAPIDSchema const part = RAPIDSchema::record("partdata", { { "name", RAPIDSchema::atomic("string") },
+                                                             { "trans", pos },
+                                                             { "valid", RAPIDSchema::atomic("bool") },
+                                                             { "count", RAPIDSchema::atomic("byte") } });
+  auto const schema = std::make_shared<RAPIDSchema const>(RAPIDSchema::array(part, { 2 }));
+
+  RAPIDValue value{ schema };
+  EXPECT_EQ(value.getType(), "partdata");
+
+  value.parseString("[[\"a,b\",[0.25,0.5,1],TRUE,7],[\"c\",[0.125,0.75,0.5],FALSE,8]]");
+  EXPECT_EQ(std::get<std::string>(value.at("{1}.name")), "a,b");
+  EXPECT_EQ(std::get<float>(value.at("{2}.trans.y")), 0.75f);
+  EXPECT_EQ(std::get<bool>(value.at("{1}.valid")), true);
+  EXPECT_EQ(std::get<std::string>(value.at("{2}.count")), "8");
+
+  // Node indices resolved once can be reused for every value with the same schema.
+  std::size_t const z = schema->find("{2}.trans.z");
+  std::get<float>(value.at(z)) = 0.375f;
+  EXPECT_EQ(value.constructString(schema->find("{2}")), "[\"c\",[0.125,0.75,0.375],FALSE,8]");
+  EXPECT_EQ(value.constructString(), "[[\"a,b\",[0.25,0.5,1],TRUE,7],[\"c\",[0.125,0.75,0.375],FALSE,8]]");
+}
+
+TEST(RAPIDValueTest, testSchemaMismatch)
+{
+  auto const schema = std::make_shared<RAPIDSchema const>(
+      RAPIDSchema::record("pair", { { "a", RAPIDSchema::atomic("num") }, { "b", RAPIDSchema::atomic("num") } }));
+  RAPIDValue value{ schema };
+
+  EXPECT_THROW(value.parseString("[1,2,3]"), std::invalid_argument);
+  EXPECT_THROW(schema->find("c"), std::invalid_argument);
+  EXPECT_THROW(schema->find("{1}"), std::invalid_argument);
+  EXPECT_THROW(value.at(0), std::invalid_argument);
+}
 }  // namespace abb::rws
 
 int main(int argc, char** argv)
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <abb_librws/rws_request_metrics.h>
+
+#include <chrono>
+#include <string>
+
+namespace abb ::rws
+{
+TEST(RequestMetricsTest, testURITemplateRAPIDSymbols)
+{
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/rapid/symbol/RAPID/T_ROB1/user/reg1/data"),
+            "/rw/rapid/symbol/RAPID/{}/{}/{}/data");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/rapid/symbol/RAPID/T_ROB1/user/reg1/properties"),
+            "/rw/rapid/symbol/RAPID/{}/{}/{}/properties");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/rapid/symbol/data/RAPID/T_ROB1/user/reg1;value"),
+            "/rw/rapid/symbol/data/RAPID/{}/{}/{}");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/rapid/symbol/properties/RAPID/T_ROB1/user/reg1"),
+            "/rw/rapid/symbol/properties/RAPID/{}/{}/{}");
+
+  // Parameters that coincide with resource names are templated as well.
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/rapid/symbol/RAPID/T_ROB1/system/data/data"),
+            "/rw/rapid/symbol/RAPID/{}/{}/{}/data");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/rapid/symbol/data/RAPID/T_ROB1/module/start"),
+            "/rw/rapid/symbol/data/RAPID/{}/{}/{}");
+}
+
+TEST(RequestMetricsTest, testURITemplateResources)
+{
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/iosystem/signals/DO_1;state"), "/rw/iosystem/signals/{}");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/iosystem/signals/Local/DRV_1/DO_1/set-value"),
+            "/rw/iosystem/signals/{}/set-value");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/iosystem/signals/set-value"), "/rw/iosystem/signals/{}");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/cfg/MOC/ARM/instances"), "/rw/cfg/{}/{}/instances");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/motionsystem/mechunits/ROB_1/jointtarget"),
+            "/rw/motionsystem/mechunits/{}/jointtarget");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/motionsystem/mechunits/ROB_1?resource=static"),
+            "/rw/motionsystem/mechunits/{}");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/rapid/tasks/T_ROB1/loadmod?mastership=implicit"),
+            "/rw/rapid/tasks/{}/loadmod");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/rapid/tasks?action=activate"), "/rw/rapid/tasks");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/mastership/edit/request"), "/rw/mastership/{}/request");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/fileservice/$home/dir/module.mod"), "/fileservice/{}");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/subscription/3"), "/subscription/{}");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/poll/3"), "/poll/{}");
+}
+
+TEST(RequestMetricsTest, testURITemplateVerbatim)
+{
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/system"), "/rw/system");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/rapid/symbols/search"), "/rw/rapid/symbols/search");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/rapid/execution/start"), "/rw/rapid/execution/start");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/rw/panel/speedratio?action=setspeedratio"), "/rw/panel/speedratio");
+  EXPECT_EQ(RequestMetrics::uriTemplate("/"), "/");
+  EXPECT_EQ(RequestMetrics::uriTemplate(""), "/");
+}
+
+TEST(RequestMetricsTest, testRecordExchange)
+{
+  using namespace std::chrono_literals;
+
+  RequestMetrics metrics{ true };
+  RequestMetrics::Timestamps timestamps;
+  timestamps.start = RequestMetrics::Clock::time_point{} + 1s;
+  timestamps.header_sent = timestamps.start + 1ms;
+  timestamps.sent = timestamps.header_sent + 1ms;
+  timestamps.headers_received = timestamps.sent + 10ms;
+  timestamps.received = timestamps.headers_received + 2ms;
+
+  // Every exchange records all phases, and the reconnects are counted separately.
+  metrics.recordExchange("GET", "/rw/iosystem/signals/DO_1;state", timestamps);
+  timestamps.reconnected = true;
+  metrics.recordExchange("GET", "/rw/iosystem/signals/DO_2;state", timestamps);
+
+  auto const endpoints = metrics.getEndpointStatistics();
+  ASSERT_EQ(endpoints.size(), 1u);
+
+  auto const& statistics = endpoints.begin()->second;
+  EXPECT_EQ(statistics[static_cast<std::size_t>(RequestPhase::SEND_HEADER)].count, 2u);
+  EXPECT_EQ(statistics[static_cast<std::size_t>(RequestPhase::SEND_HEADER)].sum, 2ms);
+  EXPECT_EQ(statistics[static_cast<std::size_t>(RequestPhase::SEND_CONTENT)].sum, 2ms);
+  EXPECT_EQ(statistics[static_cast<std::size_t>(RequestPhase::WAIT)].sum, 20ms);
+  EXPECT_EQ(statistics[static_cast<std::size_t>(RequestPhase::RECEIVE)].sum, 4ms);
+  EXPECT_EQ(statistics[static_cast<std::size_t>(RequestPhase::TOTAL)].sum, 28ms);
+  EXPECT_EQ(statistics[static_cast<std::size_t>(RequestPhase::PARSE)].count, 0u);
+  EXPECT_EQ(metrics.getCounters().reconnects, 1u);
+
+  std::string const text = metrics.toPrometheusText();
+  EXPECT_NE(text.find("phase=\"send_header\""), std::string::npos);
+  EXPECT_NE(text.find("rws_request_reconnects_total 1"), std::string::npos);
+}
+}  // namespace abb::rws
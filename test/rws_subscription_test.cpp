@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <abb_librws/rws_error.h>
+#include <abb_librws/rws_subscription_queue.h>
+
+#include <chrono>
+#include <future>
+#include <string>
+#include <vector>
+
+namespace abb ::rws
+{
+namespace
+{
+struct IOSignalRecordingCallback : SubscriptionCallback
+{
+  void processEvent(IOSignalStateEvent const& event) override
+  {
+    io_signal_events.push_back(event);
+  }
+
+  std::vector<IOSignalStateEvent> io_signal_events;
+};
+}  // namespace
+
+TEST(SubscriptionEventQueueTest, testDropOldest)
+{
+  SubscriptionEventQueue queue{ 2, SubscriptionOverflowPolicy::DROP_OLDEST };
+  for (std::string const value : { "0", "1", "2" })
+    EXPECT_TRUE(queue.push(IOSignalStateEvent{ "DO_1", value }));
+
+  IOSignalRecordingCallback callback;
+  EXPECT_EQ(queue.dispatch(callback, std::chrono::seconds{ 1 }), 2u);
+  ASSERT_EQ(callback.io_signal_events.size(), 2u);
+  EXPECT_EQ(callback.io_signal_events[0].value, "1");
+  EXPECT_EQ(callback.io_signal_events[1].value, "2");
+
+  SubscriptionEventQueueStatistics const statistics = queue.getStatistics();
+  EXPECT_EQ(statistics.depth, 0u);
+  EXPECT_EQ(statistics.max_depth, 2u);
+  EXPECT_EQ(statistics.drops, 1u);
+  EXPECT_EQ(statistics.conflations, 0u);
+}
+
+TEST(SubscriptionEventQueueTest, testConflate)
+{
+  SubscriptionEventQueue queue{ 2, SubscriptionOverflowPolicy::CONFLATE };
+  IOSignalRecordingCallback callback;
+
+  // The queued event of the same signal is replaced in place.
+  queue.push(IOSignalStateEvent{ "DO_1", "0" });
+  queue.push(IOSignalStateEvent{ "DO_2", "0" });
+  queue.push(IOSignalStateEvent{ "DO_1", "1" });
+  EXPECT_EQ(queue.getStatistics().conflations, 1u);
+
+  EXPECT_EQ(queue.dispatch(callback, std::chrono::seconds{ 1 }), 2u);
+  ASSERT_EQ(callback.io_signal_events.size(), 2u);
+  EXPECT_EQ(callback.io_signal_events[0].signal, "DO_1");
+  EXPECT_EQ(callback.io_signal_events[0].value, "1");
+  EXPECT_EQ(callback.io_signal_events[1].signal, "DO_2");
+
+  // The oldest event is dropped when the queue is full of other signals.
+  for (std::string const signal : { "DO_1", "DO_2", "DO_3" })
+    queue.push(IOSignalStateEvent{ signal, "2" });
+
+  callback.io_signal_events.clear();
+  EXPECT_EQ(queue.dispatch(callback, std::chrono::seconds{ 1 }), 2u);
+  ASSERT_EQ(callback.io_signal_events.size(), 2u);
+  EXPECT_EQ(callback.io_signal_events[0].signal, "DO_2");
+  EXPECT_EQ(callback.io_signal_events[1].signal, "DO_3");
+  EXPECT_EQ(queue.getStatistics().drops, 1u);
+}
+
+TEST(SubscriptionEventQueueTest, testConflateBySource)
+{
+  SubscriptionEventQueue queue{ 4, SubscriptionOverflowPolicy::CONFLATE };
+  SubscriptionEventQueue::Source first_controller{ queue, "robot1" };
+  SubscriptionEventQueue::Source second_controller{ queue, "robot2" };
+  IOSignalRecordingCallback callback;
+
+  // Equally named signals of different controllers sharing the queue are not conflated.
+  first_controller.processEvents({ IOSignalStateEvent{ "DO_1", "0" } });
+  second_controller.processEvents({ IOSignalStateEvent{ "DO_1", "1" } });
+  first_controller.processEvents({ IOSignalStateEvent{ "DO_1", "2" } });
+  EXPECT_EQ(queue.getStatistics().conflations, 1u);
+
+  EXPECT_EQ(queue.dispatch(callback, std::chrono::seconds{ 1 }), 2u);
+  ASSERT_EQ(callback.io_signal_events.size(), 2u);
+  EXPECT_EQ(callback.io_signal_events[0].value, "2");
+  EXPECT_EQ(callback.io_signal_events[1].value, "1");
+}
+
+TEST(SubscriptionEventQueueTest, testBlockAndClose)
+{
+  SubscriptionEventQueue queue{ 1 };
+  IOSignalRecordingCallback callback;
+
+  // The producer waits until the consumer has made room.
+  queue.push(IOSignalStateEvent{ "DO_1", "0" });
+  auto blocked_push =
+      std::async(std::launch::async, [&] { return queue.push(IOSignalStateEvent{ "DO_1", "1" }); });
+  EXPECT_EQ(blocked_push.wait_for(std::chrono::milliseconds{ 50 }), std::future_status::timeout);
+
+  EXPECT_EQ(queue.dispatch(callback, std::chrono::seconds{ 1 }), 1u);
+  EXPECT_TRUE(blocked_push.get());
+  EXPECT_EQ(queue.dispatch(callback, std::chrono::seconds{ 1 }), 1u);
+  ASSERT_EQ(callback.io_signal_events.size(), 2u);
+  EXPECT_EQ(callback.io_signal_events[1].value, "1");
+  EXPECT_EQ(queue.getStatistics().drops, 0u);
+
+  // Events queued after closing are dropped, and the consumer does not wait anymore.
+  queue.close();
+  EXPECT_FALSE(queue.push(IOSignalStateEvent{ "DO_1", "2" }));
+  EXPECT_EQ(queue.dispatch(callback, std::chrono::seconds{ 10 }), 0u);
+  EXPECT_EQ(queue.getStatistics().drops, 1u);
+}
+
+TEST(SubscriptionEventTest, testParseRAPIDSymbolValueEventURI)
+{
+  // RWS 1.0
+  RAPIDSymbolValueEvent event = parseRAPIDSymbolValueEventURI("/rw/rapid/symbol/data/RAPID/T_ROB1/user/reg1;value");
+  EXPECT_EQ(event.task, "T_ROB1");
+  EXPECT_EQ(event.module, "user");
+  EXPECT_EQ(event.name, "reg1");
+  EXPECT_TRUE(event.value.empty());
+
+  // RWS 2.0
+  event = parseRAPIDSymbolValueEventURI("/rw/rapid/symbol/RAPID/T_ROB1/system/data/data;value");
+  EXPECT_EQ(event.task, "T_ROB1");
+  EXPECT_EQ(event.module, "system");
+  EXPECT_EQ(event.name, "data");
+
+  EXPECT_THROW(parseRAPIDSymbolValueEventURI("/rw/rapid/symbol/RAPID/T_ROB1;value"), ProtocolError);
+  EXPECT_THROW(parseRAPIDSymbolValueEventURI("/rw/iosystem/signals/DO_1;state"), ProtocolError);
+}
+}  // namespace abb::rws